@@ -0,0 +1,261 @@
+ /*
+ * sim70xx_bench_parser.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include "sim70xx_tools.h"
+#include "Private/Parser/sim70xx_parser.h"
+
+#include "sim70xx_host_bench.h"
+
+/** @brief Number of parsed responses per measured operation.
+ *         NOTE: A single response is parsed in less than a microsecond. So a batch is measured to get usable timings.
+ */
+#define SIM70XX_BENCH_PARSER_BATCH                  1000
+
+/** @brief Parsed signal quality report.
+ */
+typedef struct
+{
+    int32_t RSSI;
+    int32_t RXQual;
+} Bench_CSQ_t;
+
+/** @brief Parsed engineering report.
+ */
+typedef struct
+{
+    uint32_t EARFCN;
+    int32_t Offset;
+    uint32_t PCI;
+    std::string CellID;
+    int32_t RSRP;
+    int32_t RSRQ;
+    int32_t RSSI;
+    int32_t SNR;
+    uint32_t Band;
+    std::string TAC;
+    uint32_t ECL;
+    int32_t TxPower;
+    int32_t ReRSRP;
+} Bench_CENG_t;
+
+/** @brief Parsed HTTP content frame.
+ */
+typedef struct
+{
+    uint32_t ID;
+    uint32_t Flag;
+    uint32_t ContentLength;
+    uint32_t PackageLength;
+    size_t PayloadLength;
+} Bench_NMIC_t;
+
+static const std::string _CSQ = "20,0";
+static const std::string _CENG = "2506,2,104,\"0A2B3C4D\",-853,-109,-780,45,8,\"1A2B\",0,-50,-853";
+static const std::string _NMIC = "0,1,1024,512," + std::string(1024, 'A');
+
+/** @brief              Parse a signal quality report with the response parser.
+ *  @param Response     Response
+ *  @param p_Report     Pointer to report
+ *  @return             #true when successful
+ */
+static bool Bench_CSQ_Parser(const std::string& Response, Bench_CSQ_t* p_Report)
+{
+    SIM70XX_Parser_t Parser;
+
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->RSSI);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->RXQual);
+
+    return Parser.isError == false;
+}
+
+/** @brief              Parse a signal quality report like the driver did before the response parser was added.
+ *  @param Response     Response
+ *  @param p_Report     Pointer to report
+ *  @return             #true when successful
+ */
+static bool Bench_CSQ_Legacy(const std::string& Response, Bench_CSQ_t* p_Report)
+{
+    size_t Index;
+
+    Index = Response.find(",");
+    p_Report->RSSI = std::stoi(Response.substr(0, Index));
+    p_Report->RXQual = std::stoi(Response.substr(Response.find_last_of(",") + 1));
+
+    return true;
+}
+
+/** @brief              Parse an engineering report with the response parser.
+ *  @param Response     Response
+ *  @param p_Report     Pointer to report
+ *  @return             #true when successful
+ */
+static bool Bench_CENG_Parser(const std::string& Response, Bench_CENG_t* p_Report)
+{
+    SIM70XX_Parser_t Parser;
+
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Report->EARFCN);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->Offset);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Report->PCI);
+    SIM70XX_Parser_GetString(&Parser, &p_Report->CellID);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->RSRP);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->RSRQ);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->RSSI);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->SNR);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Report->Band);
+    SIM70XX_Parser_GetString(&Parser, &p_Report->TAC);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Report->ECL);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->TxPower);
+    SIM70XX_Parser_GetInt(&Parser, &p_Report->ReRSRP);
+
+    return Parser.isError == false;
+}
+
+/** @brief              Parse an engineering report like the driver did before the response parser was added.
+ *                      NOTE: The quotes of the string fields are removed to get the same result as with the response parser.
+ *  @param Response     Response
+ *  @param p_Report     Pointer to report
+ *  @return             #true when successful
+ */
+static bool Bench_CENG_Legacy(const std::string& Response, Bench_CENG_t* p_Report)
+{
+    std::string Copy = Response;
+
+    p_Report->EARFCN = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->Offset = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->PCI = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->CellID = SIM70XX_Tools_SubstringSplitErase(&Copy);
+    p_Report->CellID = p_Report->CellID.substr(1, p_Report->CellID.size() - 2);
+    p_Report->RSRP = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->RSRQ = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->RSSI = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->SNR = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->Band = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->TAC = SIM70XX_Tools_SubstringSplitErase(&Copy);
+    p_Report->TAC = p_Report->TAC.substr(1, p_Report->TAC.size() - 2);
+    p_Report->ECL = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->TxPower = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Report->ReRSRP = std::stoi(Copy);
+
+    return true;
+}
+
+/** @brief              Parse a HTTP content frame with the response parser.
+ *  @param Response     Response
+ *  @param p_Frame      Pointer to frame
+ *  @return             #true when successful
+ */
+static bool Bench_NMIC_Parser(const std::string& Response, Bench_NMIC_t* p_Frame)
+{
+    SIM70XX_Field_t Payload;
+    SIM70XX_Parser_t Parser;
+
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Frame->ID);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Frame->Flag);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Frame->ContentLength);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Frame->PackageLength);
+    SIM70XX_Parser_GetRemaining(&Parser, &Payload);
+    p_Frame->PayloadLength = Payload.Length;
+
+    return Parser.isError == false;
+}
+
+/** @brief              Parse a HTTP content frame like the driver did before the response parser was added.
+ *  @param Response     Response
+ *  @param p_Frame      Pointer to frame
+ *  @return             #true when successful
+ */
+static bool Bench_NMIC_Legacy(const std::string& Response, Bench_NMIC_t* p_Frame)
+{
+    std::string Copy = Response;
+
+    p_Frame->ID = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Frame->Flag = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Frame->ContentLength = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Frame->PackageLength = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Copy));
+    p_Frame->PayloadLength = Copy.size();
+
+    return true;
+}
+
+/** @brief              Measure a parser with a batch of responses and check the result against the expected result.
+ *  @param Name         Name of the benchmark
+ *  @param Iterations   Number of batches
+ *  @param Response     Response
+ *  @param Parse        Parser function
+ *  @param isEqual      Compare function for the result
+ *  @return             Benchmark result
+ */
+template<typename T>
+static SIM70XX_Bench_Result_t Bench_Parse(std::string Name, uint32_t Iterations, const std::string& Response, bool (*Parse)(const std::string&, T*),
+                                          std::function<bool(const T&)> isEqual)
+{
+    T Result = T();
+
+    return SIM70XX_Bench_Run(Name, Iterations, SIM70XX_BENCH_PARSER_BATCH * Response.size(), [&]() {
+        bool isValid = true;
+
+        for(uint32_t i = 0; i < SIM70XX_BENCH_PARSER_BATCH; i++)
+        {
+            isValid &= Parse(Response, &Result);
+        }
+
+        return isValid && isEqual(Result);
+    });
+}
+
+/** @brief  Compare the response parser with the string based parsing, which was used before.
+ *          Usage: sim70xx_bench_parser [-n iterations] [-o report.json]
+ *          NOTE: Each iteration parses a batch of SIM70XX_BENCH_PARSER_BATCH responses. The throughput is in batches per second.
+ */
+int main(int argc, char** argv)
+{
+    uint32_t Iterations = 100;
+    std::string Report;
+    std::vector<SIM70XX_Bench_Result_t> Results;
+
+    SIM70XX_Bench_ParseArgs(argc, argv, &Iterations, &Report);
+
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    std::function<bool(const Bench_CSQ_t&)> isCSQ = [](const Bench_CSQ_t& Report) {
+        return (Report.RSSI == 20) && (Report.RXQual == 0);
+    };
+    std::function<bool(const Bench_CENG_t&)> isCENG = [](const Bench_CENG_t& Report) {
+        return (Report.EARFCN == 2506) && (Report.Offset == 2) && (Report.PCI == 104) && (Report.CellID == "0A2B3C4D") && (Report.RSRP == -853) &&
+               (Report.RSRQ == -109) && (Report.RSSI == -780) && (Report.SNR == 45) && (Report.Band == 8) && (Report.TAC == "1A2B") &&
+               (Report.ECL == 0) && (Report.TxPower == -50) && (Report.ReRSRP == -853);
+    };
+    std::function<bool(const Bench_NMIC_t&)> isNMIC = [](const Bench_NMIC_t& Frame) {
+        return (Frame.ID == 0) && (Frame.Flag == 1) && (Frame.ContentLength == 1024) && (Frame.PackageLength == 512) && (Frame.PayloadLength == 1024);
+    };
+
+    Results.push_back(Bench_Parse<Bench_CSQ_t>("CSQ_Parser", Iterations, _CSQ, Bench_CSQ_Parser, isCSQ));
+    Results.push_back(Bench_Parse<Bench_CSQ_t>("CSQ_Legacy", Iterations, _CSQ, Bench_CSQ_Legacy, isCSQ));
+    Results.push_back(Bench_Parse<Bench_CENG_t>("CENG_Parser", Iterations, _CENG, Bench_CENG_Parser, isCENG));
+    Results.push_back(Bench_Parse<Bench_CENG_t>("CENG_Legacy", Iterations, _CENG, Bench_CENG_Legacy, isCENG));
+    Results.push_back(Bench_Parse<Bench_NMIC_t>("NMIC_Parser", Iterations, _NMIC, Bench_NMIC_Parser, isNMIC));
+    Results.push_back(Bench_Parse<Bench_NMIC_t>("NMIC_Legacy", Iterations, _NMIC, Bench_NMIC_Legacy, isNMIC));
+
+    return SIM70XX_Bench_Report("parser", Results, Report);
+}
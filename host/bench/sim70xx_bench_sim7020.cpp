@@ -0,0 +1,95 @@
+ /*
+ * sim70xx_bench_sim7020.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include "sim7020.h"
+
+#include "sim70xx_host_bench.h"
+#include "sim70xx_host_modem.h"
+
+static SIM7020_t _Device;
+
+/** @brief  Measure the driver against the modem simulator.
+ *          Usage: sim70xx_bench_sim7020 [-n iterations] [-o report.json] [simulator options...]
+ */
+int main(int argc, char** argv)
+{
+    uint32_t Iterations = 100;
+    std::string Report;
+    std::vector<std::string> Args = {"--device", "SIM7020"};
+    std::vector<SIM70XX_Bench_Result_t> Results;
+    SIM70XX_Host_Modem_t Modem;
+    SIM7020_MQTT_Socket_t MQTT = SIM7020_MQTT_Socket_t();
+    SIM7020_HTTP_Socket_t HTTP = SIM7020_HTTP_Socket_t();
+    SIM7020_Config_t Config = SIM70XX_DEFAULT_CONF_1NCE(UART_NUM_1, SIM_BAUD_115200, GPIO_NUM_NC, GPIO_NUM_NC);
+    std::string Message(64, 'M');
+    std::string Payload(256, 'P');
+
+    SIM70XX_Bench_ParseArgs(argc, argv, &Iterations, &Report, &Args);
+
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    if(SIM70XX_Host_StartModem(&Modem, Config.UART.Interface, Args) == false)
+    {
+        return EXIT_FAILURE;
+    }
+
+    // The initialization takes much longer than the other operations. Use less iterations.
+    Results.push_back(SIM70XX_Bench_Run("Init", std::max(Iterations / 10, 1U), 0, [&]() {
+        return SIM7020_Init(_Device, Config) == SIM70XX_ERR_OK;
+    }));
+
+    Results.push_back(SIM70XX_Bench_Run("AT", Iterations, 0, [&]() {
+        return SIM7020_Ping(_Device) == SIM70XX_ERR_OK;
+    }));
+
+    // A command with a response line in front of the status.
+    Results.push_back(SIM70XX_Bench_Run("CSQ", Iterations, 0, [&]() {
+        SIM70XX_Qual_t Report;
+
+        return SIM7020_Info_GetQuality(_Device, &Report) == SIM70XX_ERR_OK;
+    }));
+
+    if((SIM7020_MQTT_Create(_Device, &MQTT, "broker.local") == SIM70XX_ERR_OK) && (SIM7020_MQTT_Connect(_Device, "SIM7020", &MQTT) == SIM70XX_ERR_OK))
+    {
+        Results.push_back(SIM70XX_Bench_Run("MQTT_Publish", Iterations, Message.size(), [&]() {
+            return SIM7020_MQTT_Publish(_Device, &MQTT, "bench", SIM7020_MQTT_QOS_0, Message, false, false) == SIM70XX_ERR_OK;
+        }));
+
+        SIM7020_MQTT_Destroy(_Device, &MQTT);
+    }
+
+    if((SIM7020_HTTP_Create(_Device, "http://server.local", &HTTP) == SIM70XX_ERR_OK) && (SIM7020_HTTP_Connect(_Device, &HTTP, 5) == SIM70XX_ERR_OK))
+    {
+        Results.push_back(SIM70XX_Bench_Run("HTTP_POST", Iterations, Payload.size(), [&]() {
+            uint16_t Code;
+
+            return (SIM7020_HTTP_POST(_Device, &HTTP, "/bench", "text/plain", "", Payload, &Code) == SIM70XX_ERR_OK) && (Code == 200);
+        }));
+
+        SIM7020_HTTP_Disconnect(_Device, &HTTP);
+        SIM7020_HTTP_Destroy(_Device, &HTTP);
+    }
+
+    SIM7020_Deinit(_Device);
+    SIM70XX_Host_StopModem(&Modem);
+
+    return SIM70XX_Bench_Report("sim7020", Results, Report);
+}
@@ -0,0 +1,87 @@
+ /*
+ * sim70xx_bench_sim7080.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include "sim7080.h"
+
+#include "sim70xx_host_bench.h"
+#include "sim70xx_host_modem.h"
+
+static SIM7080_t _Device;
+
+/** @brief  Measure the driver against the modem simulator.
+ *          Usage: sim70xx_bench_sim7080 [-n iterations] [-o report.json] [simulator options...]
+ */
+int main(int argc, char** argv)
+{
+    uint32_t Iterations = 100;
+    std::string Report;
+    std::string Received;
+    std::vector<std::string> Args = {"--device", "SIM7080"};
+    std::vector<SIM70XX_Bench_Result_t> Results;
+    SIM70XX_Host_Modem_t Modem;
+    SIM7080_TCP_Socket_t Socket = SIM7080_TCP_Socket_t();
+    SIM7080_Config_t Config = SIM70XX_DEFAULT_CONF_1NCE(UART_NUM_1, SIM_BAUD_115200, GPIO_NUM_NC, GPIO_NUM_NC);
+    std::vector<uint8_t> Data(1024, 0x55);
+
+    Config.Bandlist = {8, 20};
+
+    SIM70XX_Bench_ParseArgs(argc, argv, &Iterations, &Report, &Args);
+
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    if(SIM70XX_Host_StartModem(&Modem, Config.UART.Interface, Args) == false)
+    {
+        return EXIT_FAILURE;
+    }
+
+    // The initialization takes much longer than the other operations. Use less iterations.
+    Results.push_back(SIM70XX_Bench_Run("Init", std::max(Iterations / 10, 1U), 0, [&]() {
+        return SIM7080_Init(_Device, Config) == SIM70XX_ERR_OK;
+    }));
+
+    Results.push_back(SIM70XX_Bench_Run("AT", Iterations, 0, [&]() {
+        return SIM7080_Ping(_Device) == SIM70XX_ERR_OK;
+    }));
+
+    // A command with a response line in front of the status.
+    Results.push_back(SIM70XX_Bench_Run("CSQ", Iterations, 0, [&]() {
+        SIM70XX_Qual_t Report;
+
+        return SIM7080_Info_GetQuality(_Device, &Report) == SIM70XX_ERR_OK;
+    }));
+
+    if((SIM7080_TCP_Client_Create(_Device, "192.168.0.1", 80, &Socket) == SIM70XX_ERR_OK) && (SIM7080_TCP_Client_Connect(_Device, &Socket) == SIM70XX_ERR_OK))
+    {
+        // The simulated server sends the data back. Read them before the next transmission.
+        Results.push_back(SIM70XX_Bench_Run("TCP_Client_Transmit", Iterations, Data.size(), [&]() {
+            return SIM7080_TCP_Client_Transmit(_Device, &Socket, Data.data(), Data.size()) == SIM70XX_ERR_OK;
+        }, [&]() {
+            SIM7080_TCP_Client_Receive(_Device, &Socket, Data.size(), &Received);
+        }));
+
+        SIM7080_TCP_Client_Destroy(_Device, &Socket);
+    }
+
+    SIM7080_Deinit(_Device);
+    SIM70XX_Host_StopModem(&Modem);
+
+    return SIM70XX_Bench_Report("sim7080", Results, Report);
+}
@@ -0,0 +1,166 @@
+ /*
+ * sim70xx_bench_tools.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <stdio.h>
+
+#include "sim70xx_tools.h"
+
+#include "sim70xx_host_bench.h"
+
+/** @brief Number of input bytes per measured operation.
+ */
+#define SIM70XX_BENCH_TOOLS_LENGTH                  16384
+
+/** @brief          Convert a buffer into a hex string with sprintf, which was used before the hex encoder.
+ *  @param p_Buffer Pointer to data buffer
+ *  @param Length   Buffer length
+ *  @param p_Hex    Pointer to hexadecimal ASCII string
+ */
+static void Bench_ASCII2Hex_Legacy(const void* const p_Buffer, uint32_t Length, std::string* const p_Hex)
+{
+    char Buffer[3];
+
+    p_Hex->clear();
+
+    for(uint32_t i = 0; i < Length; i++)
+    {
+        sprintf(Buffer, "%02x", ((uint8_t*)p_Buffer)[i]);
+        p_Hex->append(std::string(Buffer));
+    }
+}
+
+/** @brief          Convert a hex string into a buffer with the lenient decoder, which was used before the hex decoder.
+ *                  NOTE: The output index is 32 bit wide. The old decoder used an 8 bit index and can´t decode more than 255 bytes.
+ *  @param Hex      Hex string
+ *  @param p_Buffer Pointer to data buffer
+ */
+static void Bench_Hex2ASCII_Legacy(const std::string& Hex, uint8_t* const p_Buffer)
+{
+    uint32_t Offset;
+    uint8_t High = 0;
+
+    Offset = 0;
+    for(uint32_t i = 0; i < Hex.size(); i++)
+    {
+        uint8_t Temp = 0;
+
+        if((Hex.at(i) >= '0') && (Hex.at(i) <= '9'))
+        {
+            Temp = (uint8_t)Hex.at(i) - 0x30;
+        }
+        else if((Hex.at(i) >= 'a') && (Hex.at(i) <= 'f'))
+        {
+            Temp = (uint8_t)Hex.at(i) - 'a' + 10;
+        }
+        else if((Hex.at(i) >= 'A') && (Hex.at(i) <= 'F'))
+        {
+            Temp = (uint8_t)Hex.at(i) - 'A' + 10;
+        }
+
+        if((i % 2) == 0)
+        {
+            High = Temp;
+        }
+        else
+        {
+            *(p_Buffer + (Offset++)) = (High << 0x04) + Temp;
+        }
+    }
+}
+
+/** @brief  Measure the throughput of the hex and the Base64 codecs. The throughput is reported in input bytes per second.
+ *          Usage: sim70xx_bench_tools [-n iterations] [-o report.json]
+ */
+int main(int argc, char** argv)
+{
+    uint32_t Iterations = 100;
+    std::string Hex;
+    std::string Base64;
+    std::string Report;
+    std::vector<uint8_t> Data(SIM70XX_BENCH_TOOLS_LENGTH);
+    std::vector<uint8_t> Decoded(SIM70XX_BENCH_TOOLS_LENGTH);
+    std::vector<SIM70XX_Bench_Result_t> Results;
+
+    SIM70XX_Bench_ParseArgs(argc, argv, &Iterations, &Report);
+
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    for(size_t i = 0; i < Data.size(); i++)
+    {
+        Data[i] = (uint8_t)((i * 167) + 13);
+    }
+
+    // Reserve the output strings. So only the allocations of the codecs are counted.
+    Hex.reserve(2 * Data.size());
+    Base64.reserve(SIM70XX_TOOLS_BASE64_LENGTH(Data.size()));
+
+    Results.push_back(SIM70XX_Bench_Run("HexEncode", Iterations, Data.size(), [&]() {
+        SIM70XX_Tools_ASCII2Hex(Data.data(), Data.size(), &Hex);
+
+        return Hex.size() == (2 * Data.size());
+    }));
+    Results.push_back(SIM70XX_Bench_Run("HexEncode_Legacy", Iterations, Data.size(), [&]() {
+        Bench_ASCII2Hex_Legacy(Data.data(), Data.size(), &Hex);
+
+        return Hex.size() == (2 * Data.size());
+    }));
+
+    SIM70XX_Tools_ASCII2Hex(Data.data(), Data.size(), &Hex);
+    Results.push_back(SIM70XX_Bench_Run("HexDecode", Iterations, Data.size(), [&]() {
+        return (SIM70XX_Tools_HexDecode(Hex.c_str(), Hex.size(), Decoded.data()) == SIM70XX_ERR_OK) && (Decoded == Data);
+    }, [&]() {
+        Decoded.assign(Decoded.size(), 0);
+    }));
+    Results.push_back(SIM70XX_Bench_Run("HexDecode_Legacy", Iterations, Data.size(), [&]() {
+        Bench_Hex2ASCII_Legacy(Hex, Decoded.data());
+
+        return Decoded == Data;
+    }, [&]() {
+        Decoded.assign(Decoded.size(), 0);
+    }));
+
+    Results.push_back(SIM70XX_Bench_Run("Base64", Iterations, Data.size(), [&]() {
+        return SIM70XX_Tools_ToBase64(Data.data(), Data.size(), &Base64) && (Base64.size() == SIM70XX_TOOLS_BASE64_LENGTH(Data.size()));
+    }));
+
+    // Encode in 128 character blocks like the UART transmit path.
+    Results.push_back(SIM70XX_Bench_Run("Base64_Blocks", Iterations, Data.size(), [&]() {
+        char Block[128];
+        size_t Written;
+        SIM70XX_Base64_t Context;
+
+        Written = 0;
+        SIM70XX_Tools_Base64Init(&Context);
+        for(size_t Offset = 0; Offset < Data.size(); )
+        {
+            size_t Length;
+
+            Length = std::min((sizeof(Block) / 4) * 3, Data.size() - Offset);
+            Written += SIM70XX_Tools_Base64Update(&Context, &Data[Offset], Length, Block);
+            Offset += Length;
+        }
+        Written += SIM70XX_Tools_Base64Final(&Context, Block);
+
+        return Written == SIM70XX_TOOLS_BASE64_LENGTH(Data.size());
+    }));
+
+    return SIM70XX_Bench_Report("tools", Results, Report);
+}
@@ -0,0 +1,254 @@
+ /*
+ * sim70xx_bench_uart.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include <esp_log.h>
+
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <thread>
+
+#include "sim70xx_tools.h"
+#include "Private/UART/sim70xx_uart.h"
+#include "Private/Port/sim70xx_port.h"
+
+#include "sim70xx_host_bench.h"
+
+/** @brief Number of received bytes per measured operation.
+ */
+#define SIM70XX_BENCH_UART_LENGTH                   16384
+
+/** @brief Length of a received line with line end.
+ */
+#define SIM70XX_BENCH_UART_LINE                     64
+
+/** @brief Lock and driver calls of the per-byte receive path, which was used before the receive ring buffer.
+ */
+static SemaphoreHandle_t _Lock;
+static uint64_t _LegacyLocks;
+static uint64_t _LegacyCalls;
+
+/** @brief          Wait for a character and read it with the per-byte receive path, which was used before the receive ring buffer.
+ *                  Each character takes the interface lock twice and needs two calls into the serial driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param Timeout  Read timeout in milliseconds
+ *  @return         Received character or -1 when no character received
+ */
+static int Bench_Read_Legacy(SIM70XX_UART_Conf_t& p_Config, uint32_t Timeout)
+{
+    unsigned long Now;
+
+    Now = SIM70XX_Tools_GetmsTimer();
+    do
+    {
+        size_t Avail;
+
+        xSemaphoreTake(_Lock, portMAX_DELAY);
+        Avail = SIM70XX_Port_UART_GetBuffered(p_Config);
+        xSemaphoreGive(_Lock);
+        _LegacyLocks++;
+        _LegacyCalls++;
+
+        if(Avail != 0)
+        {
+            uint8_t c;
+
+            xSemaphoreTake(_Lock, portMAX_DELAY);
+            if(SIM70XX_Port_UART_Read(p_Config, &c, sizeof(uint8_t), 20 / portTICK_PERIOD_MS) <= 0)
+            {
+                c = 0;
+            }
+            xSemaphoreGive(_Lock);
+            _LegacyLocks++;
+            _LegacyCalls++;
+
+            return c;
+        }
+    } while((SIM70XX_Tools_GetmsTimer() - Now) < Timeout);
+
+    return -1;
+}
+
+/** @brief          Read a line with the per-byte receive path, which was used before the receive ring buffer.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Line   Pointer to line
+ */
+static void Bench_ReadLine_Legacy(SIM70XX_UART_Conf_t& p_Config, std::string* p_Line)
+{
+    int c;
+    std::string Return;
+
+    c = Bench_Read_Legacy(p_Config, 1000);
+    while((c >= 0) && (c != '\n'))
+    {
+        Return += (char)c;
+        c = Bench_Read_Legacy(p_Config, 1000);
+    }
+
+    *p_Line = Return;
+}
+
+/** @brief  Get the CPU time of the calling thread.
+ *  @return CPU time in us
+ */
+static double Bench_GetCPUTime(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &Now);
+
+    return (Now.tv_sec * 1000000.0) + (Now.tv_nsec / 1000.0);
+}
+
+/** @brief              Receive SIM70XX_BENCH_UART_LENGTH bytes of lines from a writer thread.
+ *  @param Name         Name of the benchmark
+ *  @param Iterations   Number of operations
+ *  @param p_Config     Pointer to SIM70XX UART configuration object
+ *  @param FD           File descriptor of the module side
+ *  @param Payload      Received data
+ *  @param ReadLine     Line reader
+ *  @param p_Locks      Pointer to lock counter
+ *  @param p_Calls      Pointer to driver call counter
+ *  @return             Benchmark result
+ */
+static SIM70XX_Bench_Result_t Bench_Receive(std::string Name, uint32_t Iterations, SIM70XX_UART_Conf_t& p_Config, int FD, const std::string& Payload,
+                                            std::function<void(std::string*)> ReadLine, const uint64_t* p_Locks, const uint64_t* p_Calls)
+{
+    double CPU;
+    uint64_t Locks;
+    uint64_t Calls;
+    std::string Line;
+    SIM70XX_Bench_Result_t Result;
+
+    Line.reserve(SIM70XX_BENCH_UART_LINE);
+
+    CPU = 0.0;
+    Locks = *p_Locks;
+    Calls = *p_Calls;
+    Result = SIM70XX_Bench_Run(Name, Iterations, Payload.size(), [&]() {
+        bool isValid;
+        size_t Received;
+        double Start;
+
+        std::thread Writer([&]() {
+            for(size_t Offset = 0; Offset < Payload.size(); )
+            {
+                ssize_t Written;
+
+                Written = write(FD, &Payload[Offset], Payload.size() - Offset);
+                if(Written <= 0)
+                {
+                    break;
+                }
+
+                Offset += Written;
+            }
+        });
+
+        isValid = true;
+        Received = 0;
+        Start = Bench_GetCPUTime();
+        while(Received < Payload.size())
+        {
+            ReadLine(&Line);
+            if(Line.size() != (SIM70XX_BENCH_UART_LINE - 1))
+            {
+                isValid = false;
+
+                break;
+            }
+
+            Received += Line.size() + 1;
+        }
+        CPU += Bench_GetCPUTime() - Start;
+
+        Writer.join();
+
+        return isValid;
+    });
+
+    // Normalize the counters to one KB of received data.
+    Result.Counters.push_back({"locks_per_kb", (*p_Locks - Locks) * 1024.0 / ((double)Iterations * Payload.size())});
+    Result.Counters.push_back({"driver_calls_per_kb", (*p_Calls - Calls) * 1024.0 / ((double)Iterations * Payload.size())});
+    Result.Counters.push_back({"cpu_us_per_kb", CPU * 1024.0 / ((double)Iterations * Payload.size())});
+
+    return Result;
+}
+
+/** @brief  Compare the receive ring buffer with the per-byte receive path, which was used before.
+ *          The module side of a socket pair sends lines of SIM70XX_BENCH_UART_LINE bytes, which are read with SIM70XX_UART_ReadStringUntil.
+ *          Usage: sim70xx_bench_uart [-n iterations] [-o report.json]
+ *          NOTE: The receive path of the driver doesn´t take a lock. So the driver calls are the lock acquisitions in the UART driver of the ESP32.
+ *          NOTE: The host port emulates the transfer rate of the serial line. So the throughput is limited by the baud rate and the
+ *                CPU time per KB shows the cost of the receive path.
+ */
+int main(int argc, char** argv)
+{
+    int FD[2];
+    uint32_t Iterations = 20;
+    uint64_t NoLocks = 0;
+    std::string Report;
+    std::string Payload;
+    SIM70XX_UART_Conf_t Config;
+    std::vector<SIM70XX_Bench_Result_t> Results;
+
+    SIM70XX_Bench_ParseArgs(argc, argv, &Iterations, &Report);
+
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    while(Payload.size() < SIM70XX_BENCH_UART_LENGTH)
+    {
+        Payload += "+CHTTPNMIC: 0,1,16384,64,";
+        Payload.append(SIM70XX_BENCH_UART_LINE - 2 - (Payload.size() % SIM70XX_BENCH_UART_LINE), 'A');
+        Payload += "\r\n";
+    }
+
+    memset(&Config, 0, sizeof(Config));
+    Config.Interface = UART_NUM_1;
+    Config.Baudrate = SIM_BAUD_921600;
+
+    if((socketpair(AF_UNIX, SOCK_STREAM, 0, FD) != 0) || (SIM70XX_Tools_SetHostDevice(Config.Interface, FD[0]) != SIM70XX_ERR_OK) ||
+       (SIM70XX_UART_Init(Config) != SIM70XX_ERR_OK))
+    {
+        fprintf(stderr, "Can not open the interface!\n");
+
+        return EXIT_FAILURE;
+    }
+
+    _Lock = xSemaphoreCreateMutex();
+
+    Results.push_back(Bench_Receive("ReadStringUntil", Iterations, Config, FD[1], Payload, [&](std::string* p_Line) {
+        SIM70XX_UART_ReadStringUntil(Config, p_Line);
+    }, &NoLocks, &Config.RxCalls));
+    Results.push_back(Bench_Receive("ReadStringUntil_Legacy", Iterations, Config, FD[1], Payload, [&](std::string* p_Line) {
+        Bench_ReadLine_Legacy(Config, p_Line);
+    }, &_LegacyLocks, &_LegacyCalls));
+
+    vSemaphoreDelete(_Lock);
+    SIM70XX_UART_Deinit(Config);
+    SIM70XX_Tools_SetHostDevice(Config.Interface, -1);
+    close(FD[0]);
+    close(FD[1]);
+
+    return SIM70XX_Bench_Report("uart", Results, Report);
+}
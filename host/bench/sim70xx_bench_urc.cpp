@@ -0,0 +1,156 @@
+ /*
+ * sim70xx_bench_urc.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include "Private/Events/sim70xx_urc.h"
+
+#include "sim70xx_host_bench.h"
+
+/** @brief Number of dispatched messages per measured operation.
+ *         NOTE: A single message is dispatched in less than a microsecond. So a batch is measured to get usable timings.
+ */
+#define SIM70XX_BENCH_URC_BATCH                     1000
+
+/** @brief URC prefixes of the SIM7020 driver and the mailboxes, which fill the handler table.
+ */
+static const char* _Prefixes[CONFIG_SIM70XX_URC_COUNT] = {
+    "NORMAL POWER DOWN",
+    "ENTER PSM",
+    "EXIT PSM",
+    "+CSOERR",
+    "+CSONMI",
+    "+CMQPUB",
+    "+CMQDISCON",
+    "+CHTTPERR",
+    "+CHTTPNMIH",
+    "+CHTTPNMIC",
+    "+CLMOBSERVE",
+    "+CLMREAD",
+    "+CLMWRITE",
+    "+CCOAPNMI",
+    "+CNBIOTDT",
+    "+CIPPING",
+};
+
+/** @brief Messages of the communication task. The last message of the list is the worst case for a linear search, the
+ *         response "OK" and the unknown URC are not handled.
+ */
+static const struct
+{
+    const char* p_Name;
+    std::string Message;
+    bool isHandled;
+} _Messages[] = {
+    {"CIPPING", "+CIPPING: 1,\"8.8.8.8\",1,51", true},
+    {"CMQPUB", "+CMQPUB: 0,\"test\",1,0,0,10,\"48656c6c6f\"", true},
+    {"CHTTPNMIC", "+CHTTPNMIC: 0,1,1024,512,4142434445464748494A4B4C4D4E4F50", true},
+    {"OK", "OK", false},
+    {"CSQ", "+CSQ: 20,0", false},
+};
+
+static uint32_t _Handled;
+
+/** @brief              Benchmark handler.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to message
+ */
+static void Bench_on_URC(void* p_Device, std::string* p_Message)
+{
+    _Handled++;
+}
+
+/** @brief              Dispatch a message with a chain of std::string::find calls, which was used before the handler table.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to message
+ *  @return             #true when the message was handled
+ */
+static bool Bench_Dispatch_Legacy(void* p_Device, std::string* p_Message)
+{
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_URC_COUNT; i++)
+    {
+        if(p_Message->find(_Prefixes[i]) != std::string::npos)
+        {
+            Bench_on_URC(p_Device, p_Message);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** @brief              Run a dispatch benchmark.
+ *  @param Name         Name of the benchmark
+ *  @param Iterations   Number of batches
+ *  @param Message      Dispatched message
+ *  @param isHandled    #true when the message must be handled
+ *  @param Dispatch     Dispatch function
+ *  @return             Benchmark result
+ */
+static SIM70XX_Bench_Result_t Bench_Dispatch(std::string Name, uint32_t Iterations, std::string Message, bool isHandled,
+                                             bool (*Dispatch)(void*, std::string*))
+{
+    return SIM70XX_Bench_Run(Name, Iterations, SIM70XX_BENCH_URC_BATCH * Message.size(), [&]() {
+        _Handled = 0;
+
+        for(uint32_t i = 0; i < SIM70XX_BENCH_URC_BATCH; i++)
+        {
+            if(Dispatch(NULL, &Message) != isHandled)
+            {
+                return false;
+            }
+        }
+
+        return _Handled == (isHandled ? SIM70XX_BENCH_URC_BATCH : 0);
+    });
+}
+
+/** @brief  Compare the URC handler table with the chained string search, which was used before.
+ *          Usage: sim70xx_bench_urc [-n iterations] [-o report.json]
+ *          NOTE: Each iteration dispatches a batch of SIM70XX_BENCH_URC_BATCH messages. The throughput is in batches per second.
+ */
+int main(int argc, char** argv)
+{
+    uint32_t Iterations = 100;
+    std::string Report;
+    std::vector<SIM70XX_Bench_Result_t> Results;
+
+    SIM70XX_Bench_ParseArgs(argc, argv, &Iterations, &Report);
+
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_URC_COUNT; i++)
+    {
+        if(SIM70XX_URC_Register(_Prefixes[i], Bench_on_URC) != SIM70XX_ERR_OK)
+        {
+            fprintf(stderr, "Can not register URC %s!\n", _Prefixes[i]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    for(const auto& Entry : _Messages)
+    {
+        Results.push_back(Bench_Dispatch(std::string(Entry.p_Name) + "_Table", Iterations, Entry.Message, Entry.isHandled, SIM70XX_URC_Dispatch));
+        Results.push_back(Bench_Dispatch(std::string(Entry.p_Name) + "_Legacy", Iterations, Entry.Message, Entry.isHandled, Bench_Dispatch_Legacy));
+    }
+
+    return SIM70XX_Bench_Report("urc", Results, Report);
+}
@@ -0,0 +1,305 @@
+ /*
+ * sim70xx_host_bench.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_HOST_BENCH_H_
+#define SIM70XX_HOST_BENCH_H_
+
+#include <time.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#include <new>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+/** @brief Benchmark result object definition.
+ */
+typedef struct
+{
+    std::string Name;                               /**< Name of the benchmark. */
+    uint32_t Iterations;                            /**< Number of measured operations. */
+    uint32_t Failed;                                /**< Number of failed operations. */
+    uint32_t Bytes;                                 /**< Payload bytes per operation. */
+    double P50;                                     /**< Median latency of an operation in us. */
+    double P99;                                     /**< 99th percentile of the latency of an operation in us. */
+    double Max;                                     /**< Maximum latency of an operation in us. */
+    double Throughput;                              /**< Operations per second. */
+    double Allocations;                             /**< Heap allocations per operation (all threads). */
+    size_t HeapPeak;                                /**< Heap high-water mark during the benchmark in bytes, relative to the start. */
+    std::vector<std::pair<std::string, double>> Counters;   /**< Additional counters of the benchmark, which are written into the report. */
+} SIM70XX_Bench_Result_t;
+
+/** @brief Heap counters of the benchmark program. The counters are updated by the replaced global allocation functions.
+ *         NOTE: Only allocations with new are counted. This covers all allocations of the driver and of the standard library.
+ */
+static std::atomic<uint64_t> _SIM70XX_Bench_Allocations(0);
+static std::atomic<size_t> _SIM70XX_Bench_HeapUsed(0);
+static std::atomic<size_t> _SIM70XX_Bench_HeapPeak(0);
+
+/** @brief          Count a heap allocation and update the high-water mark.
+ *  @param p_Ptr    Pointer to allocated memory
+ */
+static void SIM70XX_Bench_CountAlloc(void* p_Ptr)
+{
+    size_t Used;
+
+    if(p_Ptr == NULL)
+    {
+        return;
+    }
+
+    _SIM70XX_Bench_Allocations++;
+    Used = (_SIM70XX_Bench_HeapUsed += malloc_usable_size(p_Ptr));
+
+    size_t Peak = _SIM70XX_Bench_HeapPeak;
+    while((Used > Peak) && !_SIM70XX_Bench_HeapPeak.compare_exchange_weak(Peak, Used))
+    {
+    }
+}
+
+// NOTE: The global allocation functions are replaced. Include this header only once per program.
+void* operator new(size_t Size)
+{
+    void* p_Ptr = malloc(Size ? Size : 1);
+
+    if(p_Ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    SIM70XX_Bench_CountAlloc(p_Ptr);
+
+    return p_Ptr;
+}
+
+void* operator new[](size_t Size)
+{
+    return operator new(Size);
+}
+
+void* operator new(size_t Size, const std::nothrow_t&) noexcept
+{
+    void* p_Ptr = malloc(Size ? Size : 1);
+
+    SIM70XX_Bench_CountAlloc(p_Ptr);
+
+    return p_Ptr;
+}
+
+void* operator new[](size_t Size, const std::nothrow_t& Tag) noexcept
+{
+    return operator new(Size, Tag);
+}
+
+void operator delete(void* p_Ptr) noexcept
+{
+    if(p_Ptr != NULL)
+    {
+        _SIM70XX_Bench_HeapUsed -= malloc_usable_size(p_Ptr);
+        free(p_Ptr);
+    }
+}
+
+void operator delete[](void* p_Ptr) noexcept
+{
+    operator delete(p_Ptr);
+}
+
+void operator delete(void* p_Ptr, size_t) noexcept
+{
+    operator delete(p_Ptr);
+}
+
+void operator delete[](void* p_Ptr, size_t) noexcept
+{
+    operator delete(p_Ptr);
+}
+
+/** @brief  Get the time of a monotonic clock.
+ *  @return Time in us
+ */
+static inline double SIM70XX_Bench_GetTime(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return (Now.tv_sec * 1000000.0) + (Now.tv_nsec / 1000.0);
+}
+
+/** @brief              Get a percentile of the sorted samples.
+ *  @param Samples      Sorted samples
+ *  @param Percent      Percentile
+ *  @return             Value of the percentile
+ */
+static inline double SIM70XX_Bench_Percentile(const std::vector<double>& Samples, uint8_t Percent)
+{
+    size_t Index;
+
+    if(Samples.size() == 0)
+    {
+        return 0.0;
+    }
+
+    Index = (Samples.size() * Percent + 99) / 100;
+
+    return Samples[(Index > 0) ? (Index - 1) : 0];
+}
+
+/** @brief              Measure an operation. Each call of the operation is timed separately.
+ *  @param Name         Name of the benchmark
+ *  @param Iterations   Number of operations
+ *  @param Bytes        Payload bytes per operation
+ *  @param Operation    Operation. It returns #false when the operation has failed
+ *  @param Prepare      (Optional) Untimed preparation before each operation
+ *  @return             Benchmark result
+ */
+static inline SIM70XX_Bench_Result_t SIM70XX_Bench_Run(std::string Name, uint32_t Iterations, uint32_t Bytes, std::function<bool(void)> Operation,
+                                                       std::function<void(void)> Prepare = NULL)
+{
+    double Total;
+    uint64_t Allocations;
+    size_t HeapStart;
+    std::vector<double> Samples;
+    SIM70XX_Bench_Result_t Result;
+
+    Result.Name = Name;
+    Result.Iterations = Iterations;
+    Result.Failed = 0;
+    Result.Bytes = Bytes;
+    Samples.reserve(Iterations);
+
+    Total = 0.0;
+    Allocations = 0;
+    HeapStart = _SIM70XX_Bench_HeapUsed;
+    _SIM70XX_Bench_HeapPeak = HeapStart;
+    for(uint32_t i = 0; i < Iterations; i++)
+    {
+        double Start;
+        uint64_t Count;
+
+        if(Prepare)
+        {
+            Prepare();
+        }
+
+        Count = _SIM70XX_Bench_Allocations;
+        Start = SIM70XX_Bench_GetTime();
+        if(Operation() == false)
+        {
+            Result.Failed++;
+        }
+        Samples.push_back(SIM70XX_Bench_GetTime() - Start);
+        Allocations += _SIM70XX_Bench_Allocations - Count;
+        Total += Samples.back();
+    }
+
+    std::sort(Samples.begin(), Samples.end());
+    Result.P50 = SIM70XX_Bench_Percentile(Samples, 50);
+    Result.P99 = SIM70XX_Bench_Percentile(Samples, 99);
+    Result.Max = Samples.size() ? Samples.back() : 0.0;
+    Result.Throughput = (Total > 0.0) ? (Iterations * 1000000.0 / Total) : 0.0;
+    Result.Allocations = Iterations ? ((double)Allocations / Iterations) : 0.0;
+    Result.HeapPeak = (_SIM70XX_Bench_HeapPeak > HeapStart) ? (_SIM70XX_Bench_HeapPeak - HeapStart) : 0;
+
+    return Result;
+}
+
+/** @brief              Parse the command line of a benchmark program.
+ *                      Usage: <program> [-n iterations] [-o report.json] [simulator options...]
+ *  @param argc         Number of arguments
+ *  @param argv         Arguments
+ *  @param p_Iterations Pointer to number of iterations
+ *  @param p_Report     Pointer to path of the report. Empty when the report is printed to stdout
+ *  @param p_Args       (Optional) Pointer to remaining arguments
+ */
+static inline void SIM70XX_Bench_ParseArgs(int argc, char** argv, uint32_t* p_Iterations, std::string* p_Report, std::vector<std::string>* p_Args = NULL)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        if((strcmp(argv[i], "-n") == 0) && ((i + 1) < argc))
+        {
+            *p_Iterations = strtoul(argv[++i], NULL, 10);
+        }
+        else if((strcmp(argv[i], "-o") == 0) && ((i + 1) < argc))
+        {
+            *p_Report = argv[++i];
+        }
+        else if(p_Args != NULL)
+        {
+            p_Args->push_back(argv[i]);
+        }
+    }
+}
+
+/** @brief              Write the benchmark report as JSON.
+ *  @param Suite        Name of the benchmark suite
+ *  @param Results      Benchmark results
+ *  @param Report       Path of the report. The report is printed to stdout when the path is empty
+ *  @return             #EXIT_SUCCESS when all operations were successful
+ */
+static inline int SIM70XX_Bench_Report(std::string Suite, const std::vector<SIM70XX_Bench_Result_t>& Results, std::string Report)
+{
+    FILE* File;
+    bool isFailed;
+
+    File = Report.empty() ? stdout : fopen(Report.c_str(), "w");
+    if(File == NULL)
+    {
+        perror(Report.c_str());
+
+        return EXIT_FAILURE;
+    }
+
+    isFailed = false;
+    fprintf(File, "{\n    \"suite\": \"%s\",\n    \"results\": [\n", Suite.c_str());
+    for(size_t i = 0; i < Results.size(); i++)
+    {
+        const SIM70XX_Bench_Result_t& Result = Results[i];
+
+        fprintf(File, "        {\"name\": \"%s\", \"iterations\": %u, \"failed\": %u, \"p50_us\": %.3f, \"p99_us\": %.3f, \"max_us\": %.3f, "
+                      "\"ops_per_s\": %.1f, \"bytes_per_s\": %.1f, \"allocations_per_op\": %.2f, \"heap_peak_bytes\": %zu",
+                Result.Name.c_str(), Result.Iterations, Result.Failed, Result.P50, Result.P99, Result.Max,
+                Result.Throughput, Result.Throughput * Result.Bytes, Result.Allocations, Result.HeapPeak);
+        for(const auto& Counter : Result.Counters)
+        {
+            fprintf(File, ", \"%s\": %.2f", Counter.first.c_str(), Counter.second);
+        }
+        fprintf(File, "}%s\n", (i + 1) < Results.size() ? "," : "");
+
+        isFailed |= (Result.Failed != 0);
+    }
+    fprintf(File, "    ]\n}\n");
+
+    if(File != stdout)
+    {
+        fclose(File);
+    }
+
+    return isFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#endif /* SIM70XX_HOST_BENCH_H_ */
@@ -0,0 +1,55 @@
+/* Configuration of the SIM7080 host build. The values are matching the defaults from the Kconfig file. */
+
+#ifndef SDKCONFIG_H_
+#define SDKCONFIG_H_
+
+#define CONFIG_IDF_TARGET_LINUX                     1
+
+#define CONFIG_SIM70XX_DEV_SIM7080                  1
+#define CONFIG_SIMXX_DEV                            7080
+
+#define CONFIG_SIM70XX_DRIVER_WITH_COAP             1
+#define CONFIG_SIM70XX_DRIVER_WITH_MQTT             1
+#define CONFIG_SIM70XX_DRIVER_WITH_HTTP             1
+#define CONFIG_SIM70XX_DRIVER_WITH_TCPIP            1
+#define CONFIG_SIM70XX_DRIVER_WITH_NTP              1
+#define CONFIG_SIM70XX_DRIVER_WITH_DNS              1
+#define CONFIG_SIM70XX_DRIVER_WITH_FS               1
+#define CONFIG_SIM70XX_DRIVER_WITH_EMAIL            1
+#define CONFIG_SIM70XX_DRIVER_WITH_SSL              1
+
+#define CONFIG_SIM70XX_TASK_COM_PRIO                12
+#define CONFIG_SIM70XX_TASK_COM_STACK               4096
+#define CONFIG_SIM70XX_QUEUE_LENGTH                 16
+#define CONFIG_SIM70XX_QUEUE_BULK_LENGTH            4
+#define CONFIG_SIM70XX_CMD_POOL_SIZE                16
+#define CONFIG_SIM70XX_CMD_COMMAND_LENGTH           128
+#define CONFIG_SIM70XX_CMD_RESPONSE_LENGTH          256
+#define CONFIG_SIM70XX_CMD_STALE_TIMEOUT            1000
+#define CONFIG_SIM70XX_CMD_QUEUE_TIMEOUT            10000
+#define CONFIG_SIM70XX_URC_COUNT                    16
+#define CONFIG_SIM70XX_MAILBOX_COUNT                8
+#define CONFIG_SIM70XX_MAILBOX_DEPTH                4
+#define CONFIG_SIM70XX_MAILBOX_EVENT_LENGTH         128
+#define CONFIG_SIM70XX_HTTP_POOL_SIZE               2
+#define CONFIG_SIM70XX_HTTP_POOL_IDLE_TIMEOUT       60
+
+#define CONFIG_SIM70XX_UART_BUFFER_SIZE             256
+#define CONFIG_SIM70XX_UART_LINE_SIZE               4096
+#define CONFIG_SIM70XX_UART_RX_BUFFER_SIZE          512
+#define CONFIG_SIM70XX_UART_TX_BUFFER_SIZE          1024
+#define CONFIG_SIM70XX_UART_FLOW_THRESH             100
+#define CONFIG_SIM70XX_AUTOBAUD_MAX                 921600
+#define CONFIG_SIM70XX_AUTOBAUD_CYCLES              10
+#define CONFIG_SIM70XX_PORT_POSIX_DEVICE            "/dev/ttyUSB%d"
+#define CONFIG_SIM70XX_PORT_POSIX_EMULATE_BAUDRATE  1
+
+#define CONFIG_SIM70XX_GPIO_PWRKEY_PIN              25
+#define CONFIG_SIM70XX_GPIO_PWRKEY_INVERT           1
+
+#define CONFIG_SIM70XX_DEBUG_VERBOSE                1
+#define CONFIG_SIM70XX_TRACE_DEPTH                  256
+
+#define CONFIG_SIM70XX_MISC_ERROR_BASE              0x9000
+
+#endif /* SDKCONFIG_H_ */
@@ -0,0 +1,64 @@
+ /*
+ * esp_log.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef ESP_LOG_H_
+#define ESP_LOG_H_
+
+#include <stdint.h>
+
+/** @brief Log level definitions.
+ */
+typedef enum
+{
+    ESP_LOG_NONE = 0,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+/** @brief          Set the log level.
+ *                  NOTE: The host implementation supports only the global log level "*".
+ *  @param p_Tag    Log tag
+ *  @param Level    Log level
+ */
+void esp_log_level_set(const char* p_Tag, esp_log_level_t Level);
+
+/** @brief          Write a log message to stderr when the level is enabled.
+ *  @param Level    Log level
+ *  @param p_Tag    Log tag
+ *  @param p_Format Format string
+ */
+void esp_log_write(esp_log_level_t Level, const char* p_Tag, const char* p_Format, ...) __attribute__((format(printf, 3, 4)));
+
+/** @brief  Get the milliseconds since the start of the application.
+ *  @return Timestamp
+ */
+uint32_t esp_log_timestamp(void);
+
+#define ESP_LOG_LEVEL_LOCAL(Level, Letter, Tag, Format, ...)    esp_log_write(Level, Tag, Letter " (%u) %s: " Format "\n", (unsigned int)esp_log_timestamp(), Tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(Tag, Format, ...)                  ESP_LOG_LEVEL_LOCAL(ESP_LOG_ERROR, "E", Tag, Format, ##__VA_ARGS__)
+#define ESP_LOGW(Tag, Format, ...)                  ESP_LOG_LEVEL_LOCAL(ESP_LOG_WARN, "W", Tag, Format, ##__VA_ARGS__)
+#define ESP_LOGI(Tag, Format, ...)                  ESP_LOG_LEVEL_LOCAL(ESP_LOG_INFO, "I", Tag, Format, ##__VA_ARGS__)
+#define ESP_LOGD(Tag, Format, ...)                  ESP_LOG_LEVEL_LOCAL(ESP_LOG_DEBUG, "D", Tag, Format, ##__VA_ARGS__)
+#define ESP_LOGV(Tag, Format, ...)                  ESP_LOG_LEVEL_LOCAL(ESP_LOG_VERBOSE, "V", Tag, Format, ##__VA_ARGS__)
+
+#endif /* ESP_LOG_H_ */
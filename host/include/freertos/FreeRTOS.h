@@ -0,0 +1,84 @@
+ /*
+ * FreeRTOS.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+/** @brief Host implementation of the FreeRTOS API, which is used by the driver. All tasks are running as POSIX threads and
+ *         the queues and semaphores are implemented with mutexes and condition variables.
+ *         NOTE: Only the subset of the API, which is used by the driver, is implemented.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+
+// NOTE: The FreeRTOS header of ESP-IDF includes the project configuration. The driver headers rely on this.
+#if __has_include(<sdkconfig.h>)
+    #include <sdkconfig.h>
+#endif
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t StackType_t;
+
+#define configTICK_RATE_HZ                          1000
+#define portTICK_PERIOD_MS                          (1000 / configTICK_RATE_HZ)
+#define portTICK_RATE_MS                            portTICK_PERIOD_MS
+#define portMAX_DELAY                               ((TickType_t)0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(Time)                         ((TickType_t)((Time) * configTICK_RATE_HZ / 1000))
+
+#define pdFALSE                                     0
+#define pdTRUE                                      1
+#define pdFAIL                                      pdFALSE
+#define pdPASS                                      pdTRUE
+
+#define tskIDLE_PRIORITY                            0
+#define configMAX_PRIORITIES                        25
+
+#define configASSERT(Condition)                     do {} while(0)
+
+/** @brief Critical section object. The critical section is a recursive mutex on the host.
+ */
+typedef struct
+{
+    pthread_mutex_t Mutex;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED                 {PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP}
+
+/** @brief          Enter a critical section.
+ *  @param p_Mux    Pointer to critical section object
+ */
+void vPortEnterCritical(portMUX_TYPE* p_Mux);
+
+/** @brief          Leave a critical section.
+ *  @param p_Mux    Pointer to critical section object
+ */
+void vPortExitCritical(portMUX_TYPE* p_Mux);
+
+#define portENTER_CRITICAL(Mux)                     vPortEnterCritical(Mux)
+#define portEXIT_CRITICAL(Mux)                      vPortExitCritical(Mux)
+#define portENTER_CRITICAL_ISR(Mux)                 vPortEnterCritical(Mux)
+#define portEXIT_CRITICAL_ISR(Mux)                  vPortExitCritical(Mux)
+#define taskENTER_CRITICAL(Mux)                     vPortEnterCritical(Mux)
+#define taskEXIT_CRITICAL(Mux)                      vPortExitCritical(Mux)
+
+#endif /* FREERTOS_H_ */
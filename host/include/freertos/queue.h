@@ -0,0 +1,47 @@
+ /*
+ * queue.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+#include "FreeRTOS.h"
+
+typedef struct QueueDefinition* QueueHandle_t;
+typedef struct QueueDefinition* QueueSetHandle_t;
+typedef struct QueueDefinition* QueueSetMemberHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t Length, UBaseType_t ItemSize);
+void vQueueDelete(QueueHandle_t Queue);
+BaseType_t xQueueSend(QueueHandle_t Queue, const void* p_Item, TickType_t Ticks);
+BaseType_t xQueueSendToBack(QueueHandle_t Queue, const void* p_Item, TickType_t Ticks);
+BaseType_t xQueueSendToFront(QueueHandle_t Queue, const void* p_Item, TickType_t Ticks);
+BaseType_t xQueueReceive(QueueHandle_t Queue, void* p_Item, TickType_t Ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t Queue);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t Queue);
+BaseType_t xQueueReset(QueueHandle_t Queue);
+
+/** @brief              Create a queue set. The set receives the handle of a member queue for each item, which is written into the member.
+ *  @param Length       Total length of all member queues
+ *  @return             Queue set handle or #NULL
+ */
+QueueSetHandle_t xQueueCreateSet(UBaseType_t Length);
+BaseType_t xQueueAddToSet(QueueSetMemberHandle_t Member, QueueSetHandle_t Set);
+QueueSetMemberHandle_t xQueueSelectFromSet(QueueSetHandle_t Set, TickType_t Ticks);
+
+#endif /* QUEUE_H_ */
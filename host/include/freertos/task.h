@@ -0,0 +1,76 @@
+ /*
+ * task.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "FreeRTOS.h"
+
+typedef struct tskTaskControlBlock* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+/** @brief              Create a new task. The task is running as POSIX thread.
+ *                      NOTE: The stack depth and the priority are ignored on the host.
+ *  @param Function     Task function
+ *  @param p_Name       Task name
+ *  @param StackDepth   Stack depth
+ *  @param p_Arg        Task parameter
+ *  @param Priority     Task priority
+ *  @param p_Handle     (Optional) Pointer to task handle
+ *  @return             pdPASS when successful
+ */
+BaseType_t xTaskCreate(TaskFunction_t Function, const char* p_Name, uint32_t StackDepth, void* p_Arg, UBaseType_t Priority, TaskHandle_t* p_Handle);
+
+/** @brief              Create a new task. The core affinity is ignored on the host.
+ */
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t Function, const char* p_Name, uint32_t StackDepth, void* p_Arg, UBaseType_t Priority, TaskHandle_t* p_Handle, BaseType_t Core);
+
+/** @brief          Delete a task. The calling task is deleted when the handle is #NULL.
+ *                  NOTE: A deleted task leaves its task function at the next call of a FreeRTOS function. The function returns
+ *                        when the task has stopped.
+ *  @param Handle   Task handle
+ */
+void vTaskDelete(TaskHandle_t Handle);
+
+/** @brief          Suspend a task. The task is stopped at the next call of a FreeRTOS function.
+ *  @param Handle   Task handle
+ */
+void vTaskSuspend(TaskHandle_t Handle);
+
+/** @brief          Resume a suspended task.
+ *  @param Handle   Task handle
+ */
+void vTaskResume(TaskHandle_t Handle);
+
+/** @brief          Block the calling task.
+ *  @param Ticks    Number of ticks
+ */
+void vTaskDelay(TickType_t Ticks);
+
+/** @brief  Get the number of ticks since the start of the application.
+ *  @return Tick count
+ */
+TickType_t xTaskGetTickCount(void);
+
+/** @brief  Get the handle of the calling task.
+ *  @return Task handle or #NULL when the function isn´t called by a task
+ */
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+#endif /* TASK_H_ */
@@ -0,0 +1,531 @@
+ /*
+ * sim70xx_host_freertos.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+#include <string.h>
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <condition_variable>
+
+/** @brief Maximum time in milliseconds a blocked task waits before it checks if it was deleted or suspended.
+ */
+#define SIM70XX_HOST_POLL_MS                        10
+
+/** @brief Task object definition.
+ */
+struct tskTaskControlBlock
+{
+    std::string Name;                               /**< Task name. */
+    TaskFunction_t Function;                        /**< Task function. */
+    void* p_Arg;                                    /**< Task parameter. */
+    std::atomic<bool> isDeleted;                    /**< #true when the task was deleted by another task. */
+    std::atomic<bool> isSuspended;                  /**< #true when the task was suspended by another task. */
+    std::mutex Lock;                                /**< Lock for the finished state. */
+    std::condition_variable Finished;               /**< Signaled when the task function has returned. */
+    bool isFinished;                                /**< #true when the task function has returned. */
+};
+
+/** @brief Queue object definition. Semaphores are queues with an item size of zero.
+ */
+struct QueueDefinition
+{
+    std::mutex Lock;                                /**< Queue lock. */
+    std::condition_variable Changed;                /**< Signaled when an item was added or removed. */
+    std::vector<uint8_t> Storage;                   /**< Item memory. */
+    UBaseType_t Length;                             /**< Maximum number of items. */
+    UBaseType_t ItemSize;                           /**< Size of an item in bytes. */
+    UBaseType_t Head;                               /**< Index of the first item. */
+    UBaseType_t Count;                              /**< Number of items. */
+    QueueDefinition* p_Set;                         /**< Queue set of the queue or #NULL. */
+};
+
+/** @brief Exception which is used to leave the function of a deleted task.
+ */
+struct SIM70XX_Host_TaskExit
+{
+};
+
+static thread_local tskTaskControlBlock* _SIM70XX_Host_Current = NULL;
+static const std::chrono::steady_clock::time_point _SIM70XX_Host_Start = std::chrono::steady_clock::now();
+
+/** @brief  Leave the current task when it was deleted and block it while it is suspended.
+ *          NOTE: Called by every blocking function, so a deleted task stops at the next call of a FreeRTOS function.
+ */
+static void SIM70XX_Host_CheckTask(void)
+{
+    tskTaskControlBlock* Task = _SIM70XX_Host_Current;
+
+    if(Task == NULL)
+    {
+        return;
+    }
+
+    while(Task->isSuspended && (Task->isDeleted == false))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(SIM70XX_HOST_POLL_MS));
+    }
+
+    if(Task->isDeleted)
+    {
+        throw SIM70XX_Host_TaskExit();
+    }
+}
+
+/** @brief          Convert a number of ticks into an absolute time.
+ *  @param Ticks    Number of ticks
+ *  @return         Absolute time
+ */
+static std::chrono::steady_clock::time_point SIM70XX_Host_GetDeadline(TickType_t Ticks)
+{
+    if(Ticks == portMAX_DELAY)
+    {
+        return std::chrono::steady_clock::time_point::max();
+    }
+
+    return std::chrono::steady_clock::now() + std::chrono::milliseconds(Ticks * portTICK_PERIOD_MS);
+}
+
+/** @brief              Wait for a condition of a queue.
+ *                      NOTE: The wait is split into short slices, so a deleted task can leave the wait.
+ *  @param p_Queue      Pointer to queue object
+ *  @param Guard        Locked queue lock
+ *  @param Deadline     Absolute timeout
+ *  @param Condition    Condition to wait for
+ *  @return             #true when the condition is true
+ */
+template<typename Predicate>
+static bool SIM70XX_Host_Wait(QueueDefinition* p_Queue, std::unique_lock<std::mutex>& Guard, std::chrono::steady_clock::time_point Deadline, Predicate Condition)
+{
+    while(Condition() == false)
+    {
+        std::chrono::steady_clock::time_point Now;
+
+        Now = std::chrono::steady_clock::now();
+        if(Now >= Deadline)
+        {
+            return false;
+        }
+
+        Guard.unlock();
+        SIM70XX_Host_CheckTask();
+        Guard.lock();
+
+        p_Queue->Changed.wait_until(Guard, std::min(Deadline, Now + std::chrono::milliseconds(SIM70XX_HOST_POLL_MS)));
+    }
+
+    return true;
+}
+
+/** @brief              Create a queue object.
+ *  @param Length       Maximum number of items
+ *  @param ItemSize     Size of an item in bytes
+ *  @param Count        Initial number of items
+ *                      NOTE: Only used for semaphores.
+ *  @return             Queue object
+ */
+static QueueDefinition* SIM70XX_Host_CreateQueue(UBaseType_t Length, UBaseType_t ItemSize, UBaseType_t Count)
+{
+    QueueDefinition* Queue = new QueueDefinition();
+
+    Queue->Storage.resize(Length * ItemSize);
+    Queue->Length = Length;
+    Queue->ItemSize = ItemSize;
+    Queue->Head = 0;
+    Queue->Count = Count;
+    Queue->p_Set = NULL;
+
+    return Queue;
+}
+
+/** @brief          Write an item into a queue and notify the queue set of the queue.
+ *  @param Queue    Queue handle
+ *  @param p_Item   Pointer to item
+ *  @param Ticks    Number of ticks to wait for a free entry
+ *  @param isFront  #true to write the item to the front of the queue
+ *  @return         pdPASS when successful
+ */
+static BaseType_t SIM70XX_Host_Send(QueueHandle_t Queue, const void* p_Item, TickType_t Ticks, bool isFront)
+{
+    QueueDefinition* Set;
+
+    if(Queue == NULL)
+    {
+        return pdFAIL;
+    }
+
+    {
+        std::unique_lock<std::mutex> Guard(Queue->Lock);
+        UBaseType_t Index;
+
+        if(SIM70XX_Host_Wait(Queue, Guard, SIM70XX_Host_GetDeadline(Ticks), [Queue]() { return Queue->Count < Queue->Length; }) == false)
+        {
+            return pdFAIL;
+        }
+
+        if(isFront)
+        {
+            Queue->Head = (Queue->Head + Queue->Length - 1) % Queue->Length;
+            Index = Queue->Head;
+        }
+        else
+        {
+            Index = (Queue->Head + Queue->Count) % Queue->Length;
+        }
+
+        if(Queue->ItemSize > 0)
+        {
+            memcpy(&Queue->Storage[Index * Queue->ItemSize], p_Item, Queue->ItemSize);
+        }
+
+        Queue->Count++;
+        Set = Queue->p_Set;
+        Queue->Changed.notify_all();
+    }
+
+    // NOTE: The queue set has room for each item of all members.
+    if(Set != NULL)
+    {
+        SIM70XX_Host_Send(Set, &Queue, 0, false);
+    }
+
+    return pdPASS;
+}
+
+void vPortEnterCritical(portMUX_TYPE* p_Mux)
+{
+    pthread_mutex_lock(&p_Mux->Mutex);
+}
+
+void vPortExitCritical(portMUX_TYPE* p_Mux)
+{
+    pthread_mutex_unlock(&p_Mux->Mutex);
+}
+
+/** @brief          Entry point of a task thread.
+ *  @param p_Arg    Pointer to task object
+ *  @return         #NULL
+ */
+static void* SIM70XX_Host_TaskEntry(void* p_Arg)
+{
+    tskTaskControlBlock* Task = (tskTaskControlBlock*)p_Arg;
+
+    _SIM70XX_Host_Current = Task;
+
+    try
+    {
+        Task->Function(Task->p_Arg);
+    }
+    catch(const SIM70XX_Host_TaskExit&)
+    {
+    }
+
+    {
+        std::lock_guard<std::mutex> Guard(Task->Lock);
+
+        Task->isFinished = true;
+        Task->Finished.notify_all();
+    }
+
+    // NOTE: The task object is not deleted, because other tasks may still use the handle.
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t Function, const char* p_Name, uint32_t StackDepth, void* p_Arg, UBaseType_t Priority, TaskHandle_t* p_Handle)
+{
+    pthread_t Thread;
+    tskTaskControlBlock* Task = new tskTaskControlBlock();
+
+    Task->Name = (p_Name != NULL) ? p_Name : "";
+    Task->Function = Function;
+    Task->p_Arg = p_Arg;
+    Task->isDeleted = false;
+    Task->isSuspended = false;
+    Task->isFinished = false;
+
+    // NOTE: The handle must be valid before the task starts, because some tasks are using their own handle.
+    if(p_Handle != NULL)
+    {
+        *p_Handle = Task;
+    }
+
+    if(pthread_create(&Thread, NULL, SIM70XX_Host_TaskEntry, Task) != 0)
+    {
+        if(p_Handle != NULL)
+        {
+            *p_Handle = NULL;
+        }
+
+        delete Task;
+
+        return pdFAIL;
+    }
+
+    pthread_detach(Thread);
+
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t Function, const char* p_Name, uint32_t StackDepth, void* p_Arg, UBaseType_t Priority, TaskHandle_t* p_Handle, BaseType_t Core)
+{
+    return xTaskCreate(Function, p_Name, StackDepth, p_Arg, Priority, p_Handle);
+}
+
+void vTaskDelete(TaskHandle_t Handle)
+{
+    if((Handle == NULL) || (Handle == _SIM70XX_Host_Current))
+    {
+        if(_SIM70XX_Host_Current != NULL)
+        {
+            throw SIM70XX_Host_TaskExit();
+        }
+
+        return;
+    }
+
+    // Wait until the task has left the task function.
+    Handle->isDeleted = true;
+
+    std::unique_lock<std::mutex> Guard(Handle->Lock);
+    Handle->Finished.wait(Guard, [Handle]() { return Handle->isFinished; });
+}
+
+void vTaskSuspend(TaskHandle_t Handle)
+{
+    if(Handle == NULL)
+    {
+        Handle = _SIM70XX_Host_Current;
+    }
+
+    if(Handle != NULL)
+    {
+        Handle->isSuspended = true;
+
+        if(Handle == _SIM70XX_Host_Current)
+        {
+            SIM70XX_Host_CheckTask();
+        }
+    }
+}
+
+void vTaskResume(TaskHandle_t Handle)
+{
+    if(Handle != NULL)
+    {
+        Handle->isSuspended = false;
+    }
+}
+
+void vTaskDelay(TickType_t Ticks)
+{
+    std::chrono::steady_clock::time_point Deadline = SIM70XX_Host_GetDeadline(Ticks);
+
+    SIM70XX_Host_CheckTask();
+
+    while(std::chrono::steady_clock::now() < Deadline)
+    {
+        std::this_thread::sleep_for(std::min(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::milliseconds(SIM70XX_HOST_POLL_MS)),
+                                             Deadline - std::chrono::steady_clock::now()));
+        SIM70XX_Host_CheckTask();
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _SIM70XX_Host_Start).count() / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return _SIM70XX_Host_Current;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t Length, UBaseType_t ItemSize)
+{
+    if(Length == 0)
+    {
+        return NULL;
+    }
+
+    return SIM70XX_Host_CreateQueue(Length, ItemSize, 0);
+}
+
+void vQueueDelete(QueueHandle_t Queue)
+{
+    delete Queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t Queue, const void* p_Item, TickType_t Ticks)
+{
+    return SIM70XX_Host_Send(Queue, p_Item, Ticks, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t Queue, const void* p_Item, TickType_t Ticks)
+{
+    return SIM70XX_Host_Send(Queue, p_Item, Ticks, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t Queue, const void* p_Item, TickType_t Ticks)
+{
+    return SIM70XX_Host_Send(Queue, p_Item, Ticks, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t Queue, void* p_Item, TickType_t Ticks)
+{
+    if(Queue == NULL)
+    {
+        return pdFAIL;
+    }
+
+    std::unique_lock<std::mutex> Guard(Queue->Lock);
+
+    if(SIM70XX_Host_Wait(Queue, Guard, SIM70XX_Host_GetDeadline(Ticks), [Queue]() { return Queue->Count > 0; }) == false)
+    {
+        return pdFAIL;
+    }
+
+    if((Queue->ItemSize > 0) && (p_Item != NULL))
+    {
+        memcpy(p_Item, &Queue->Storage[Queue->Head * Queue->ItemSize], Queue->ItemSize);
+    }
+
+    Queue->Head = (Queue->Head + 1) % Queue->Length;
+    Queue->Count--;
+    Queue->Changed.notify_all();
+
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t Queue)
+{
+    std::lock_guard<std::mutex> Guard(Queue->Lock);
+
+    return Queue->Count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t Queue)
+{
+    std::lock_guard<std::mutex> Guard(Queue->Lock);
+
+    return Queue->Length - Queue->Count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t Queue)
+{
+    if(Queue == NULL)
+    {
+        return pdFAIL;
+    }
+
+    std::lock_guard<std::mutex> Guard(Queue->Lock);
+
+    Queue->Head = 0;
+    Queue->Count = 0;
+    Queue->Changed.notify_all();
+
+    return pdPASS;
+}
+
+QueueSetHandle_t xQueueCreateSet(UBaseType_t Length)
+{
+    return xQueueCreate(Length, sizeof(QueueSetMemberHandle_t));
+}
+
+BaseType_t xQueueAddToSet(QueueSetMemberHandle_t Member, QueueSetHandle_t Set)
+{
+    if((Member == NULL) || (Set == NULL))
+    {
+        return pdFAIL;
+    }
+
+    std::lock_guard<std::mutex> Guard(Member->Lock);
+
+    // NOTE: Like FreeRTOS, only empty queues can be added to a set.
+    if((Member->p_Set != NULL) || (Member->Count > 0))
+    {
+        return pdFAIL;
+    }
+
+    Member->p_Set = Set;
+
+    return pdPASS;
+}
+
+QueueSetMemberHandle_t xQueueSelectFromSet(QueueSetHandle_t Set, TickType_t Ticks)
+{
+    QueueSetMemberHandle_t Member;
+
+    if(xQueueReceive(Set, &Member, Ticks) != pdPASS)
+    {
+        return NULL;
+    }
+
+    return Member;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return SIM70XX_Host_CreateQueue(1, 0, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* p_Buffer)
+{
+    if(p_Buffer == NULL)
+    {
+        return NULL;
+    }
+
+    p_Buffer->Handle = xSemaphoreCreateBinary();
+
+    return p_Buffer->Handle;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return SIM70XX_Host_CreateQueue(1, 0, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t Maximum, UBaseType_t Initial)
+{
+    return SIM70XX_Host_CreateQueue(Maximum, 0, Initial);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t Semaphore, TickType_t Ticks)
+{
+    return xQueueReceive(Semaphore, NULL, Ticks);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t Semaphore)
+{
+    return SIM70XX_Host_Send(Semaphore, NULL, 0, false);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t Semaphore)
+{
+    vQueueDelete(Semaphore);
+}
@@ -0,0 +1,57 @@
+ /*
+ * sim70xx_host_log.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include <chrono>
+#include <atomic>
+
+static std::atomic<esp_log_level_t> _SIM70XX_Host_LogLevel(ESP_LOG_INFO);
+static const std::chrono::steady_clock::time_point _SIM70XX_Host_LogStart = std::chrono::steady_clock::now();
+
+void esp_log_level_set(const char* p_Tag, esp_log_level_t Level)
+{
+    if((p_Tag != NULL) && (strcmp(p_Tag, "*") == 0))
+    {
+        _SIM70XX_Host_LogLevel = Level;
+    }
+}
+
+void esp_log_write(esp_log_level_t Level, const char* p_Tag, const char* p_Format, ...)
+{
+    va_list Arguments;
+
+    if(Level > _SIM70XX_Host_LogLevel)
+    {
+        return;
+    }
+
+    va_start(Arguments, p_Format);
+    vfprintf(stderr, p_Format, Arguments);
+    va_end(Arguments);
+}
+
+uint32_t esp_log_timestamp(void)
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _SIM70XX_Host_LogStart).count();
+}
@@ -0,0 +1,48 @@
+ /*
+ * sim70xx_host_check.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_HOST_CHECK_H_
+#define SIM70XX_HOST_CHECK_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/** @brief          Number of failed checks of the test program.
+ */
+static int _SIM70XX_Check_Failed = 0;
+
+/** @brief          Check a condition and report the location when it fails.
+ *  @param Cond     Condition
+ */
+#define SIM70XX_CHECK(Cond)                                                                     \
+    do                                                                                          \
+    {                                                                                           \
+        if(!(Cond))                                                                             \
+        {                                                                                       \
+            fprintf(stderr, "%s:%u: Check failed: %s\n", __FILE__, __LINE__, #Cond);           \
+            _SIM70XX_Check_Failed++;                                                            \
+        }                                                                                       \
+    } while(0)
+
+/** @brief          Get the exit code of the test program.
+ *  @return         #EXIT_SUCCESS when all checks passed
+ */
+#define SIM70XX_CHECK_RESULT()      ((_SIM70XX_Check_Failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE)
+
+#endif /* SIM70XX_HOST_CHECK_H_ */
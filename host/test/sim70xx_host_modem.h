@@ -0,0 +1,108 @@
+ /*
+ * sim70xx_host_modem.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_HOST_MODEM_H_
+#define SIM70XX_HOST_MODEM_H_
+
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+
+#include <string>
+#include <vector>
+
+#include "sim70xx_tools.h"
+
+/** @brief Simulated modem object definition.
+ */
+typedef struct
+{
+    pid_t PID;                                      /**< Process ID of the simulator. */
+    int FD;                                         /**< File descriptor of the driver side. */
+    uart_port_t Interface;                          /**< Serial interface of the driver. */
+} SIM70XX_Host_Modem_t;
+
+/** @brief              Start the modem simulator tools/sim70xx_modem.py and connect it over a socket pair with a serial interface of the driver.
+ *                      NOTE: The path of the simulator and of the Python interpreter are set by the build system.
+ *  @param p_Modem      Pointer to simulated modem object
+ *  @param Interface    Serial interface of the driver
+ *  @param Args         Additional arguments for the simulator (i.e. "--device", "SIM7080")
+ *  @return             #true when successful
+ */
+inline bool SIM70XX_Host_StartModem(SIM70XX_Host_Modem_t* p_Modem, uart_port_t Interface, std::vector<std::string> Args)
+{
+    int FD[2];
+    std::vector<char*> Argv;
+
+    if(socketpair(AF_UNIX, SOCK_STREAM, 0, FD) != 0)
+    {
+        return false;
+    }
+
+    Args.insert(Args.begin(), {SIM70XX_HOST_PYTHON, SIM70XX_HOST_MODEM, "--fd", std::to_string(FD[1])});
+
+    // Print the traffic of the simulator for debugging.
+    if(getenv("SIM70XX_HOST_MODEM_VERBOSE") != NULL)
+    {
+        Args.push_back("--verbose");
+    }
+    for(std::string& Arg : Args)
+    {
+        Argv.push_back(&Arg[0]);
+    }
+    Argv.push_back(NULL);
+
+    p_Modem->PID = fork();
+    if(p_Modem->PID == 0)
+    {
+        close(FD[0]);
+        execv(Argv[0], Argv.data());
+        _exit(127);
+    }
+
+    close(FD[1]);
+
+    if(p_Modem->PID < 0)
+    {
+        close(FD[0]);
+
+        return false;
+    }
+
+    p_Modem->FD = FD[0];
+    p_Modem->Interface = Interface;
+
+    return SIM70XX_Tools_SetHostDevice(Interface, FD[0]) == SIM70XX_ERR_OK;
+}
+
+/** @brief          Stop the modem simulator.
+ *                  NOTE: The driver must be deinitialized first.
+ *  @param p_Modem  Pointer to simulated modem object
+ */
+inline void SIM70XX_Host_StopModem(SIM70XX_Host_Modem_t* p_Modem)
+{
+    SIM70XX_Tools_SetHostDevice(p_Modem->Interface, -1);
+    close(p_Modem->FD);
+    kill(p_Modem->PID, SIGTERM);
+    waitpid(p_Modem->PID, NULL, 0);
+}
+
+#endif /* SIM70XX_HOST_MODEM_H_ */
@@ -0,0 +1,261 @@
+ /*
+ * sim70xx_test_builder.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <string.h>
+
+#include "Private/Commands/sim70xx_commands.h"
+
+#include "sim70xx_host_check.h"
+#include "sim70xx_test_legacy_commands.h"
+
+/** @brief          Compare a command definition with the legacy command macro.
+ *  @param New      Command definition
+ *  @param Old      Legacy command object
+ */
+#define SIM70XX_TEST_LEGACY(New, Old)                           Test_Compare(#New, New, Old)
+
+/** @brief              Compare the output of a command definition with a legacy command object.
+ *                      The command string must be the same byte for byte for the command object and for the fixed buffer.
+ *  @param p_Name       Name of the command
+ *  @param p_Definition Command definition
+ *  @param p_Legacy     Legacy command object
+ */
+template<bool HasData, uint32_t TimeOut, uint16_t Number, typename Formatter>
+static void Test_Compare(const char* p_Name, const SIM70XX_CmdDef_t<HasData, TimeOut, Number, Formatter>& p_Definition, const SIM70XX_Legacy_Cmd_t& p_Legacy)
+{
+    char Buffer[256];
+    size_t Length;
+    bool isEqual;
+    SIM70XX_TxCmd_t Command;
+
+    Command = p_Definition;
+    isEqual = (Command.Command == p_Legacy.Command) && (Command.recData == p_Legacy.recData) && (Command.Timeout == p_Legacy.Timeout) &&
+              (Command.Lines == p_Legacy.Lines);
+
+    isEqual &= (SIM70XX_Builder_Write(p_Definition, Buffer, sizeof(Buffer), &Length) == SIM70XX_ERR_OK) && (Length == p_Legacy.Command.size()) &&
+               (memcmp(Buffer, p_Legacy.Command.c_str(), Length + 1) == 0);
+
+    if(isEqual == false)
+    {
+        fprintf(stderr, "%s: \"%s\" (%u, %u, %u) != \"%s\" (%u, %u, %u)\n", p_Name, Command.Command.c_str(), Command.recData, Command.Timeout,
+                Command.Lines, p_Legacy.Command.c_str(), p_Legacy.recData, p_Legacy.Timeout, p_Legacy.Lines);
+    }
+
+    SIM70XX_CHECK(isEqual);
+}
+
+/** @brief          Compare all command macros with the legacy command macros.
+ *                  NOTE: Macros with a changed argument list are compared separately or are not part of the test, because the
+ *                  command layout was changed on purpose (i.e. raw data transfers).
+ *  @param Number   Value for all numeric arguments
+ *  @param String   Value for all string arguments
+ */
+template<typename T>
+static void Test_Legacy(T Number, const std::string& String)
+{
+    // Number as formatted by the legacy command strings.
+    const std::string NumberStr = std::to_string(Number);
+
+    SIM70XX_TEST_LEGACY(SIM70XX_AT, LEGACY_SIM70XX_AT);
+    SIM70XX_TEST_LEGACY(SIM70XX_AT_CBAND_W(Number), LEGACY_SIM70XX_AT_CBAND_W(Number));
+    SIM70XX_TEST_LEGACY(SIM70XX_AT_CFUN_R, LEGACY_SIM70XX_AT_CFUN_R);
+    SIM70XX_TEST_LEGACY(SIM70XX_AT_CFUN_W(Number, Number), LEGACY_SIM70XX_AT_CFUN_W(Number, Number));
+    SIM70XX_TEST_LEGACY(SIM70XX_AT_CBAND_R, LEGACY_SIM70XX_AT_CBAND_R);
+    SIM70XX_TEST_LEGACY(SIM70XX_AT_CGATT_R, LEGACY_SIM70XX_AT_CGATT_R);
+    SIM70XX_TEST_LEGACY(SIM70XX_AT_CPIN_R, LEGACY_SIM70XX_AT_CPIN_R);
+
+    #if(CONFIG_SIMXX_DEV == 7020)
+        // The baud rate command is a common command now.
+        SIM70XX_TEST_LEGACY(SIM70XX_AT_IPR_W(Number), LEGACY_SIM7020_AT_IPR_W(Number));
+
+        SIM70XX_TEST_LEGACY(SIM7020_AT_MCGDEFCONT("IPV6", String), LEGACY_SIM7020_AT_MCGDEFCONT("AT*MCGDEFCONT=\"IPV6\",\"" + String + "\""));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_MCGDEFCONT_AUTH("IP", String, String, String), LEGACY_SIM7020_AT_MCGDEFCONT("AT*MCGDEFCONT=\"IP\",\"" + String + "\"" + ",\"" + String + "\",\"" + String + "\""));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_COPS_W(Number), LEGACY_SIM7020_AT_COPS_W("AT+COPS=" + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_COPS_W_OPERATOR(Number, Number, String, Number), LEGACY_SIM7020_AT_COPS_W("AT+COPS=" + NumberStr + "," + NumberStr + ",\"" + String + "\"" + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_COPS_R, LEGACY_SIM7020_AT_COPS_R);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGACT_W(Number, Number), LEGACY_SIM7020_AT_CGACT_W(Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGACT_R, LEGACY_SIM7020_AT_CGACT_R);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGDEL(Number), LEGACY_SIM7020_AT_CGDEL(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGDCONT_R, LEGACY_SIM7020_AT_CGDCONT_R);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGMI, LEGACY_SIM7020_AT_CGMI);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGMM, LEGACY_SIM7020_AT_CGMM);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGMR, LEGACY_SIM7020_AT_CGMR);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGOI, LEGACY_SIM7020_AT_CGOI);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGSN, LEGACY_SIM7020_AT_CGSN);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CIMI, LEGACY_SIM7020_AT_CIMI);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CCID, LEGACY_SIM7020_AT_CCID);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGCONTRDP_W(Number), LEGACY_SIM7020_AT_CGCONTRDP_W(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGCONTRDP, LEGACY_SIM7020_AT_CGCONTRDP);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CGREG, LEGACY_SIM7020_AT_CGREG);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CSQ, LEGACY_SIM7020_AT_CSQ);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CENG_R, LEGACY_SIM7020_AT_CENG_R);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CENG_W(Number), LEGACY_SIM7020_AT_CENG_W(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CNVMR(String), LEGACY_SIM7020_AT_CNVMR(String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CNVMW(String, String, Number), LEGACY_SIM7020_AT_CNVMW(String, String, Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CNVMGET, LEGACY_SIM7020_AT_CNVMGET);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CNVMIVD(String), LEGACY_SIM7020_AT_CNVMIVD(String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_RETENTION(Number), LEGACY_SIM7020_AT_RETENTION(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CPSMS_DIS(Number), LEGACY_SIM7020_AT_CPSMS_DIS(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CPSMS_EN(Number, Number), LEGACY_SIM7020_AT_CPSMS_EN(Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CPSMSTATUS_W(Number), LEGACY_SIM7020_AT_CPSMSTATUS_W(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CPSMSTATUS_R, LEGACY_SIM7020_AT_CPSMSTATUS_R);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CDNSGIP(String), LEGACY_SIM7020_AT_CDNSGIP(String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CIPPING(String, Number, Number, Number), LEGACY_SIM7020_AT_CIPPING("AT+CIPPING=\"" + String + "\"," + NumberStr + "," + NumberStr + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CSOC(Number, Number, Number), LEGACY_SIM7020_AT_CSOC("AT+CSOC=" + NumberStr + "," + NumberStr + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CSOCON(Number, Number, String), LEGACY_SIM7020_AT_CSOCON(Number, Number, String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CSOCL(Number), LEGACY_SIM7020_AT_CSOCL(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CSNTPSTART(String, String), LEGACY_SIM7020_AT_CSNTPSTART(String, String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CSNTPSTOP, LEGACY_SIM7020_AT_CSNTPSTOP);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CHTTPCREATE(String), LEGACY_SIM7020_AT_CHTTPCREATE(String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CHTTCON(Number), LEGACY_SIM7020_AT_CHTTCON(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CHTTPSEND(Number, Number, String), LEGACY_SIM7020_AT_CHTTPSEND("AT+CHTTPSEND=" + NumberStr + "," + NumberStr + "," + "\"" + String + "\""));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CHTTPSENDEXT_FIRST(Number, Number, Number, Number), LEGACY_SIM7020_AT_CHTTPSENDEXT("AT+CHTTPSENDEXT=" + NumberStr + "," + NumberStr + "," + NumberStr + "," + NumberStr + ","));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CHTTPDISCON(Number), LEGACY_SIM7020_AT_CHTTPDISCON(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CHTTPDESTROY(Number), LEGACY_SIM7020_AT_CHTTPDESTROY(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CMQNEW(String, Number, Number, Number, Number), LEGACY_SIM7020_AT_CMQNEW("AT+CMQNEW=\"" + String + "\"," + "\"" + NumberStr + "\"," + NumberStr + "," + NumberStr + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CMQCON(Number, Number, String, Number, Number, Number), LEGACY_SIM7020_AT_CMQCON("AT+CMQCON=" + NumberStr + "," + NumberStr + ",\"" + String + "\"," + NumberStr + "," + NumberStr + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CMQCON_AUTH(Number, Number, String, Number, Number, Number, String, String), LEGACY_SIM7020_AT_CMQCON("AT+CMQCON=" + NumberStr + "," + NumberStr + ",\"" + String + "\"," + NumberStr + "," + NumberStr + "," + NumberStr + ",\"" + String + "\",\"" + String + "\""));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CMQSUB(Number, String, Number), LEGACY_SIM7020_AT_CMQSUB(Number, String, Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CMQUNSUB(Number, String), LEGACY_SIM7020_AT_CMQUNSUB(Number, String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CMQDISCON(Number), LEGACY_SIM7020_AT_CMQDISCON(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CCOAPNEW(String, Number, Number), LEGACY_SIM7020_AT_CCOAPNEW("AT+CCOAPNEW=\"" + String + "\"," + NumberStr + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CCOAPCSEND(Number, Number, Number, Number), LEGACY_SIM7020_AT_CCOAPCSEND("AT+CCOAPCSEND=" + NumberStr + ",1," + NumberStr + "," + NumberStr + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CCOAPDEL(Number), LEGACY_SIM7020_AT_CCOAPDEL(Number));
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CNMP_W(Number), LEGACY_SIM7080_AT_CNMP_W(Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CNMP_R, LEGACY_SIM7080_AT_CNMP_R);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CMNB_W(Number), LEGACY_SIM7080_AT_CMNB_W(Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CMNB_R, LEGACY_SIM7080_AT_CMNB_R);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGREG, LEGACY_SIM7080_AT_CGREG);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_COPS_W(Number), LEGACY_SIM7080_AT_COPS_W("AT+COPS=" + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_COPS_W_OPERATOR(Number, Number, String, Number), LEGACY_SIM7080_AT_COPS_W("AT+COPS=" + NumberStr + "," + NumberStr + ",\"" + String + "\"" + "," + NumberStr));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_COPS_R, LEGACY_SIM7080_AT_COPS_R);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGDCONT_W(Number, "IPV4V6", String), LEGACY_SIM7080_AT_CGDCONT_W("AT+CGDCONT=" + NumberStr + ",\"IPV4V6\",\"" + String + "\""));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGDCONT_W_AUTH(Number, "Non-IP", String, String, String), LEGACY_SIM7080_AT_CGDCONT_W("AT+CGDCONT=" + NumberStr + ",\"Non-IP\",\"" + String + "\"" + ",\"" + String + "\",\"" + String + "\""));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CSQ, LEGACY_SIM7080_AT_CSQ);
+        SIM70XX_TEST_LEGACY(SIM70XX_AT_CBANDCFG_R, LEGACY_SIM70XX_AT_CBANDCFG_R);
+        SIM70XX_TEST_LEGACY(SIM70XX_AT_CBANDCFG_W(String, String), LEGACY_SIM70XX_AT_CBANDCFG_W(String, String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CNCFG_W(String), LEGACY_SIM7080_AT_CNCFG_W(String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CNACT_W(Number, Number), LEGACY_SIM7080_AT_CNACT_W(Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CNACT_R, LEGACY_SIM7080_AT_CNACT_R);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGMI, LEGACY_SIM7080_AT_CGMI);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGMM, LEGACY_SIM7080_AT_CGMM);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGMR, LEGACY_SIM7080_AT_CGMR);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGOI, LEGACY_SIM7080_AT_CGOI);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGSN, LEGACY_SIM7080_AT_CGSN);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CIMI, LEGACY_SIM7080_AT_CIMI);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CCID, LEGACY_SIM7080_AT_CCID);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGCONTRDP_W(Number), LEGACY_SIM7080_AT_CGCONTRDP_W(Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CGCONTRDP, LEGACY_SIM7080_AT_CGCONTRDP);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CPSI, LEGACY_SIM7080_AT_CPSI);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CENG_R, LEGACY_SIM7080_AT_CENG_R);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CENG_W(Number), LEGACY_SIM7080_AT_CENG_W(Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CDNSGIP(String), LEGACY_SIM7080_AT_CDNSGIP(String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CAOPEN(Number, Number, String, String, Number), LEGACY_SIM7080_AT_CAOPEN(Number, Number, String, String, Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CASEND(Number, Number, Number), LEGACY_SIM7080_AT_CASEND(Number, Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CARECV(Number, Number), LEGACY_SIM7080_AT_CARECV(Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CACLOSE(Number), LEGACY_SIM7020_AT_CACLOSE(Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CNTP_W(String, Number, Number, Number), LEGACY_SIM7020_AT_CNTP_W(String, Number, Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CNTP, LEGACY_SIM7020_AT_CNTP);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CCLK_R, LEGACY_SIM7020_AT_CCLK_R);
+        SIM70XX_TEST_LEGACY(SIM7020_AT_CSSLCFG(String), LEGACY_SIM7020_AT_CSSLCFG(String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_SMCONF(String), LEGACY_SIM7020_AT_SMCONF(String));
+        SIM70XX_TEST_LEGACY(SIM7020_AT_SMCONN, LEGACY_SIM7020_AT_SMCONN);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSINIT, LEGACY_SIM7080_AT_CFSINIT);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSWFILE(Number, String, Number, Number, Number), LEGACY_SIM7080_AT_CFSWFILE(Number, String, Number, Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSRFILE(Number, String, Number, Number, Number), LEGACY_SIM7080_AT_CFSRFILE(Number, String, Number, Number, Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSGFRS, LEGACY_SIM7080_AT_CFSGFRS);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSGFIS(Number, String), LEGACY_SIM7080_AT_CFSGFIS(Number, String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSDFILE(Number, String), LEGACY_SIM7080_AT_CFSDFILE(Number, String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSREN(Number, String, String), LEGACY_SIM7080_AT_CFSREN(Number, String, String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_CFSTERM, LEGACY_SIM7080_AT_CFSTERM);
+        SIM70XX_TEST_LEGACY(SIM7080_AT_EMAILCID(Number), LEGACY_SIM7080_AT_EMAILCID(Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_EMAILTO(Number), LEGACY_SIM7080_AT_EMAILTO(Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_SMTPSRV(String, Number), LEGACY_SIM7080_AT_SMTPSRV(String, Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_SMTPAUTH(String, String), LEGACY_SIM7080_AT_SMTPAUTH(String, String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_SMTPFROM(String, String), LEGACY_SIM7080_AT_SMTPFROM(String, String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_SMTPRCPT(Number, String, String), LEGACY_SIM7080_AT_SMTPRCPT(Number, String, String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_SMTPSUB(String), LEGACY_SIM7080_AT_SMTPSUB(String));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_SMTPBODY(Number), LEGACY_SIM7080_AT_SMTPBODY(Number));
+        SIM70XX_TEST_LEGACY(SIM7080_AT_SMTPSEND, LEGACY_SIM7080_AT_SMTPSEND);
+    #endif
+}
+
+/** @brief  Check the ping commands. The number of response lines is set by the caller now.
+ */
+static void Test_Ping(void)
+{
+    #if(CONFIG_SIMXX_DEV == 7080)
+        std::string Host = "8.8.8.8";
+        SIM70XX_TxCmd_t Command;
+        SIM70XX_Legacy_Cmd_t Legacy;
+
+        Command = SIM7080_AT_SNPING4(Host, 4, 64, 1000);
+        Legacy = LEGACY_SIM7080_AT_SNPING4(Host, 4, 64, 1000, 4);
+        SIM70XX_CHECK((Command.Command == Legacy.Command) && (Command.Timeout == Legacy.Timeout));
+
+        Command = SIM7080_AT_SNPING6(Host, 4, 64, 1000);
+        Legacy = LEGACY_SIM7080_AT_SNPING6(Host, 4, 64, 1000, 4);
+        SIM70XX_CHECK((Command.Command == Legacy.Command) && (Command.Timeout == Legacy.Timeout));
+    #endif
+}
+
+/** @brief  Check the compile time metadata and the fixed buffer output.
+ */
+static void Test_Buffer(void)
+{
+    char Buffer[8];
+    size_t Length;
+    uint32_t Band = 20;
+    std::string Topic = "test";
+    auto Definition = SIM70XX_AT_CFUN_W(1, 0);
+
+    static_assert(decltype(Definition)::Timeout == 60, "Timeout must be a compile time constant!");
+    static_assert(decltype(Definition)::Lines == 1, "Lines must be a compile time constant!");
+    static_assert(decltype(Definition)::recData, "recData must be a compile time constant!");
+
+    SIM70XX_CHECK((SIM70XX_Builder_Write(Definition, Buffer, sizeof(Buffer), &Length) == SIM70XX_ERR_NO_MEM) && (Length == 7) &&
+                  (strcmp(Buffer, "AT+CFUN") == 0));
+    SIM70XX_CHECK((SIM70XX_Builder_Write(SIM70XX_AT, Buffer, sizeof(Buffer), &Length) == SIM70XX_ERR_OK) && (Length == 2) && (strcmp(Buffer, "AT") == 0));
+    SIM70XX_CHECK((SIM70XX_Builder_Write(SIM70XX_AT_CBAND_W(Band), Buffer, sizeof(Buffer), &Length) == SIM70XX_ERR_NO_MEM) && (strcmp(Buffer, "AT+CBAN") == 0));
+    SIM70XX_CHECK(SIM70XX_Builder_Write(SIM70XX_AT, NULL, sizeof(Buffer)) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(SIM70XX_Builder_Write(SIM70XX_AT, Buffer, 0) == SIM70XX_ERR_INVALID_ARG);
+}
+
+int main(void)
+{
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    Test_Legacy<int>(0, "");
+    Test_Legacy<int>(-5, "broker.local");
+    Test_Legacy<int>(2147483647, "\"quoted\",text");
+    Test_Legacy<uint8_t>(200, "A");
+    Test_Legacy<uint16_t>(65535, "1,2,3");
+    Test_Legacy<uint32_t>(4000000000U, "http://server.local:8080/path");
+    Test_Legacy<int64_t>(-9000000000LL, "x");
+    Test_Legacy<uint64_t>(18446744073709551615ULL, "y");
+    Test_Legacy<bool>(true, "z");
+    Test_Legacy<SIM70XX_Baud_t>(SIM_BAUD_115200, "AT+TEST");
+    Test_Ping();
+    Test_Buffer();
+
+    return SIM70XX_CHECK_RESULT();
+}
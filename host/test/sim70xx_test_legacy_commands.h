@@ -0,0 +1,175 @@
+ /*
+ * sim70xx_test_legacy_commands.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_TEST_LEGACY_COMMANDS_H_
+#define SIM70XX_TEST_LEGACY_COMMANDS_H_
+
+#include <string>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <sdkconfig.h>
+
+/** @brief Command object of the string concatenating command macros, which were used before the command builder.
+ */
+typedef struct
+{
+    std::string Command;                            /**< AT command string. */
+    bool recData;                                   /**< Set to #true to receive data from the command. */
+    uint32_t Timeout;                               /**< Response timeout in seconds. */
+    uint16_t Lines;                                 /**< Number of response lines. */
+} SIM70XX_Legacy_Cmd_t;
+
+/** @brief              Legacy command generation macro.
+ *  @param AT           AT command
+ *  @param HasData      Set to #true to receive data from the command
+ *  @param Timeout      Response timeout in seconds
+ *  @param Number       Number of response lines to receive
+ */
+#define SIM70XX_LEGACY_CMD(AT, HasData, TimeOut, Number)        SIM70XX_Legacy_Cmd_t{AT, HasData, TimeOut, (uint16_t)(Number)}
+
+/**
+ * 
+ * Command macros of the baseline version of src/Private/Commands/sim70xx_commands.h, sim7020_commands.h and sim7080_commands.h.
+ * NOTE: std::to_String in the CENG macros is corrected to std::to_string. The macros were never used and didn´t compile.
+ * 
+ */
+#define LEGACY_SIM70XX_AT                                       SIM70XX_LEGACY_CMD("AT", false, 1, 1)
+#define LEGACY_SIM70XX_AT_CBAND_W(Band)                         SIM70XX_LEGACY_CMD("AT+CBAND=" + std::to_string(Band), false, 10, 1)
+#define LEGACY_SIM70XX_AT_CFUN_R                                SIM70XX_LEGACY_CMD("AT+CFUN?", true, 10, 1)
+#define LEGACY_SIM70XX_AT_CFUN_W(Func, Reset)                   SIM70XX_LEGACY_CMD("AT+CFUN=" + std::to_string(Func) + "," + std::to_string(Reset), true, 60, 1)
+#define LEGACY_SIM70XX_AT_CBAND_R                               SIM70XX_LEGACY_CMD("AT+CBAND?", true, 10, 1)
+#define LEGACY_SIM70XX_AT_CGATT_R                               SIM70XX_LEGACY_CMD("AT+CGATT?", true, 90, 1)
+#define LEGACY_SIM70XX_AT_CPIN_R                                SIM70XX_LEGACY_CMD("AT+CPIN?", true, 10, 1)
+
+#if(CONFIG_SIMXX_DEV == 7020)
+#define LEGACY_SIM7020_AT_MCGDEFCONT(Command)                   SIM70XX_LEGACY_CMD(Command, false, 60, 1)
+#define LEGACY_SIM7020_AT_COPS_W(Command)                       SIM70XX_LEGACY_CMD(Command, false, 300, 1)
+#define LEGACY_SIM7020_AT_COPS_R                                SIM70XX_LEGACY_CMD("AT+COPS=?", true, 300, 1)
+#define LEGACY_SIM7020_AT_IPR_W(Baud)                           SIM70XX_LEGACY_CMD("AT+IPR=" + std::to_string(Baud), false, 10, 1)
+#define LEGACY_SIM7020_AT_CGACT_W(ID, Enable)                   SIM70XX_LEGACY_CMD("AT+CGACT=" + std::to_string(Enable) + "," + std::to_string(ID), false, 10, 1)
+#define LEGACY_SIM7020_AT_CGACT_R                               SIM70XX_LEGACY_CMD("AT+CGACT?", true, 10, 1)
+#define LEGACY_SIM7020_AT_CGDEL(ID)                             SIM70XX_LEGACY_CMD("AT+CGDEL=" + std::to_string(ID), true, 10, 1)
+#define LEGACY_SIM7020_AT_CGDCONT_R                             SIM70XX_LEGACY_CMD("AT+CGDCONT?", true, 10, 1)
+#define LEGACY_SIM7020_AT_CGMI                                  SIM70XX_LEGACY_CMD("AT+CGMI", true, 1, 1)
+#define LEGACY_SIM7020_AT_CGMM                                  SIM70XX_LEGACY_CMD("AT+CGMM", true, 1, 1)
+#define LEGACY_SIM7020_AT_CGMR                                  SIM70XX_LEGACY_CMD("AT+CGMR", true, 1, 1)
+#define LEGACY_SIM7020_AT_CGOI                                  SIM70XX_LEGACY_CMD("AT+CGOI", true, 1, 1)
+#define LEGACY_SIM7020_AT_CGSN                                  SIM70XX_LEGACY_CMD("AT+CGSN", true, 1, 1)
+#define LEGACY_SIM7020_AT_CIMI                                  SIM70XX_LEGACY_CMD("AT+CIMI", true, 1, 1)
+#define LEGACY_SIM7020_AT_CCID                                  SIM70XX_LEGACY_CMD("AT+CCID", true, 1, 1)
+#define LEGACY_SIM7020_AT_CGCONTRDP_W(ID)                       SIM70XX_LEGACY_CMD("AT+CGCONTRDP=" + std::to_string(ID), true, 60, 1)
+#define LEGACY_SIM7020_AT_CGCONTRDP                             SIM70XX_LEGACY_CMD("AT+CGCONTRDP", true, 300, 1)
+#define LEGACY_SIM7020_AT_CGREG                                 SIM70XX_LEGACY_CMD("AT+CGREG?", true, 10, 1)
+#define LEGACY_SIM7020_AT_CSQ                                   SIM70XX_LEGACY_CMD("AT+CSQ", true, 1, 1)
+#define LEGACY_SIM7020_AT_CENG_R                                SIM70XX_LEGACY_CMD("AT+CENG?", true, 1, 1)
+#define LEGACY_SIM7020_AT_CENG_W(Mode)                          SIM70XX_LEGACY_CMD("AT+CENG=" + std::to_string(Mode), false, 1, 1)
+#define LEGACY_SIM7020_AT_CNVMR(Key)                            SIM70XX_LEGACY_CMD("AT+CNVMR=\"" + Key + "\"", true, 10, 1)
+#define LEGACY_SIM7020_AT_CNVMW(Key, Payload, Length)           SIM70XX_LEGACY_CMD("AT+CNVMW=\"" + Key + "\",\"" + Payload + "\"," + std::to_string(Length), true, 10, 1)
+#define LEGACY_SIM7020_AT_CNVMGET                               SIM70XX_LEGACY_CMD("AT+CNVMGET", true, 10, 0)
+#define LEGACY_SIM7020_AT_CNVMIVD(Key)                          SIM70XX_LEGACY_CMD("AT+CNVMIVD=\"" + Key + "\"", true, 10, 1)
+#define LEGACY_SIM7020_AT_RETENTION(Enable)                     SIM70XX_LEGACY_CMD("AT+RETENTION=" + std::to_string(Enable), false, 10, 1)
+#define LEGACY_SIM7020_AT_CPSMS_DIS(Mode)                       SIM70XX_LEGACY_CMD("AT+CPSMS=" + std::to_string(Mode), false, 1, 1)
+#define LEGACY_SIM7020_AT_CPSMS_EN(TAU, Active)                 SIM70XX_LEGACY_CMD("AT+CPSMS=1,,,\"" + std::to_string(TAU) + "\",\"" + std::to_string(Active) + "\"", false, 1, 1)
+#define LEGACY_SIM7020_AT_CPSMSTATUS_W(Enable)                  SIM70XX_LEGACY_CMD("AT+CPSMSTATUS=" + std::to_string(Enable), false, 1, 1)
+#define LEGACY_SIM7020_AT_CPSMSTATUS_R                          SIM70XX_LEGACY_CMD("AT+CPSMSTATUS?", true, 1, 1)
+#define LEGACY_SIM7020_AT_CDNSGIP(Host)                         SIM70XX_LEGACY_CMD("AT+CDNSGIP=\"" + Host + "\"", false, 1, 1)
+#define LEGACY_SIM7020_AT_CIPPING(Command)                      SIM70XX_LEGACY_CMD(Command, false, 60, 1)
+#define LEGACY_SIM7020_AT_CSOC(Command)                         SIM70XX_LEGACY_CMD(Command, true, 60, 1)
+#define LEGACY_SIM7020_AT_CSOCON(ID, Port, Address)             SIM70XX_LEGACY_CMD("AT+CSOCON=" + std::to_string(ID) + "," + std::to_string(Port) + ",\"" + Address + "\"", false, 60, 1)
+#define LEGACY_SIM7020_AT_CCSOSEND_BYTES(ID, Length, Data)      SIM70XX_LEGACY_CMD("AT+CSOSEND=" + std::to_string(ID) + "," + std::to_string(Length) + "," + Data, false, 60, 1)
+#define LEGACY_SIM7020_AT_CCSOSEND_STRING(ID, Data)             SIM70XX_LEGACY_CMD("AT+CSOSEND=" + std::to_string(ID) + ",0,\"" + Data + "\"", false, 60, 1)
+#define LEGACY_SIM7020_AT_CSOCL(ID)                             SIM70XX_LEGACY_CMD("AT+CSOCL=" + std::to_string(ID), false, 60, 1)
+#define LEGACY_SIM7020_AT_CSNTPSTART(Server, Zone)              SIM70XX_LEGACY_CMD("AT+CSNTPSTART=\"" + Server + "\",\"" + Zone + "\"", false, 60, 1)
+#define LEGACY_SIM7020_AT_CSNTPSTOP                             SIM70XX_LEGACY_CMD("AT+CSNTPSTOP", false, 60, 1)
+#define LEGACY_SIM7020_AT_CHTTPCREATE(Host)                     SIM70XX_LEGACY_CMD("AT+CHTTPCREATE=" + Host, true, 60, 1)
+#define LEGACY_SIM7020_AT_CHTTCON(ID)                           SIM70XX_LEGACY_CMD("AT+CHTTPCON=" + std::to_string(ID), false, 60, 1)
+#define LEGACY_SIM7020_AT_CHTTPSEND(Command)                    SIM70XX_LEGACY_CMD(Command, false, 120, 1)
+#define LEGACY_SIM7020_AT_CHTTPSENDEXT(Command)                 SIM70XX_LEGACY_CMD(Command, false, 120, 1)
+#define LEGACY_SIM7020_AT_CHTTPDISCON(ID)                       SIM70XX_LEGACY_CMD("AT+CHTTPDISCON=" + std::to_string(ID), false, 10, 1)
+#define LEGACY_SIM7020_AT_CHTTPDESTROY(ID)                      SIM70XX_LEGACY_CMD("AT+CHTTPDESTROY=" + std::to_string(ID), false, 10, 1)
+#define LEGACY_SIM7020_AT_CMQNEW(Command)                       SIM70XX_LEGACY_CMD(Command, true, 60, 1)
+#define LEGACY_SIM7020_AT_CMQCON(Command)                       SIM70XX_LEGACY_CMD(Command, false, 60, 1)
+#define LEGACY_SIM7020_AT_CMQPUB(Command)                       SIM70XX_LEGACY_CMD(Command, false, 60, 1)
+#define LEGACY_SIM7020_AT_CMQSUB(ID, Topic, QoS)                SIM70XX_LEGACY_CMD("AT+CMQSUB=" + std::to_string(ID) + ",\"" + Topic + "\"," + std::to_string(QoS), false, 10, 1)
+#define LEGACY_SIM7020_AT_CMQUNSUB(ID, Topic)                   SIM70XX_LEGACY_CMD("AT+CMQUNSUB=" + std::to_string(ID) + ",\"" + Topic + "\"", false, 10, 1)
+#define LEGACY_SIM7020_AT_CMQDISCON(ID)                         SIM70XX_LEGACY_CMD("AT+CMQDISCON=" + std::to_string(ID), false, 10, 1)
+#define LEGACY_SIM7020_AT_CCOAPNEW(Command)                     SIM70XX_LEGACY_CMD(Command, true, 60, 1)
+#define LEGACY_SIM7020_AT_CCOAPCSEND(Command)                   SIM70XX_LEGACY_CMD(Command, false, 60, 1)
+#define LEGACY_SIM7020_AT_CCOAPDEL(ID)                          SIM70XX_LEGACY_CMD("AT+CCOAPDEL=" + std::to_string(ID), false, 10, 1)
+#elif(CONFIG_SIMXX_DEV == 7080)
+#define LEGACY_SIM7080_AT_CNMP_W(Mode)                          SIM70XX_LEGACY_CMD("AT+CNMP=" + std::to_string(Mode), false, 10, 1)
+#define LEGACY_SIM7080_AT_CNMP_R                                SIM70XX_LEGACY_CMD("AT+CNMP?", true, 10, 1)
+#define LEGACY_SIM7080_AT_CMNB_W(Sel)                           SIM70XX_LEGACY_CMD("AT+CMNB=" + std::to_string(Sel), false, 10, 1)
+#define LEGACY_SIM7080_AT_CMNB_R                                SIM70XX_LEGACY_CMD("AT+CMNB?", true, 10, 1)
+#define LEGACY_SIM7080_AT_CGREG                                 SIM70XX_LEGACY_CMD("AT+CGREG?", true, 10, 1)
+#define LEGACY_SIM7080_AT_COPS_W(Command)                       SIM70XX_LEGACY_CMD(Command, false, 300, 1)
+#define LEGACY_SIM7080_AT_COPS_R                                SIM70XX_LEGACY_CMD("AT+COPS?", true, 300, 1)
+#define LEGACY_SIM7080_AT_CGDCONT_W(Command)                    SIM70XX_LEGACY_CMD(Command, false, 10, 1)
+#define LEGACY_SIM7080_AT_CSQ                                   SIM70XX_LEGACY_CMD("AT+CSQ", true, 1, 1)
+#define LEGACY_SIM70XX_AT_CBANDCFG_R                            SIM70XX_LEGACY_CMD("AT+CBANDCFG?", true, 1, 2)
+#define LEGACY_SIM70XX_AT_CBANDCFG_W(Mode, Bandlist)            SIM70XX_LEGACY_CMD("AT+CBANDCFG=" + Mode + "," + Bandlist, false, 10, 1)
+#define LEGACY_SIM7080_AT_CNCFG_W(Command)                      SIM70XX_LEGACY_CMD("AT+CNCFG=" + Command, false, 1, 1)
+#define LEGACY_SIM7080_AT_CNACT_W(PDP, Action)                  SIM70XX_LEGACY_CMD("AT+CNACT=" + std::to_string(PDP) + "," + std::to_string(Action), true, 300, 1)
+#define LEGACY_SIM7080_AT_CNACT_R                               SIM70XX_LEGACY_CMD("AT+CNACT?", true, 10, 4)
+#define LEGACY_SIM7080_AT_CGMI                                  SIM70XX_LEGACY_CMD("AT+CGMI", true, 1, 1)
+#define LEGACY_SIM7080_AT_CGMM                                  SIM70XX_LEGACY_CMD("AT+CGMM", true, 1, 1)
+#define LEGACY_SIM7080_AT_CGMR                                  SIM70XX_LEGACY_CMD("AT+CGMR", true, 1, 1)
+#define LEGACY_SIM7080_AT_CGOI                                  SIM70XX_LEGACY_CMD("AT+CGOI", true, 1, 1)
+#define LEGACY_SIM7080_AT_CGSN                                  SIM70XX_LEGACY_CMD("AT+CGSN", true, 1, 1)
+#define LEGACY_SIM7080_AT_CIMI                                  SIM70XX_LEGACY_CMD("AT+CIMI", true, 1, 1)
+#define LEGACY_SIM7080_AT_CCID                                  SIM70XX_LEGACY_CMD("AT+CCID", true, 1, 1)
+#define LEGACY_SIM7080_AT_CGCONTRDP_W(ID)                       SIM70XX_LEGACY_CMD("AT+CGCONTRDP=" + std::to_string(ID), true, 60, 1)
+#define LEGACY_SIM7080_AT_CGCONTRDP                             SIM70XX_LEGACY_CMD("AT+CGCONTRDP", true, 300, 1)
+#define LEGACY_SIM7080_AT_CPSI                                  SIM70XX_LEGACY_CMD("AT+CPSI?", true, 1, 1)
+#define LEGACY_SIM7080_AT_CENG_R                                SIM70XX_LEGACY_CMD("AT+CENG?", true, 1, 1)
+#define LEGACY_SIM7080_AT_CENG_W(Mode)                          SIM70XX_LEGACY_CMD("AT+CENG=" + std::to_string(Mode), false, 1, 1)
+#define LEGACY_SIM7080_AT_SNPING4(Host, Retries, Size, Timeout, Items)SIM70XX_LEGACY_CMD("AT+SNPING4=\"" + Host + "\"," + std::to_string(Retries) + "," + std::to_string(Size) + "," + std::to_string(Timeout), true, 60, Items)
+#define LEGACY_SIM7080_AT_SNPING6(Host, Retries, Size, Timeout, Items)SIM70XX_LEGACY_CMD("AT+SNPING6=\"" + Host + "\"," + std::to_string(Retries) + "," + std::to_string(Size) + "," + std::to_string(Timeout), true, 60, Items)
+#define LEGACY_SIM7080_AT_CDNSGIP(Host)                         SIM70XX_LEGACY_CMD("AT+CDNSGIP=\"" + Host + "\"", false, 1, 1)
+#define LEGACY_SIM7080_AT_CAOPEN(ID, PDP, Type, Address, Port)  SIM70XX_LEGACY_CMD("AT+CAOPEN=" + std::to_string(ID) + "," + std::to_string(PDP) + "," + "\"" + Type + "\",\"" + Address + "\"," + std::to_string(Port), true, 0, 1)
+#define LEGACY_SIM7080_AT_CASEND(ID, Size, Timeout)             SIM70XX_LEGACY_CMD("AT+CASEND=" + std::to_string(ID) + "," + std::to_string(Size) + "," + std::to_string(Timeout), false, 1, 1)
+#define LEGACY_SIM7080_AT_CARECV(ID, Size)                      SIM70XX_LEGACY_CMD("AT+CARECV=" + std::to_string(ID) + "," + std::to_string(Size), true, 10, 1)
+#define LEGACY_SIM7020_AT_CACLOSE(ID)                           SIM70XX_LEGACY_CMD("AT+CACLOSE=" + std::to_string(ID), false, 1, 1)
+#define LEGACY_SIM7020_AT_CNTP_W(Server, TimeZone, ID, Mode)    SIM70XX_LEGACY_CMD("AT+CNTP=\"" + Server + "\"," + std::to_string(TimeZone) + "," + std::to_string(ID) + "," + std::to_string(Mode), false, 60, 1)
+#define LEGACY_SIM7020_AT_CNTP                                  SIM70XX_LEGACY_CMD("AT+CNTP", true, 60, 1)
+#define LEGACY_SIM7020_AT_CCLK_R                                SIM70XX_LEGACY_CMD("AT+CCLK?", true, 1, 1)
+#define LEGACY_SIM7020_AT_CSSLCFG(Command)                      SIM70XX_LEGACY_CMD(Command, false, 10, 1)
+#define LEGACY_SIM7020_AT_SMCONF(Command)                       SIM70XX_LEGACY_CMD(Command, false, 10, 1)
+#define LEGACY_SIM7020_AT_SMCONN                                SIM70XX_LEGACY_CMD("AT+SMCONN", false, 10, 1)
+#define LEGACY_SIM7080_AT_CFSINIT                               SIM70XX_LEGACY_CMD("AT+CFSINIT", false, 10, 1)
+#define LEGACY_SIM7080_AT_CFSWFILE(Path, Name, Mode, Size, Timeout)SIM70XX_LEGACY_CMD("AT+CFSWFILE=" + std::to_string(Path) + ",\"" + Name + "\"," + std::to_string(Mode) + "," + std::to_string(Size) + "," + std::to_string(Timeout), false, 1, 1)
+#define LEGACY_SIM7080_AT_CFSRFILE(Path, Name, Mode, Size, Position)SIM70XX_LEGACY_CMD("AT+CFSRFILE=" + std::to_string(Path) + ",\"" + Name + "\"," + std::to_string(Mode) + "," + std::to_string(Size) + "," + std::to_string(Position), false, 1, 1)
+#define LEGACY_SIM7080_AT_CFSGFRS                               SIM70XX_LEGACY_CMD("AT+CFSGFRS?", true, 1, 1)
+#define LEGACY_SIM7080_AT_CFSGFIS(Path, Name)                   SIM70XX_LEGACY_CMD("AT+CFSGFIS=" + std::to_string(Path) + ",\"" + Name + "\"", true, 1, 1)
+#define LEGACY_SIM7080_AT_CFSDFILE(Path, Name)                  SIM70XX_LEGACY_CMD("AT+CFSDFILE=" + std::to_string(Path) + ",\"" + Name + "\"", false, 1, 1)
+#define LEGACY_SIM7080_AT_CFSREN(Path, Old, New)                SIM70XX_LEGACY_CMD("AT+CFSREN=" + std::to_string(Path) + ",\"" + Old + "\",\"" + New + "\"", false, 1, 1)
+#define LEGACY_SIM7080_AT_CFSTERM                               SIM70XX_LEGACY_CMD("AT+CFSTERM", false, 1, 1)
+#define LEGACY_SIM7080_AT_EMAILCID(ID)                          SIM70XX_LEGACY_CMD("AT+EMAILCID=" + std::to_string(ID), false, 1, 1)
+#define LEGACY_SIM7080_AT_EMAILTO(Timeout)                      SIM70XX_LEGACY_CMD("AT+EMAILTO=" + std::to_string(Timeout), false, 1, 1)
+#define LEGACY_SIM7080_AT_SMTPSRV(Address, Port)                SIM70XX_LEGACY_CMD("AT+SMTPSRV=\"" + Address + "\"," + std::to_string(Port), false, 1, 1)
+#define LEGACY_SIM7080_AT_SMTPAUTH(User, Password)              SIM70XX_LEGACY_CMD("AT+SMTPAUTH=1,\"" + User + "\",\"" + Password + "\"", false, 1, 1)
+#define LEGACY_SIM7080_AT_SMTPFROM(Address, Name)               SIM70XX_LEGACY_CMD("AT+SMTPFROM=\"" + Address + "\",\"" + Name + "\"", false, 1, 1)
+#define LEGACY_SIM7080_AT_SMTPRCPT(Type, Address, Name)         SIM70XX_LEGACY_CMD("AT+SMTPRCPT=" + std::to_string(Type) + ",0,\"" + Address + "\",\"" + Name + "\"", false, 1, 1)
+#define LEGACY_SIM7080_AT_SMTPSUB(Subject)                      SIM70XX_LEGACY_CMD("AT+SMTPSUB=" + Subject, false, 1, 1)
+#define LEGACY_SIM7080_AT_SMTPBODY(Size)                        SIM70XX_LEGACY_CMD("AT+SMTPBODY=" + std::to_string(Size), false, 1, 1)
+#define LEGACY_SIM7080_AT_SMTPSEND                              SIM70XX_LEGACY_CMD("AT+SMTPSEND", false, 300, 1)
+#endif
+
+#endif /* SIM70XX_TEST_LEGACY_COMMANDS_H_ */
@@ -0,0 +1,143 @@
+ /*
+ * sim70xx_test_port.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+#include <esp_log.h>
+#include <sdkconfig.h>
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "sim70xx_tools.h"
+#include "Private/UART/sim70xx_uart.h"
+
+#include "sim70xx_host_check.h"
+
+static void Test_Task(void* p_Arg)
+{
+    xSemaphoreGive((SemaphoreHandle_t)p_Arg);
+
+    vTaskDelete(NULL);
+}
+
+/** @brief  Check the FreeRTOS queues, queue sets, semaphores and tasks of the POSIX port.
+ */
+static void Test_FreeRTOS(void)
+{
+    uint32_t Item;
+    QueueHandle_t Queue;
+    QueueSetHandle_t Set;
+    SemaphoreHandle_t Semaphore;
+
+    Queue = xQueueCreate(2, sizeof(uint32_t));
+    Item = 1;
+    SIM70XX_CHECK(xQueueSend(Queue, &Item, 0) == pdPASS);
+    Item = 2;
+    SIM70XX_CHECK(xQueueSend(Queue, &Item, 0) == pdPASS);
+    SIM70XX_CHECK(xQueueSend(Queue, &Item, 10) != pdPASS);
+    SIM70XX_CHECK((xQueueReceive(Queue, &Item, 0) == pdPASS) && (Item == 1));
+    SIM70XX_CHECK((xQueueReceive(Queue, &Item, 0) == pdPASS) && (Item == 2));
+    SIM70XX_CHECK(xQueueReceive(Queue, &Item, 10) != pdPASS);
+
+    Set = xQueueCreateSet(2);
+    xQueueAddToSet(Queue, Set);
+    SIM70XX_CHECK(xQueueSelectFromSet(Set, 10) == NULL);
+    xQueueSend(Queue, &Item, 0);
+    SIM70XX_CHECK(xQueueSelectFromSet(Set, 10) == Queue);
+    SIM70XX_CHECK(xQueueReceive(Queue, &Item, 0) == pdPASS);
+
+    Semaphore = xSemaphoreCreateBinary();
+    SIM70XX_CHECK(xSemaphoreTake(Semaphore, 0) != pdPASS);
+    SIM70XX_CHECK(xTaskCreate(Test_Task, "Test", 4096, Semaphore, 1, NULL) == pdPASS);
+    SIM70XX_CHECK(xSemaphoreTake(Semaphore, 1000 / portTICK_PERIOD_MS) == pdPASS);
+
+    vSemaphoreDelete(Semaphore);
+    vQueueDelete(Queue);
+}
+
+/** @brief  Check the serial interface of the POSIX port with a socket pair as device.
+ */
+static void Test_UART(void)
+{
+    int FD[2];
+    uint8_t Buffer[4];
+    std::string Line;
+    std::string Long;
+    SIM70XX_UART_Conf_t Config;
+    TickType_t Start;
+
+    memset(&Config, 0, sizeof(Config));
+    Config.Interface = UART_NUM_1;
+    Config.Baudrate = SIM_BAUD_115200;
+
+    SIM70XX_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, FD) == 0);
+    SIM70XX_CHECK(SIM70XX_Tools_SetHostDevice(Config.Interface, FD[0]) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM70XX_UART_Init(Config) == SIM70XX_ERR_OK);
+
+    // Module to driver.
+    SIM70XX_CHECK(write(FD[1], "+CSQ: 20,0\r\nOK\r\n", 16) == 16);
+    Start = xTaskGetTickCount();
+    while((SIM70XX_UART_ReadLine(Config, &Line) == false) && ((xTaskGetTickCount() - Start) < 1000))
+    {
+        SIM70XX_UART_ProcessEvent(Config);
+    }
+    SIM70XX_CHECK(Line == "+CSQ: 20,0\r");
+    SIM70XX_CHECK(SIM70XX_UART_ReadStringUntil(Config) == "OK\r");
+
+    // Driver to module.
+    SIM70XX_CHECK(SIM70XX_UART_SendLine(Config, "AT") == SIM70XX_ERR_OK);
+    SIM70XX_CHECK((read(FD[1], Buffer, sizeof(Buffer)) == 4) && (memcmp(Buffer, "AT\r\n", 4) == 0));
+    SIM70XX_CHECK(Config.RxBytes == 16);
+
+    // Lines longer than the receive buffer are collected, lines longer than the maximum line length are discarded.
+    Long = std::string(1000, 'A') + "\r\n" + std::string(CONFIG_SIM70XX_UART_LINE_SIZE + 100, 'B') + "\r\nOK\r\n";
+    SIM70XX_CHECK(write(FD[1], Long.c_str(), Long.size()) == (ssize_t)Long.size());
+    for(uint32_t i = 0; i < 2; i++)
+    {
+        Line.clear();
+        Start = xTaskGetTickCount();
+        while((SIM70XX_UART_ReadLine(Config, &Line) == false) && ((xTaskGetTickCount() - Start) < 1000))
+        {
+            SIM70XX_UART_ProcessEvent(Config);
+        }
+
+        SIM70XX_CHECK(Line == ((i == 0) ? (std::string(1000, 'A') + "\r") : std::string("OK\r")));
+    }
+    SIM70XX_CHECK(Config.LineOverflow == 1);
+
+    SIM70XX_CHECK(SIM70XX_UART_Deinit(Config) == SIM70XX_ERR_OK);
+    SIM70XX_Tools_SetHostDevice(Config.Interface, -1);
+    close(FD[0]);
+    close(FD[1]);
+}
+
+int main(void)
+{
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    Test_FreeRTOS();
+    Test_UART();
+
+    return SIM70XX_CHECK_RESULT();
+}
@@ -0,0 +1,256 @@
+ /*
+ * sim70xx_test_sim7020.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <string.h>
+
+#include "sim7020.h"
+#include "Private/UART/sim70xx_uart.h"
+
+#include "sim70xx_host_check.h"
+#include "sim70xx_host_modem.h"
+
+static SIM7020_t _Device;
+static SIM70XX_Error_t _PingError;
+
+/** @brief  Check that only the communication task reads from the interface while the driver is running.
+ */
+static void Test_Consumer(void)
+{
+    std::string Line;
+
+    SIM70XX_CHECK(SIM70XX_UART_isConsumer(_Device.UART) == false);
+    SIM70XX_CHECK(SIM70XX_UART_ReadLine(_Device.UART, &Line) == false);
+    SIM70XX_CHECK(SIM70XX_UART_Init(_Device.UART) == SIM70XX_ERR_INVALID_STATE);
+    SIM70XX_CHECK(SIM70XX_Tools_DisableEcho(_Device.UART) == SIM70XX_ERR_INVALID_STATE);
+    SIM70XX_CHECK(SIM70XX_Tools_isActive(_Device.UART) == false);
+
+    // The driver still works.
+    SIM70XX_CHECK(SIM7020_Ping(_Device) == SIM70XX_ERR_OK);
+}
+
+/** @brief  Check the MQTT publish path. The simulated broker sends a message for a subscribed topic back.
+ */
+static void Test_MQTT(void)
+{
+    SIM7020_Pub_t Message;
+    SIM70XX_Statistics_t Before;
+    SIM70XX_Statistics_t After;
+    SIM7020_MQTT_Socket_t Socket = SIM7020_MQTT_Socket_t();
+
+    SIM70XX_CHECK(SIM7020_MQTT_Create(_Device, &Socket, "broker.local") == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7020_MQTT_Connect(_Device, "SIM7020", &Socket) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7020_MQTT_Subscribe(_Device, &Socket, "test", SIM7020_MQTT_QOS_1) == SIM70XX_ERR_OK);
+    SIM7020_GetStatistics(_Device, &Before);
+    SIM70XX_CHECK(SIM7020_MQTT_Publish(_Device, &Socket, "test", SIM7020_MQTT_QOS_1, "Hello", false, false) == SIM70XX_ERR_OK);
+
+    vTaskDelay(200 / portTICK_PERIOD_MS);
+    SIM70XX_CHECK(SIM7020_MQTT_GetMessage(_Device, &Message) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(Message.Topic == "test");
+
+    // The received message is passed to the handler without a copy. The publish packet of the handler isn´t counted.
+    SIM7020_GetStatistics(_Device, &After);
+    SIM70XX_CHECK(After.Allocations == Before.Allocations);
+
+    SIM70XX_CHECK(SIM7020_MQTT_Destroy(_Device, &Socket) == SIM70XX_ERR_OK);
+}
+
+/** @brief  Check that commands without asynchronous messages don´t cause heap allocations in the driver.
+ */
+static void Test_Allocations(void)
+{
+    SIM70XX_Statistics_t Before;
+    SIM70XX_Statistics_t After;
+
+    SIM7020_GetStatistics(_Device, &Before);
+    for(uint32_t i = 0; i < 10; i++)
+    {
+        SIM70XX_CHECK(SIM7020_Ping(_Device) == SIM70XX_ERR_OK);
+    }
+    SIM7020_GetStatistics(_Device, &After);
+
+    SIM70XX_CHECK(After.Allocations == Before.Allocations);
+}
+
+/** @brief          Content writer which appends each frame to a string.
+ *  @param p_Arg    Pointer to content string
+ *  @param p_Data   Pointer to data
+ *  @param Length   Length of data
+ *  @return         #true
+ */
+static bool Test_Writer(void* p_Arg, const uint8_t* p_Data, size_t Length)
+{
+    ((std::string*)p_Arg)->append((const char*)p_Data, Length);
+
+    return true;
+}
+
+/** @brief          Content writer which needs some time for each frame.
+ *  @param p_Arg    Pointer to content string
+ *  @param p_Data   Pointer to data
+ *  @param Length   Length of data
+ *  @return         #true
+ */
+static bool Test_SlowWriter(void* p_Arg, const uint8_t* p_Data, size_t Length)
+{
+    std::string* Content = (std::string*)p_Arg;
+
+    vTaskDelay(20 / portTICK_PERIOD_MS);
+    Content->append((const char*)p_Data, Length);
+
+    return true;
+}
+
+/** @brief          Content writer which stalls at the first frame.
+ *  @param p_Arg    Pointer to content string
+ *  @param p_Data   Pointer to data
+ *  @param Length   Length of data
+ *  @return         #true
+ */
+static bool Test_StalledWriter(void* p_Arg, const uint8_t* p_Data, size_t Length)
+{
+    std::string* Content = (std::string*)p_Arg;
+
+    if(Content->empty())
+    {
+        vTaskDelay(1500 / portTICK_PERIOD_MS);
+    }
+    Content->append((const char*)p_Data, Length);
+
+    return true;
+}
+
+/** @brief  Check a HTTP request and the response of the simulated server.
+ */
+static void Test_HTTP(void)
+{
+    uint16_t Code;
+    uint8_t Buffer[64];
+    uint32_t Length;
+    std::string Content;
+    SIM7020_HTTP_Socket_t Socket = SIM7020_HTTP_Socket_t();
+
+    SIM70XX_CHECK(SIM7020_HTTP_Create(_Device, "http://server.local", &Socket) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7020_HTTP_Connect(_Device, &Socket, 5) == SIM70XX_ERR_OK);
+
+    // The response body of a POST request is passed to the writer.
+    Code = 0;
+    SIM70XX_CHECK((SIM7020_HTTP_POST(_Device, &Socket, "/post", "text/plain", "", "Hello, World!", 13, Test_Writer, &Content, &Length, &Code) == SIM70XX_ERR_OK) && (Code == 200));
+    SIM70XX_CHECK((Length == 26) && (Content == "ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+
+    // The response body stays in the mailbox until it is read.
+    Code = 0;
+    Content.clear();
+    SIM70XX_CHECK((SIM7020_HTTP_POST(_Device, &Socket, "/post", "text/plain", "", "Hello, World!", &Code) == SIM70XX_ERR_OK) && (Code == 200));
+    SIM70XX_CHECK(SIM7020_HTTP_ReadResponse(_Device, &Socket, Test_Writer, &Content, &Length) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK((Length == 26) && (Content == "ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+
+    // The content of the response is split into frames of 2 bytes.
+    Code = 0;
+    SIM70XX_CHECK(SIM7020_HTTP_GET(_Device, &Socket, "/get", Buffer, sizeof(Buffer), &Length, &Code) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK((Code == 200) && (Length == 26) && (memcmp(Buffer, "ABCDEFGHIJKLMNOPQRSTUVWXYZ", Length) == 0));
+
+    // More frames than the mailbox can store. The communication task doesn´t wait for a slow or a stalled writer, so frames are lost.
+    Content.clear();
+    SIM70XX_CHECK(SIM7020_HTTP_GET(_Device, &Socket, "/get", Test_SlowWriter, &Content, &Length) == SIM70XX_ERR_FAIL);
+
+    Content.clear();
+    SIM70XX_CHECK(SIM7020_HTTP_GET(_Device, &Socket, "/get", Test_StalledWriter, &Content, &Length) == SIM70XX_ERR_FAIL);
+
+    SIM70XX_CHECK(SIM7020_HTTP_Disconnect(_Device, &Socket) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7020_HTTP_Destroy(_Device, &Socket) == SIM70XX_ERR_OK);
+}
+
+/** @brief  Check the connection pool. The script drops the first destroy request, so the pooled socket must be
+ *          removed from the socket list although the module doesn´t confirm it.
+ */
+static void Test_Pool(void)
+{
+    SIM7020_HTTP_Socket_t* Socket;
+
+    SIM70XX_CHECK(SIM7020_HTTP_Acquire(_Device, "http://server.local", &Socket, 5) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7020_HTTP_Release(_Device, Socket) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7020_HTTP_ClosePool(_Device) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(_Device.HTTP.Pool.empty() && _Device.HTTP.Sockets.empty());
+}
+
+/** @brief          Ping the module while another task waits for a dropped response.
+ *  @param p_Arg    Pointer to completion handle
+ */
+static void Test_PingTask(void* p_Arg)
+{
+    vTaskDelay(100 / portTICK_PERIOD_MS);
+
+    _PingError = SIM7020_Ping(_Device);
+
+    xSemaphoreGive((SemaphoreHandle_t)p_Arg);
+    vTaskDelete(NULL);
+}
+
+/** @brief  Check the fault injection of the simulator. The script answers the first signal quality request with ERROR
+ *          and drops the second one. A ping is queued while the driver waits for the dropped response and must not expire.
+ */
+static void Test_Faults(void)
+{
+    SIM70XX_Qual_t Report;
+    SemaphoreHandle_t Done;
+
+    Done = xSemaphoreCreateBinary();
+
+    SIM70XX_CHECK(SIM7020_Info_GetQuality(_Device, &Report) != SIM70XX_ERR_OK);
+
+    xTaskCreate(Test_PingTask, "Ping", 4096, Done, 1, NULL);
+    SIM70XX_CHECK(SIM7020_Info_GetQuality(_Device, &Report) != SIM70XX_ERR_OK);
+    SIM70XX_CHECK(xSemaphoreTake(Done, 10000 / portTICK_PERIOD_MS) == pdTRUE);
+    SIM70XX_CHECK(_PingError == SIM70XX_ERR_OK);
+
+    SIM70XX_CHECK(SIM7020_Info_GetQuality(_Device, &Report) == SIM70XX_ERR_OK);
+
+    vSemaphoreDelete(Done);
+}
+
+int main(void)
+{
+    SIM70XX_Host_Modem_t Modem;
+    SIM7020_Config_t Config = SIM70XX_DEFAULT_CONF_1NCE(UART_NUM_1, SIM_BAUD_115200, GPIO_NUM_NC, GPIO_NUM_NC);
+
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    SIM70XX_CHECK(SIM70XX_Host_StartModem(&Modem, Config.UART.Interface, {"--device", "SIM7020", "--latency", "1", "--script", SIM70XX_HOST_SCRIPTS "/sim7020.json"}));
+
+    SIM70XX_CHECK(SIM7020_Init(_Device, Config) == SIM70XX_ERR_OK);
+    if(_Device.Internal.isInitialized)
+    {
+        SIM70XX_CHECK(SIM7020_Ping(_Device) == SIM70XX_ERR_OK);
+
+        Test_Consumer();
+        Test_Allocations();
+        Test_MQTT();
+        Test_Pool();
+        Test_HTTP();
+        Test_Faults();
+
+        SIM7020_Deinit(_Device);
+    }
+
+    SIM70XX_Host_StopModem(&Modem);
+
+    return SIM70XX_CHECK_RESULT();
+}
@@ -0,0 +1,101 @@
+ /*
+ * sim70xx_test_sim7080.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <string.h>
+
+#include "sim7080.h"
+
+#include "sim70xx_host_check.h"
+#include "sim70xx_host_modem.h"
+
+static SIM7080_t _Device;
+
+/** @brief  Check the TCP client. The simulated server sends the data back.
+ */
+static void Test_TCP(void)
+{
+    uint8_t Data[1500];
+    std::string Received;
+    SIM7080_TCP_Socket_t Socket = SIM7080_TCP_Socket_t();
+
+    for(size_t i = 0; i < sizeof(Data); i++)
+    {
+        Data[i] = i;
+    }
+
+    SIM70XX_CHECK(SIM7080_TCP_Client_Create(_Device, "192.168.0.1", 80, &Socket) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7080_TCP_Client_Connect(_Device, &Socket) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7080_TCP_Client_Transmit(_Device, &Socket, Data, sizeof(Data)) == SIM70XX_ERR_OK);
+
+    vTaskDelay(200 / portTICK_PERIOD_MS);
+    SIM70XX_CHECK(Socket.isDataReceived);
+    SIM70XX_CHECK(SIM7080_TCP_Client_Receive(_Device, &Socket, sizeof(Data), &Received) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK((Received.size() == sizeof(Data)) && (memcmp(Received.data(), Data, sizeof(Data)) == 0));
+
+    SIM70XX_CHECK(SIM7080_TCP_Client_Destroy(_Device, &Socket) == SIM70XX_ERR_OK);
+}
+
+/** @brief  Check the file system with a raw data transfer in both directions.
+ */
+static void Test_FS(void)
+{
+    char Buffer[16];
+
+    memset(Buffer, 0, sizeof(Buffer));
+    SIM70XX_CHECK(SIM7080_FS_Write(_Device, SIM7080_FS_PATH_CUSTOMER, "test.txt", "Hello\r\nWorld", 12) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7080_FS_Read(_Device, SIM7080_FS_PATH_CUSTOMER, "test.txt", Buffer, 12) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(strcmp(Buffer, "Hello\r\nWorld") == 0);
+
+    // The transmission of the largest file takes longer than the response timeout of the command.
+    std::vector<uint8_t> Large(10240, 0xAA);
+    std::vector<uint8_t> Read(Large.size(), 0x00);
+
+    SIM70XX_CHECK(SIM7080_FS_Write(_Device, SIM7080_FS_PATH_CUSTOMER, "large.bin", Large.data(), Large.size()) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM7080_FS_Read(_Device, SIM7080_FS_PATH_CUSTOMER, "large.bin", Read.data(), Read.size()) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(Read == Large);
+}
+
+int main(void)
+{
+    SIM70XX_Host_Modem_t Modem;
+    SIM7080_Config_t Config = SIM70XX_DEFAULT_CONF_1NCE(UART_NUM_1, SIM_BAUD_115200, GPIO_NUM_NC, GPIO_NUM_NC);
+
+    Config.Bandlist = {8, 20};
+
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    SIM70XX_CHECK(SIM70XX_Host_StartModem(&Modem, Config.UART.Interface, {"--device", "SIM7080", "--latency", "1"}));
+
+    SIM70XX_CHECK(SIM7080_Init(_Device, Config) == SIM70XX_ERR_OK);
+    if(_Device.Internal.isInitialized)
+    {
+        SIM70XX_CHECK(SIM7080_Ping(_Device) == SIM70XX_ERR_OK);
+
+        Test_TCP();
+        Test_FS();
+
+        SIM7080_Deinit(_Device);
+    }
+
+    SIM70XX_Host_StopModem(&Modem);
+
+    return SIM70XX_CHECK_RESULT();
+}
@@ -0,0 +1,243 @@
+ /*
+ * sim70xx_test_tools.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "sim70xx_tools.h"
+
+#include "sim70xx_host_check.h"
+
+/** @brief  Base64 test vectors from RFC 4648.
+ */
+static const struct
+{
+    const char* p_Input;
+    const char* p_Base64;
+} _Base64Vectors[] = {
+    {"", ""},
+    {"f", "Zg=="},
+    {"fo", "Zm8="},
+    {"foo", "Zm9v"},
+    {"foob", "Zm9vYg=="},
+    {"fooba", "Zm9vYmE="},
+    {"foobar", "Zm9vYmFy"},
+};
+
+/** @brief          Create test data with all byte values.
+ *  @param Length   Number of bytes
+ *  @return         Test data
+ */
+static std::vector<uint8_t> Test_GetData(size_t Length)
+{
+    std::vector<uint8_t> Data(Length);
+
+    for(size_t i = 0; i < Length; i++)
+    {
+        Data[i] = (uint8_t)((i * 167) + 13);
+    }
+
+    return Data;
+}
+
+/** @brief          Decode a Base64 string with padding. The driver has no Base64 decoder, because the modules don´t send Base64 data.
+ *  @param Base64   Base64 string
+ *  @param p_Data   Pointer to output data
+ *  @return         #true when successful
+ */
+static bool Test_FromBase64(const std::string& Base64, std::vector<uint8_t>* p_Data)
+{
+    static const std::string Digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    p_Data->clear();
+    if((Base64.size() % 4) != 0)
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < Base64.size(); i += 4)
+    {
+        uint32_t Group = 0;
+        uint32_t Padding = 0;
+
+        for(size_t j = 0; j < 4; j++)
+        {
+            size_t Value;
+
+            if(Base64[i + j] == '=')
+            {
+                Value = 0;
+                Padding++;
+            }
+            else if(((Value = Digits.find(Base64[i + j])) == std::string::npos) || (Padding > 0))
+            {
+                return false;
+            }
+
+            Group = (Group << 6) | Value;
+        }
+
+        p_Data->push_back((uint8_t)(Group >> 16));
+        if(Padding < 2)
+        {
+            p_Data->push_back((uint8_t)(Group >> 8));
+        }
+        if(Padding < 1)
+        {
+            p_Data->push_back((uint8_t)Group);
+        }
+    }
+
+    return true;
+}
+
+/** @brief  Check the hex encoder and decoder with all lengths around the four byte words of the encoder.
+ */
+static void Test_Hex(void)
+{
+    std::string Hex;
+    uint8_t Buffer[64];
+    std::vector<uint8_t> Data = Test_GetData(sizeof(Buffer));
+
+    SIM70XX_Tools_ASCII2Hex("\x00\x1F\xA0\xFF", 4, &Hex);
+    SIM70XX_CHECK(Hex == "001fa0ff");
+
+    // Every byte value in every position of a word must produce the same lower case digits as printf.
+    for(uint32_t Value = 0; Value < 256; Value++)
+    {
+        char Expected[9];
+        uint8_t Word[4] = {(uint8_t)Value, (uint8_t)~Value, (uint8_t)(Value * 7), (uint8_t)(Value ^ 0x5A)};
+
+        snprintf(Expected, sizeof(Expected), "%02x%02x%02x%02x", Word[0], Word[1], Word[2], Word[3]);
+        SIM70XX_Tools_ASCII2Hex(Word, sizeof(Word), &Hex);
+        SIM70XX_CHECK(Hex == Expected);
+    }
+
+    for(size_t Length = 0; Length <= Data.size(); Length++)
+    {
+        memset(Buffer, 0, sizeof(Buffer));
+
+        SIM70XX_Tools_ASCII2Hex(Data.data(), Length, &Hex);
+        SIM70XX_CHECK(Hex.size() == (2 * Length));
+        SIM70XX_CHECK(SIM70XX_Tools_HexDecode(Hex.c_str(), Hex.size(), Buffer) == SIM70XX_ERR_OK);
+        SIM70XX_CHECK(memcmp(Buffer, Data.data(), Length) == 0);
+    }
+
+    // Upper case digits are accepted.
+    SIM70XX_CHECK((SIM70XX_Tools_HexDecode("A0fF", 4, Buffer) == SIM70XX_ERR_OK) && (Buffer[0] == 0xA0) && (Buffer[1] == 0xFF));
+}
+
+/** @brief  Check that the hex decoder rejects invalid input and reports the position.
+ */
+static void Test_HexInvalid(void)
+{
+    size_t Position;
+    uint8_t Buffer[4];
+
+    // An odd number of characters is rejected without changing the buffer.
+    memset(Buffer, 0x55, sizeof(Buffer));
+    Position = 0;
+    SIM70XX_CHECK(SIM70XX_Tools_HexDecode("a0f", 3, Buffer, &Position) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK((Position == 3) && (Buffer[0] == 0x55));
+    SIM70XX_CHECK(SIM70XX_Tools_HexDecode("a", 1, Buffer, &Position) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(Position == 1);
+
+    // Invalid characters in the high and in the low digit.
+    SIM70XX_CHECK(SIM70XX_Tools_HexDecode("a0g1", 4, Buffer, &Position) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(Position == 2);
+    SIM70XX_CHECK(SIM70XX_Tools_HexDecode("a01G", 4, Buffer, &Position) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(Position == 3);
+
+    // Characters which are next to the digits or which become digits when bit 5 is set.
+    for(const char c : std::string(" /:@G`g\x01\x0A\x80\xC1\xE1", 12))
+    {
+        char Hex[2] = {'0', c};
+
+        SIM70XX_CHECK(SIM70XX_Tools_HexDecode(Hex, 2, Buffer, &Position) == SIM70XX_ERR_INVALID_ARG);
+        SIM70XX_CHECK(Position == 1);
+    }
+
+    SIM70XX_CHECK(SIM70XX_Tools_HexDecode(NULL, 2, Buffer) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(SIM70XX_Tools_HexDecode("00", 2, NULL) == SIM70XX_ERR_INVALID_ARG);
+}
+
+/** @brief  Check the Base64 encoder with the RFC 4648 test vectors and a round trip.
+ */
+static void Test_Base64(void)
+{
+    std::string Base64;
+    std::vector<uint8_t> Decoded;
+    std::vector<uint8_t> Data = Test_GetData(100);
+
+    for(const auto& Vector : _Base64Vectors)
+    {
+        SIM70XX_CHECK(SIM70XX_Tools_ToBase64(Vector.p_Input, strlen(Vector.p_Input), &Base64));
+        SIM70XX_CHECK(Base64 == Vector.p_Base64);
+    }
+
+    for(size_t Length = 0; Length <= Data.size(); Length++)
+    {
+        SIM70XX_CHECK(SIM70XX_Tools_ToBase64(Data.data(), Length, &Base64));
+        SIM70XX_CHECK(Base64.size() == SIM70XX_TOOLS_BASE64_LENGTH(Length));
+        SIM70XX_CHECK(Test_FromBase64(Base64, &Decoded) && (Decoded == std::vector<uint8_t>(Data.begin(), Data.begin() + Length)));
+    }
+}
+
+/** @brief  Check that the incremental Base64 encoder creates the same string for all splits of the input.
+ */
+static void Test_Base64Incremental(void)
+{
+    std::string Expected;
+    std::vector<uint8_t> Data = Test_GetData(32);
+
+    SIM70XX_Tools_ToBase64(Data.data(), Data.size(), &Expected);
+
+    for(size_t First = 0; First <= Data.size(); First++)
+    {
+        for(size_t Second = First; Second <= Data.size(); Second++)
+        {
+            size_t Written;
+            char Base64[SIM70XX_TOOLS_BASE64_LENGTH(32) + 8];
+            SIM70XX_Base64_t Context;
+
+            SIM70XX_Tools_Base64Init(&Context);
+            Written = SIM70XX_Tools_Base64Update(&Context, Data.data(), First, Base64);
+            Written += SIM70XX_Tools_Base64Update(&Context, Data.data() + First, Second - First, &Base64[Written]);
+            Written += SIM70XX_Tools_Base64Update(&Context, Data.data() + Second, Data.size() - Second, &Base64[Written]);
+            Written += SIM70XX_Tools_Base64Final(&Context, &Base64[Written]);
+
+            SIM70XX_CHECK(std::string(Base64, Written) == Expected);
+        }
+    }
+}
+
+int main(void)
+{
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    Test_Hex();
+    Test_HexInvalid();
+    Test_Base64();
+    Test_Base64Incremental();
+
+    return SIM70XX_CHECK_RESULT();
+}
@@ -0,0 +1,201 @@
+ /*
+ * sim70xx_test_urc.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#include "Private/Events/sim70xx_urc.h"
+#include "Private/Events/sim70xx_mailbox.h"
+
+#include "sim70xx_host_check.h"
+
+static std::string _Handled;
+static SIM70XX_Error_t _WaitError;
+
+/** @brief              Test handler which remembers the message.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to message
+ */
+static void Test_on_First(void* p_Device, std::string* p_Message)
+{
+    _Handled = "First:" + *p_Message;
+}
+
+/** @brief              Second test handler which remembers the message.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to message
+ */
+static void Test_on_Second(void* p_Device, std::string* p_Message)
+{
+    _Handled = "Second:" + *p_Message;
+}
+
+/** @brief  Check the dispatching of messages to the registered handlers.
+ */
+static void Test_Dispatch(void)
+{
+    std::string Message;
+
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CSOERR", Test_on_First) == SIM70XX_ERR_OK);
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CMQPUB", Test_on_Second) == SIM70XX_ERR_OK);
+
+    Message = "+CSOERR: 0,4";
+    SIM70XX_CHECK(SIM70XX_URC_Dispatch(NULL, &Message) && (_Handled == "First:+CSOERR: 0,4"));
+    Message = "+CMQPUB: 0,\"test\"";
+    SIM70XX_CHECK(SIM70XX_URC_Dispatch(NULL, &Message) && (_Handled == "Second:+CMQPUB: 0,\"test\""));
+
+    // Messages which are shorter than a prefix or which don´t start with a prefix are not handled.
+    _Handled.clear();
+    Message = "+CSO";
+    SIM70XX_CHECK(!SIM70XX_URC_Dispatch(NULL, &Message) && _Handled.empty());
+    Message = "OK";
+    SIM70XX_CHECK(!SIM70XX_URC_Dispatch(NULL, &Message) && _Handled.empty());
+    SIM70XX_CHECK(SIM70XX_URC_isRegistered("+CSOERR: 1,4"));
+    SIM70XX_CHECK(!SIM70XX_URC_isRegistered("+CSQ: 20,0"));
+
+    // Registering the same prefix again replaces the handler.
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CSOERR", Test_on_Second) == SIM70XX_ERR_OK);
+    Message = "+CSOERR: 0,4";
+    SIM70XX_CHECK(SIM70XX_URC_Dispatch(NULL, &Message) && (_Handled == "Second:+CSOERR: 0,4"));
+
+    SIM70XX_URC_Unregister("+CSOERR");
+    SIM70XX_URC_Unregister("+CMQPUB");
+    SIM70XX_CHECK(!SIM70XX_URC_isRegistered("+CSOERR: 0,4"));
+    SIM70XX_CHECK(!SIM70XX_URC_isRegistered("+CMQPUB: 0,\"test\""));
+}
+
+/** @brief  Check that invalid and overlapping prefixes are rejected, because they would break the binary search.
+ */
+static void Test_Overlap(void)
+{
+    std::string Message;
+
+    SIM70XX_CHECK(SIM70XX_URC_Register(NULL, Test_on_First) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(SIM70XX_URC_Register("", Test_on_First) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CMQPUB", NULL) == SIM70XX_ERR_INVALID_ARG);
+
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CMQPUB", Test_on_First) == SIM70XX_ERR_OK);
+
+    // A longer prefix which starts with a registered prefix.
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CMQPUBX", Test_on_Second) == SIM70XX_ERR_INVALID_ARG);
+
+    // A shorter prefix which is the beginning of a registered prefix.
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CMQ", Test_on_Second) == SIM70XX_ERR_INVALID_ARG);
+    SIM70XX_CHECK(SIM70XX_URC_Register("+", Test_on_Second) == SIM70XX_ERR_INVALID_ARG);
+
+    // Prefixes which only share some characters don´t overlap.
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CMQDISCON", Test_on_Second) == SIM70XX_ERR_OK);
+
+    // The rejected prefixes must not change the handler of the registered prefix.
+    Message = "+CMQPUB: 0";
+    SIM70XX_CHECK(SIM70XX_URC_Dispatch(NULL, &Message) && (_Handled == "First:+CMQPUB: 0"));
+    Message = "+CMQDISCON: 0";
+    SIM70XX_CHECK(SIM70XX_URC_Dispatch(NULL, &Message) && (_Handled == "Second:+CMQDISCON: 0"));
+
+    SIM70XX_URC_Unregister("+CMQPUB");
+    SIM70XX_URC_Unregister("+CMQDISCON");
+
+    // The prefix can be registered after the overlapping prefixes are removed.
+    SIM70XX_CHECK(SIM70XX_URC_Register("+CMQ", Test_on_Second) == SIM70XX_ERR_OK);
+    SIM70XX_URC_Unregister("+CMQ");
+}
+
+/** @brief  Check that a full handler table is reported.
+ */
+static void Test_Full(void)
+{
+    std::string Prefixes[CONFIG_SIM70XX_URC_COUNT + 1];
+
+    for(uint32_t i = 0; i <= CONFIG_SIM70XX_URC_COUNT; i++)
+    {
+        Prefixes[i] = "+URC" + std::to_string(100 + i) + ":";
+    }
+
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_URC_COUNT; i++)
+    {
+        SIM70XX_CHECK(SIM70XX_URC_Register(Prefixes[i].c_str(), Test_on_First) == SIM70XX_ERR_OK);
+    }
+    SIM70XX_CHECK(SIM70XX_URC_Register(Prefixes[CONFIG_SIM70XX_URC_COUNT].c_str(), Test_on_First) == SIM70XX_ERR_NO_MEM);
+
+    // Replacing a handler doesn´t need a new entry.
+    SIM70XX_CHECK(SIM70XX_URC_Register(Prefixes[0].c_str(), Test_on_Second) == SIM70XX_ERR_OK);
+
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_URC_COUNT; i++)
+    {
+        SIM70XX_URC_Unregister(Prefixes[i].c_str());
+    }
+    SIM70XX_CHECK(SIM70XX_URC_Register(Prefixes[CONFIG_SIM70XX_URC_COUNT].c_str(), Test_on_First) == SIM70XX_ERR_OK);
+    SIM70XX_URC_Unregister(Prefixes[CONFIG_SIM70XX_URC_COUNT].c_str());
+}
+
+/** @brief          Wait for a mailbox event in a second task.
+ *  @param p_Arg    Pointer to completion handle
+ */
+static void Test_WaitTask(void* p_Arg)
+{
+    std::string Event;
+
+    _WaitError = SIM70XX_Mailbox_Wait("+CTEST", 1, &Event, 5000 / portTICK_PERIOD_MS);
+
+    xSemaphoreGive((SemaphoreHandle_t)p_Arg);
+    vTaskDelete(NULL);
+}
+
+/** @brief  Check that #SIM70XX_Mailbox_WakeAll aborts only the running waits and doesn´t affect the following waits.
+ */
+static void Test_Mailbox(void)
+{
+    std::string Event;
+    std::string Message;
+    SemaphoreHandle_t Done;
+
+    SIM70XX_Mailbox_Init();
+    SIM70XX_CHECK(SIM70XX_Mailbox_Register("+CTEST", true) == SIM70XX_ERR_OK);
+
+    Done = xSemaphoreCreateBinary();
+    xTaskCreate(Test_WaitTask, "Wait", 4096, Done, 1, NULL);
+    vTaskDelay(100 / portTICK_PERIOD_MS);
+    SIM70XX_Mailbox_WakeAll();
+    SIM70XX_CHECK(xSemaphoreTake(Done, 1000 / portTICK_PERIOD_MS) == pdTRUE);
+    SIM70XX_CHECK(_WaitError == SIM70XX_ERR_INVALID_STATE);
+    vSemaphoreDelete(Done);
+
+    // A wake up without waiting tasks is lost.
+    SIM70XX_Mailbox_WakeAll();
+    SIM70XX_CHECK(SIM70XX_Mailbox_Wait("+CTEST", 1, &Event, 50 / portTICK_PERIOD_MS) == SIM70XX_ERR_TIMEOUT);
+
+    Message = "+CTEST: 1,A";
+    SIM70XX_CHECK(SIM70XX_URC_Dispatch(NULL, &Message));
+    SIM70XX_CHECK((SIM70XX_Mailbox_Wait("+CTEST", 1, &Event, 50 / portTICK_PERIOD_MS) == SIM70XX_ERR_OK) && (Event == "+CTEST: 1,A"));
+}
+
+int main(void)
+{
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+    Test_Dispatch();
+    Test_Overlap();
+    Test_Full();
+    Test_Mailbox();
+
+    return SIM70XX_CHECK_RESULT();
+}
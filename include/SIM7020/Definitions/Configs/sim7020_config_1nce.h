@@ -30,8 +30,11 @@
                                                                         .UART = {                                           \
                                                                             .Rx = Pin_Rx,                                   \
                                                                             .Tx = Pin_Tx,                                   \
+                                                                            .Rts = GPIO_NUM_NC,                             \
+                                                                            .Cts = GPIO_NUM_NC,                             \
+                                                                            .isFlowControl = false,                         \
                                                                             .Interface = Serial,                            \
-                                                                            .Lock = NULL,                                   \
+                                                                            .TxLock = NULL,                                 \
                                                                             .Baudrate = Baud,                               \
                                                                             .isInitialized = false,                         \
                                                                         },                                                  \
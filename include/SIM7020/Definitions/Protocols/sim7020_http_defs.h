@@ -24,6 +24,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifndef CONFIG_SIM70XX_HTTP_POOL_SIZE
+    #define CONFIG_SIM70XX_HTTP_POOL_SIZE           2
+#endif
+
+#ifndef CONFIG_SIM70XX_HTTP_POOL_IDLE_TIMEOUT
+    #define CONFIG_SIM70XX_HTTP_POOL_IDLE_TIMEOUT   60
+#endif
+
 /** @brief 
  */
 #define SIM7020_HTTP_MAX_PAYLOAD                    20000UL
@@ -50,6 +58,23 @@ typedef enum
     SIM7020_HTTP_REQ_DELETE,                         /**< HTTP DELETE method. */
 } SIM7020_HTTP_Method_t;
 
+/** @brief          Reader for the payload of a HTTP request. The reader is called for each data packet of the request.
+ *  @param p_Arg    User argument
+ *  @param p_Buffer Pointer to packet buffer
+ *  @param Size     Number of bytes, which must be written into the buffer
+ *  @return         Number of bytes written into the buffer
+ *                  NOTE: Less bytes than requested will abort the request.
+ */
+typedef size_t (*SIM7020_HTTP_Reader_t)(void* p_Arg, uint8_t* p_Buffer, size_t Size);
+
+/** @brief          Writer for the content of a HTTP response. The writer is called for each decoded block of the content.
+ *  @param p_Arg    User argument
+ *  @param p_Data   Pointer to content block
+ *  @param Length   Length of the content block
+ *  @return         #false to abort the request
+ */
+typedef bool (*SIM7020_HTTP_Writer_t)(void* p_Arg, const uint8_t* p_Data, size_t Length);
+
 /** @brief SIM7020 HTTP Socket object.
  */
 typedef struct
@@ -66,4 +91,13 @@ typedef struct
                                                          NOTE: Handled by the device driver. */
 } SIM7020_HTTP_Socket_t;
 
+/** @brief SIM7020 HTTP connection pool entry object.
+ */
+typedef struct
+{
+    SIM7020_HTTP_Socket_t Socket;                   /**< Pooled HTTP(S) socket. */
+    unsigned long LastUsed;                         /**< Timestamp of the last release in milliseconds. */
+    bool isUsed;                                    /**< #true when the socket is acquired by the application. */
+} SIM7020_HTTP_Pool_Entry_t;
+
 #endif /* SIM7020_HTTP_DEFS_H_ */
\ No newline at end of file
@@ -173,6 +173,8 @@ typedef struct
         {
             std::vector<SIM7020_HTTP_Socket_t*> Sockets;    /**< List with pointer to connected HTTP sockets.
                                                                  NOTE: Managed by the device driver. */
+            std::vector<SIM7020_HTTP_Pool_Entry_t*> Pool;   /**< Connection pool with reusable HTTP sockets.
+                                                                 NOTE: Managed by the device driver. */
         } HTTP;
     #endif
     #ifdef CONFIG_SIM70XX_DRIVER_WITH_MQTT
@@ -195,11 +197,9 @@ typedef struct
     #endif
     struct
     {
-        QueueHandle_t RxQueue;                              /**< Message receive (Module -> ESP32) queue.
-                                                                 NOTE: Managed by the device driver. */
-        QueueHandle_t TxQueue;                              /**< Message transmit (ESP32 -> Module) queue.
+        SIM70XX_TxQueue_t TxQueue;                          /**< Message transmit (ESP32 -> Module) queue.
                                                                  NOTE: Managed by the device driver. */
-        QueueHandle_t EventQueue;                           /**< Asynchronous event queue.
+        QueueSetHandle_t QueueSet;                          /**< Queue set used by the communication task to wait for commands and UART events.
                                                                  NOTE: Managed by the device driver. */
         bool isInitialized;                                 /**< #true when the module is initialized and ready to use.
                                                                  NOTE: Managed by the device driver. */
@@ -72,12 +72,108 @@ SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_
  */
 SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, const void* p_Buffer, uint32_t Length, uint16_t* p_ResponseCode = NULL);
 
-/** @brief                  
+/** @brief                  Start a new HTTP(S) post request and pass the response body to a writer.
  *  @param p_Device         SIM7020 device object
  *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param ContentType      Content type
+ *  @param Header           Request header
+ *  @param p_Buffer         Pointer to data buffer
+ *  @param Length           Buffer length
+ *  @param Writer           Content writer for the response body
+ *  @param p_WriterArg      (Optional) User argument for the writer
+ *  @param p_ResponseLength (Optional) Pointer to content length of the response body
+ *  @param p_ResponseCode   (Optional) Pointer to response code
+ *  @return                 SIM70XX_ERR_OK when successful
+ *                          SIM70XX_ERR_FAIL when the response body is invalid or when the writer has failed
+ */
+SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, const void* p_Buffer, uint32_t Length,
+                                  SIM7020_HTTP_Writer_t Writer, void* p_WriterArg, uint32_t* p_ResponseLength = NULL, uint16_t* p_ResponseCode = NULL);
+
+/** @brief                  Start a new HTTP(S) post request. The payload is read in small packets from a reader (i.e. from a file or from the flash),
+ *                          so the payload doesn´t have to be stored in the memory.
+ *                          NOTE: The next packet is read after the module has acknowledged the previous packet. The request must be
+ *                                repeated with a new connection when the reader fails, because the module has already received the total length.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param ContentType      Content type
+ *  @param Header           Request header
+ *  @param Reader           Payload reader
+ *  @param p_Arg            (Optional) User argument for the reader
+ *  @param Length           Total payload length
+ *  @param p_ResponseCode   (Optional) Pointer to response code
+ *  @return                 SIM70XX_ERR_OK when successful
+ *                          SIM70XX_ERR_FAIL when the reader has failed
+ */
+SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, SIM7020_HTTP_Reader_t Reader, void* p_Arg, uint32_t Length, uint16_t* p_ResponseCode = NULL);
+
+/** @brief                  Start a new HTTP(S) post request with a payload reader and pass the response body to a writer.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param ContentType      Content type
+ *  @param Header           Request header
+ *  @param Reader           Payload reader
+ *  @param p_ReaderArg      (Optional) User argument for the reader
+ *  @param Length           Total payload length
+ *  @param Writer           Content writer for the response body
+ *  @param p_WriterArg      (Optional) User argument for the writer
+ *  @param p_ResponseLength (Optional) Pointer to content length of the response body
+ *  @param p_ResponseCode   (Optional) Pointer to response code
+ *  @return                 SIM70XX_ERR_OK when successful
+ *                          SIM70XX_ERR_FAIL when the reader or the writer has failed or when the response body is invalid
+ */
+SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, SIM7020_HTTP_Reader_t Reader, void* p_ReaderArg, uint32_t Length,
+                                  SIM7020_HTTP_Writer_t Writer, void* p_WriterArg, uint32_t* p_ResponseLength = NULL, uint16_t* p_ResponseCode = NULL);
+
+/** @brief                  Read the content of a HTTP(S) response. All parts of the content are passed to the writer in the order of reception.
+ *                          NOTE: Use this function after a POST request without a writer to read the response body. The function waits for the
+ *                          socket timeout when the response doesn´t contain a body.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Writer           Content writer
+ *  @param p_Arg            (Optional) User argument for the writer
+ *  @param p_Length         (Optional) Pointer to content length
+ *  @return                 SIM70XX_ERR_OK when successful
+ *                          SIM70XX_ERR_FAIL when the content is invalid or incomplete (i.e. parts were dropped, because the writer was too slow)
+ *                          or when the writer has failed
+ */
+SIM70XX_Error_t SIM7020_HTTP_ReadResponse(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, SIM7020_HTTP_Writer_t Writer, void* p_Arg, uint32_t* p_Length = NULL);
+
+/** @brief                  Transmit a HTTP(S) GET request and pass the content to a writer.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param Writer           Content writer
+ *  @param p_Arg            (Optional) User argument for the writer
+ *  @param p_Length         (Optional) Pointer to content length
+ *  @param p_ResponseCode   (Optional) Pointer to response code
+ *  @return                 SIM70XX_ERR_OK when successful
+ *                          SIM70XX_ERR_FAIL when the content is invalid or when the writer has failed
+ */
+SIM70XX_Error_t SIM7020_HTTP_GET(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, SIM7020_HTTP_Writer_t Writer, void* p_Arg, uint32_t* p_Length = NULL, uint16_t* p_ResponseCode = NULL);
+
+/** @brief                  Transmit a HTTP(S) GET request and copy the content into a buffer.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param p_Buffer         Pointer to data buffer
+ *  @param Size             Size of the data buffer
+ *  @param p_Length         Pointer to content length
+ *  @param p_ResponseCode   (Optional) Pointer to response code
+ *  @return                 SIM70XX_ERR_OK when successful
+ *                          SIM70XX_ERR_FAIL when the buffer is too small
+ */
+SIM70XX_Error_t SIM7020_HTTP_GET(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, uint8_t* p_Buffer, uint32_t Size, uint32_t* p_Length, uint16_t* p_ResponseCode = NULL);
+
+/** @brief                  Transmit a HTTP(S) GET request and copy the content into a dynamic buffer.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
  *  @param p_Buffer         Pointer to data buffer
  *                          NOTE: The memory for the buffer is dynamic memory and must be freed after usage!
- *  @param p_Length         Payload length
+ *  @param p_Length         Pointer to content length
  *  @param p_ResponseCode   (Optional) Pointer to response code
  *  @return                 SIM70XX_ERR_OK when successful
  */
@@ -110,4 +206,36 @@ SIM70XX_Error_t SIM7020_HTTP_DestroyAllSockets(SIM7020_t& p_Device);
  */
 void SIM7020_HTTP_AddToHeader(std::string Key, std::string Value, std::string* p_Header);
 
+/** @brief          Get a connected HTTP(S) socket for a host from the connection pool. An idle connection to the same host is reused
+ *                  and reconnected when it was closed by the remote host. A new connection is opened otherwise.
+ *                  NOTE: The socket must be returned with #SIM7020_HTTP_Release. Don´t disconnect or destroy the socket.
+ *  @param p_Device SIM7020 device object
+ *  @param Host     Host address
+ *  @param p_Socket Pointer to HTTP(S) socket object pointer
+ *  @param Timeout  (Optional) Socket timeout
+ *  @return         SIM70XX_ERR_OK when successful
+ *                  SIM70XX_ERR_NO_MEM when all sockets of the pool are in use
+ */
+SIM70XX_Error_t SIM7020_HTTP_Acquire(SIM7020_t& p_Device, std::string Host, SIM7020_HTTP_Socket_t** p_Socket, uint16_t Timeout = 60);
+
+/** @brief          Return a HTTP(S) socket to the connection pool. The connection is kept open for the next request.
+ *  @param p_Device SIM7020 device object
+ *  @param p_Socket Pointer to HTTP(S) socket object
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM7020_HTTP_Release(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket);
+
+/** @brief          Close all connections of the connection pool, which are unused for longer than #CONFIG_SIM70XX_HTTP_POOL_IDLE_TIMEOUT.
+ *                  NOTE: Call this function periodically to close idle connections when no new requests are made.
+ *  @param p_Device SIM7020 device object
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM7020_HTTP_Evict(SIM7020_t& p_Device);
+
+/** @brief          Close all unused connections of the connection pool.
+ *  @param p_Device SIM7020 device object
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM7020_HTTP_ClosePool(SIM7020_t& p_Device);
+
 #endif /* SIM7020_HTTP_H_ */
\ No newline at end of file
@@ -230,4 +230,19 @@ SIM70XX_Error_t SIM7020_Ping(SIM7020_t& p_Device);
  */
 SIM70XX_Error_t SIM7020_SetBaudrate(SIM7020_t& p_Device, SIM70XX_Baud_t Old, SIM70XX_Baud_t New);
 
+/** @brief              Find the current baudrate of the module and switch the module and the interface to the highest baudrate
+ *                      which passes the integrity and throughput test. The baudrate is stored in the module.
+ *                      NOTE: This function is called by the initialization when the baudrate in the configuration is #SIM_BAUD_AUTO.
+ *  @param p_Device     SIM7020 device object
+ *  @param p_Baudrate   (Optional) Pointer to selected baudrate
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM7020_AutoBaud(SIM7020_t& p_Device, SIM70XX_Baud_t* p_Baudrate = NULL);
+
+/** @brief          Get the statistics of the device driver.
+ *  @param p_Device SIM7020 device object
+ *  @param p_Stats  Pointer to statistics object
+ */
+void SIM7020_GetStatistics(SIM7020_t& p_Device, SIM70XX_Statistics_t* p_Stats);
+
 #endif /* SIM7020_H_ */
\ No newline at end of file
@@ -166,11 +166,9 @@ typedef struct
     #endif
     struct
     {
-        QueueHandle_t RxQueue;                              /**< Message receive (Module -> ESP32) queue.
+        SIM70XX_TxQueue_t TxQueue;                          /**< Message transmit (ESP32 -> Module) queue.
                                                                  NOTE: Managed by the device driver. */
-        QueueHandle_t TxQueue;                              /**< Message transmit (ESP32 -> Module) queue.
-                                                                 NOTE: Managed by the device driver. */
-        QueueHandle_t EventQueue;                           /**< Asynchronous event queue.
+        QueueSetHandle_t QueueSet;                          /**< Queue set used by the communication task to wait for commands and UART events.
                                                                  NOTE: Managed by the device driver. */
         bool isInitialized;                                 /**< #true when the module is initialized and ready to use.
                                                                  NOTE: Managed by the device driver. */
@@ -240,4 +240,19 @@ bool SIM7080_isSIMReady(SIM7080_t& p_Device);
  */
 SIM70XX_Error_t SIM7080_Ping(SIM7080_t& p_Device);
 
+/** @brief              Find the current baudrate of the module and switch the module and the interface to the highest baudrate
+ *                      which passes the integrity and throughput test. The baudrate is stored in the module.
+ *                      NOTE: This function is called by the initialization when the baudrate in the configuration is #SIM_BAUD_AUTO.
+ *  @param p_Device     SIM7080 device object
+ *  @param p_Baudrate   (Optional) Pointer to selected baudrate
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM7080_AutoBaud(SIM7080_t& p_Device, SIM70XX_Baud_t* p_Baudrate = NULL);
+
+/** @brief          Get the statistics of the device driver.
+ *  @param p_Device SIM7080 device object
+ *  @param p_Stats  Pointer to statistics object
+ */
+void SIM7080_GetStatistics(SIM7080_t& p_Device, SIM70XX_Statistics_t* p_Stats);
+
 #endif /* SIM7080_H_ */
\ No newline at end of file
@@ -20,13 +20,30 @@
 #ifndef SIM70XX_DEFS_H_
 #define SIM70XX_DEFS_H_
 
-#include <driver/gpio.h>
-#include <driver/uart.h>
+#include <sdkconfig.h>
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+    /** @brief Interface and pin types for the host build.
+     *         NOTE: The serial interfaces are served by the POSIX port of the driver.
+     */
+    typedef int uart_port_t;
+    typedef int gpio_num_t;
+
+    #define UART_NUM_0                                  0
+    #define UART_NUM_1                                  1
+    #define UART_NUM_2                                  2
+    #define UART_NUM_MAX                                3
+    #define GPIO_NUM_NC                                 -1
+#else
+    #include <driver/gpio.h>
+    #include <driver/uart.h>
+#endif
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/event_groups.h>
 #include <freertos/queue.h>
+#include <freertos/semphr.h>
 
 #include <string>
 #include <stdint.h>
@@ -74,6 +91,119 @@ typedef enum
     SIM_MODE_BOTH       = 4,                        /**< Manual / Automatic. If manual fails, automatic mode is entered. */
 } SIM70XX_OpMode_t;
 
+/** @brief Number of transmit queue lanes.
+ */
+#define SIM70XX_LANE_COUNT                              2
+
+/** @brief SIM70XX transmit queue lane definitions.
+ */
+typedef enum
+{
+    SIM70XX_LANE_CONTROL = 0,                       /**< Control commands. These commands are always transmitted first. */
+    SIM70XX_LANE_BULK,                              /**< Commands with data transfers. */
+} SIM70XX_Lane_t;
+
+/** @brief SIM70XX transmit queue object definition.
+ */
+typedef struct
+{
+    QueueHandle_t Lanes[SIM70XX_LANE_COUNT];        /**< Command queue of each lane. */
+} SIM70XX_TxQueue_t;
+
+/** @brief SIM70XX payload encodings.
+ */
+typedef enum
+{
+    SIM70XX_ENC_RAW     = 0,                        /**< The data are transmitted without conversion. */
+    SIM70XX_ENC_HEX,                                /**< The data are transmitted as hex string. The string is twice as long as the data. */
+    SIM70XX_ENC_BASE64,                             /**< The data are transmitted as Base64 string with padding. */
+} SIM70XX_Encoding_t;
+
+/** @brief SIM70XX incremental Base64 encoder object definition.
+ */
+typedef struct
+{
+    uint8_t Pending[3];                             /**< Input bytes which doesn´t form a complete group of three bytes. */
+    uint8_t PendingLength;                          /**< Number of pending input bytes. */
+} SIM70XX_Base64_t;
+
+/** @brief Number of buckets in the command round-trip histogram.
+ */
+#define SIM70XX_STATS_LATENCY_BUCKETS                   12
+
+/** @brief SIM70XX driver statistics object definition.
+ *         NOTE: The counters are never reset. Subtract two snapshots to get the values for a time interval.
+ */
+typedef struct
+{
+    uint32_t Used;                                  /**< Number of command objects in use. */
+    uint32_t Peak;                                  /**< Maximum number of command objects in use. */
+    uint32_t Exhausted;                             /**< Number of failed requests, because the command pool was exhausted. */
+    uint32_t Allocations;                           /**< Number of heap allocations of the driver. This are the buffers of the command pool, the event
+                                                         buffers of the mailboxes and the line buffer of the communication task, which have grown,
+                                                         because a command, a response or an event didn´t fit into the buffer.
+                                                         This value should stay constant while the driver is running.
+                                                         NOTE: Allocations of the event handlers (i.e. MQTT publish packets) are not counted. */
+    uint32_t Dropped;                               /**< Number of asynchronous messages which were dropped, because the event mailbox was full
+                                                         or because no mailbox was available. */
+    uint32_t FIFOOverflow;                          /**< Number of UART receive FIFO overflows. Received data are lost. */
+    uint32_t BufferFull;                            /**< Number of UART receive buffer overflows. Received data are lost. */
+    uint32_t LineOverflow;                          /**< Number of received lines which were discarded, because they are longer than
+                                                         #CONFIG_SIM70XX_UART_LINE_SIZE. */
+    uint32_t Commands;                              /**< Number of processed commands. */
+    uint32_t Timeouts;                              /**< Number of commands without an answer from the module. */
+    uint32_t LatencyMax;                            /**< Longest command round-trip time in ms. */
+    uint64_t LatencySum;                            /**< Sum of all command round-trip times in ms. Divide by the number of commands to get the average. */
+    uint32_t Latency[SIM70XX_STATS_LATENCY_BUCKETS];/**< Histogram of the command round-trip times, from pushing the command into the queue until it is completed.
+                                                         Bucket 0 counts the commands below 1 ms and bucket n the commands from 2^(n - 1) ms to 2^n - 1 ms.
+                                                         The last bucket counts all slower commands. */
+    uint64_t TxBytes;                               /**< Number of bytes transmitted to the module. */
+    uint64_t RxBytes;                               /**< Number of bytes received from the module. */
+    uint64_t RxCalls;                               /**< Number of calls into the receive path of the serial driver. Each call takes a lock of the
+                                                         UART driver. Divide by the received bytes to get the calls per byte. */
+} SIM70XX_Statistics_t;
+
+/** @brief Maximum length of the command or event name in a trace entry.
+ */
+#define SIM70XX_TRACE_TAG_LENGTH                        8
+
+/** @brief SIM70XX trace entry types.
+ */
+typedef enum
+{
+    SIM70XX_TRACE_TX    = 0,                        /**< Command transmitted to the module. */
+    SIM70XX_TRACE_RX,                               /**< Command completed by the module. */
+    SIM70XX_TRACE_RAW_TX,                           /**< Raw data transmitted to the module. */
+    SIM70XX_TRACE_RAW_RX,                           /**< Raw data received from the module. */
+    SIM70XX_TRACE_URC,                              /**< Asynchronous message received from the module. */
+    SIM70XX_TRACE_DISCARD,                          /**< Late response of an expired command discarded. */
+} SIM70XX_Trace_Type_t;
+
+/** @brief SIM70XX trace entry status codes.
+ */
+typedef enum
+{
+    SIM70XX_TRACE_NONE  = 0,                        /**< No status. */
+    SIM70XX_TRACE_OK,                               /**< The module has reported a success. */
+    SIM70XX_TRACE_ERROR,                            /**< The module has reported an error. */
+    SIM70XX_TRACE_TIMEOUT,                          /**< The module has not answered before the deadline. */
+    SIM70XX_TRACE_EXPIRED,                          /**< The command was not transmitted, because the deadline has expired. */
+} SIM70XX_Trace_Status_t;
+
+/** @brief SIM70XX trace entry object definition.
+ *         NOTE: The layout is fixed, because the entries are decoded on the host (20 bytes, little endian).
+ */
+typedef struct
+{
+    uint32_t Timestamp;                             /**< Time of the entry in us. The timestamp overflows after ~71 minutes. */
+    uint32_t Length;                                /**< Number of transmitted or received bytes. */
+    uint16_t Sequence;                              /**< Number of the command. Entries of the same command are using the same number. */
+    uint8_t Type;                                   /**< Entry type (see #SIM70XX_Trace_Type_t). */
+    uint8_t Status;                                 /**< Entry status (see #SIM70XX_Trace_Status_t). */
+    char Tag[SIM70XX_TRACE_TAG_LENGTH];             /**< Command or event name (i.e. "+CGATT").
+                                                         NOTE: Not terminated when the name uses all characters. */
+} SIM70XX_Trace_Entry_t;
+
 /** @brief SIM70XX Ping configuration object.
  */
 typedef struct
@@ -126,12 +256,35 @@ typedef struct
 {
     gpio_num_t Rx;                                  /**< Rx pin number. */
     gpio_num_t Tx;                                  /**< Tx pin number. */
+    gpio_num_t Rts;                                 /**< RTS pin number.
+                                                         NOTE: Only used when hardware flow control is enabled. */
+    gpio_num_t Cts;                                 /**< CTS pin number.
+                                                         NOTE: Only used when hardware flow control is enabled. */
+    bool isFlowControl;                             /**< Set to #true to enable RTS/CTS hardware flow control for the ESP32 and the module. */
     uart_port_t Interface;                          /**< Serial interface used by the device SIM70XX driver. */
-    SemaphoreHandle_t Lock;                         /**< */
+    SemaphoreHandle_t TxLock;                       /**< Transmit lock of the interface.
+                                                         NOTE: The receive path doesn´t use a lock, because only the communication task reads from the interface.
+                                                         NOTE: Managed by the device driver. */
+    TaskHandle_t Consumer;                          /**< Task which reads from the interface. #NULL when no communication task is running.
+                                                         NOTE: Managed by the device driver. */
+    QueueHandle_t EventQueue;                       /**< Event queue of the UART driver.
+                                                         NOTE: Managed by the device driver. */
     SIM70XX_Baud_t Baudrate;                        /**< Baud rate for the serial communication interface.
                                                          NOTE: Managed by the device driver. */
     bool isInitialized;                             /**< #true when the interface is initialized.
                                                          NOTE: Managed by the device driver. */
+    uint32_t FIFOOverflow;                          /**< Number of receive FIFO overflows.
+                                                         NOTE: Managed by the device driver. */
+    uint32_t BufferFull;                            /**< Number of receive buffer overflows.
+                                                         NOTE: Managed by the device driver. */
+    uint32_t LineOverflow;                          /**< Number of discarded overlong lines.
+                                                         NOTE: Managed by the device driver. */
+    uint64_t TxBytes;                               /**< Number of transmitted bytes.
+                                                         NOTE: Managed by the device driver. */
+    uint64_t RxBytes;                               /**< Number of received bytes.
+                                                         NOTE: Managed by the device driver. */
+    uint64_t RxCalls;                               /**< Number of calls into the receive path of the serial driver.
+                                                         NOTE: Managed by the device driver. */
 } SIM70XX_UART_Conf_t;
 
 #endif /* SIM70XX_DEFS_H_ */
\ No newline at end of file
@@ -20,8 +20,6 @@
 #ifndef SIM70XX_TOOLS_H_
 #define SIM70XX_TOOLS_H_
 
-#include <esp_attr.h>
-
 #include <string>
 #include <stdint.h>
 #include <stdbool.h>
@@ -38,6 +36,11 @@
                                                                 String.erase(std::remove(String.begin(), String.end(), '\r'), String.end());    \
                                                             } while(0);
 
+/** @brief          Get the length of a Base64 string with padding.
+ *  @param Length   Number of input bytes
+ */
+#define SIM70XX_TOOLS_BASE64_LENGTH(Length)                 ((((Length) + 2) / 3) * 4)
+
 /** @brief  Get the version number of the SIM70XX library.
  *  @return Library version
  */
@@ -50,10 +53,29 @@ const inline __attribute__((always_inline)) std::string SIM70XX_LibVersion(void)
     #endif
 }
 
+/** @brief          Convert a buffer into hexadecimal ASCII characters.
+ *                  NOTE: The output isn´t terminated.
+ *  @param p_Buffer Pointer to data buffer
+ *  @param Length   Buffer length
+ *  @param p_Hex    Pointer to output buffer
+ *                  NOTE: The buffer must be able to store 2 * Length characters.
+ */
+void SIM70XX_Tools_HexEncode(const void* const p_Buffer, size_t Length, char* const p_Hex);
+
+/** @brief              Convert hexadecimal ASCII characters into a buffer. Upper and lower case digits are accepted.
+ *  @param p_Hex        Pointer to hexadecimal characters
+ *  @param Length       Number of characters
+ *  @param p_Buffer     Pointer to output buffer
+ *                      NOTE: The buffer must be able to store Length / 2 bytes. The content of the buffer is undefined when the input is invalid.
+ *  @param p_Position   (Optional) Pointer to the position of the first invalid character or Length when the number of characters is odd
+ *  @return             SIM70XX_ERR_OK when successful
+ *                      SIM70XX_ERR_INVALID_ARG when the input contains an invalid character or an odd number of characters
+ */
+SIM70XX_Error_t SIM70XX_Tools_HexDecode(const char* const p_Hex, size_t Length, uint8_t* const p_Buffer, size_t* p_Position = NULL);
+
 /** @brief          Convert a buffer into a hexadecimal ASCII string.
  *  @param p_Buffer Pointer to data buffer
  *  @param Length   Buffer length
- *                  NOTE: Length must be a power of 2!
  *  @param p_Hex    Pointer to hexadecimal ASCII string
  */
 void SIM70XX_Tools_ASCII2Hex(const void* const p_Buffer, uint32_t Length, std::string* const p_Hex);
@@ -72,10 +94,49 @@ void SIM70XX_Tools_Hex2ASCII(std::string Hex, uint8_t* const p_Buffer);
  */
 bool SIM70XX_Tools_ToBase64(const void* const p_Buffer, uint32_t Length, std::string* const p_Base64);
 
-/** @brief  Get the milliseconds from the ESP timer.
+/** @brief              Start a new Base64 string.
+ *  @param p_Context    Pointer to encoder object
+ */
+void SIM70XX_Tools_Base64Init(SIM70XX_Base64_t* p_Context);
+
+/** @brief              Add data to a Base64 string. Input bytes which doesn´t form a complete group of three bytes are stored in the
+ *                      encoder object until the next call.
+ *                      NOTE: The output isn´t terminated.
+ *  @param p_Context    Pointer to encoder object
+ *  @param p_Buffer     Pointer to data buffer
+ *  @param Length       Buffer length
+ *  @param p_Base64     Pointer to output buffer
+ *                      NOTE: The buffer must be able to store #SIM70XX_TOOLS_BASE64_LENGTH(Length) characters.
+ *  @return             Number of characters written into the output buffer
+ */
+size_t SIM70XX_Tools_Base64Update(SIM70XX_Base64_t* p_Context, const void* const p_Buffer, size_t Length, char* const p_Base64);
+
+/** @brief              Finish a Base64 string. The pending input bytes are written with padding.
+ *  @param p_Context    Pointer to encoder object
+ *  @param p_Base64     Pointer to output buffer
+ *                      NOTE: The buffer must be able to store 4 characters.
+ *  @return             Number of characters written into the output buffer
+ */
+size_t SIM70XX_Tools_Base64Final(SIM70XX_Base64_t* p_Context, char* const p_Base64);
+
+/** @brief          Get the length of encoded data.
+ *  @param Encoding Encoding of the data
+ *  @param Length   Number of input bytes
+ *  @return         Number of output characters
+ */
+size_t SIM70XX_Tools_GetEncodedLength(SIM70XX_Encoding_t Encoding, size_t Length);
+
+/** @brief          Get the time to transmit data over the serial interface. Each byte is transmitted with 10 bits.
+ *  @param Baudrate Baud rate of the interface
+ *  @param Length   Number of bytes
+ *  @return         Transfer time in seconds (rounded up)
+ */
+uint32_t SIM70XX_Tools_GetTransferTime(SIM70XX_Baud_t Baudrate, size_t Length);
+
+/** @brief  Get the milliseconds from the system timer.
  *  @return Milliseconds since boot
  */
-unsigned long IRAM_ATTR SIM70XX_Tools_GetmsTimer(void);
+unsigned long SIM70XX_Tools_GetmsTimer(void);
 
 /** @brief          Enable the module.
  *  @param p_Config Pointer to SIM70XX UART configuration object
@@ -89,6 +150,7 @@ bool SIM70XX_Tools_EnableModule(SIM70XX_UART_Conf_t& p_Config, uint8_t Cycles =
 void SIM70XX_Tools_DisableModule(void);
 
 /** @brief          Check if the SIM70XX module is active.
+ *                  NOTE: The interface is used directly. Don´t use this function while a device driver is running.
  *  @param p_Config Pointer to SIM70XX UART configuration object
  *  @return         #true when the module is active
  */
@@ -99,8 +161,10 @@ bool SIM70XX_Tools_isActive(SIM70XX_UART_Conf_t& p_Config);
 void SIM70XX_Tools_ResetModule(void);
 
 /** @brief          Disable the echo mode of the SIM70XX module.
+ *                  NOTE: The interface is used directly. Don´t use this function while a device driver is running.
  *  @param p_Config Pointer to SIM70XX UART configuration object
  *  @return         SIM70XX_ERR_OK when successful
+ *                  SIM70XX_ERR_INVALID_STATE when the communication task of a device driver reads from the interface
  */
 SIM70XX_Error_t SIM70XX_Tools_DisableEcho(SIM70XX_UART_Conf_t& p_Config);
 
@@ -112,4 +176,35 @@ SIM70XX_Error_t SIM70XX_Tools_DisableEcho(SIM70XX_UART_Conf_t& p_Config);
  */
 std::string SIM70XX_Tools_SubstringSplitErase(std::string* p_Input, std::string Delimiter = ",");
 
+/** @brief          Estimate a percentile of the command round-trip times from the histogram of the driver statistics.
+ *  @param p_Stats  Driver statistics
+ *  @param Percent  Percentile (i.e. 50 or 99)
+ *  @return         Upper bound of the round-trip time in ms
+ */
+uint32_t SIM70XX_Tools_GetLatencyPercentile(const SIM70XX_Statistics_t& p_Stats, uint8_t Percent);
+
+/** @brief              Copy entries from the transaction trace. The entries are sorted from the oldest to the newest entry.
+ *                      NOTE: The trace must be enabled with CONFIG_SIM70XX_TRACE.
+ *  @param p_Entries    Pointer to entry buffer
+ *  @param Count        Size of the entry buffer
+ *  @param Offset       (Optional) Index of the first entry, counted from the oldest entry
+ *  @return             Number of copied entries
+ */
+size_t SIM70XX_Tools_GetTrace(SIM70XX_Trace_Entry_t* p_Entries, size_t Count, size_t Offset = 0);
+
+/** @brief  Print the transaction trace as hex dump to the console. The dump can be decoded with tools/sim70xx_trace.py.
+ *          NOTE: The trace must be enabled with CONFIG_SIM70XX_TRACE.
+ */
+void SIM70XX_Tools_PrintTrace(void);
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+    /** @brief              Connect a serial interface of the host build with an open file descriptor (i.e. a pseudo terminal or a socket pair).
+     *                      NOTE: Must be called before the device is initialized. The device from the configuration is used otherwise.
+     *  @param Interface    Serial interface
+     *  @param FD           File descriptor or -1 to use the device from the configuration
+     *  @return             SIM70XX_ERR_OK when successful
+     */
+    SIM70XX_Error_t SIM70XX_Tools_SetHostDevice(uart_port_t Interface, int FD);
+#endif
+
 #endif /* SIM70XX_TOOLS_H_ */
\ No newline at end of file
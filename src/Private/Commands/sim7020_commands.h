@@ -27,19 +27,20 @@
  * Used in SIM7020 device driver.
  * 
  */
-#define SIM7020_AT_MCGDEFCONT(Command)                          SIM70XX_CMD(Command, false, 60, 1)
-#define SIM7020_AT_COPS_W(Command)                              SIM70XX_CMD(Command, false, 300, 1)
+#define SIM7020_AT_MCGDEFCONT(Type, APN)                        SIM70XX_CMD_FMT(false, 60, 1, "AT*MCGDEFCONT=\"", Type, "\",\"", APN, "\"")
+#define SIM7020_AT_MCGDEFCONT_AUTH(Type, APN, User, Password)   SIM70XX_CMD_FMT(false, 60, 1, "AT*MCGDEFCONT=\"", Type, "\",\"", APN, "\",\"", User, "\",\"", Password, "\"")
+#define SIM7020_AT_COPS_W(Mode)                                 SIM70XX_CMD_FMT(false, 300, 1, "AT+COPS=", Mode)
+#define SIM7020_AT_COPS_W_OPERATOR(Mode, Format, Operator, AcT) SIM70XX_CMD_FMT(false, 300, 1, "AT+COPS=", Mode, ",", Format, ",\"", Operator, "\",", AcT)
 #define SIM7020_AT_COPS_R                                       SIM70XX_CMD("AT+COPS=?", true, 300, 1)
-#define SIM7020_AT_IPR_W(Baud)                                  SIM70XX_CMD("AT+IPR=" + std::to_string(Baud), false, 10, 1)
 
 /**
  * 
  * Used in SIM7020 PDP context device driver.
  * 
  */
-#define SIM7020_AT_CGACT_W(ID, Enable)                          SIM70XX_CMD("AT+CGACT=" + std::to_string(Enable) + "," + std::to_string(ID), false, 10, 1)
+#define SIM7020_AT_CGACT_W(ID, Enable)                          SIM70XX_CMD_FMT(false, 10, 1, "AT+CGACT=", Enable, ",", ID)
 #define SIM7020_AT_CGACT_R                                      SIM70XX_CMD("AT+CGACT?", true, 10, 1)
-#define SIM7020_AT_CGDEL(ID)                                    SIM70XX_CMD("AT+CGDEL=" + std::to_string(ID), true, 10, 1)
+#define SIM7020_AT_CGDEL(ID)                                    SIM70XX_CMD_FMT(true, 10, 1, "AT+CGDEL=", ID)
 #define SIM7020_AT_CGDCONT_R                                    SIM70XX_CMD("AT+CGDCONT?", true, 10, 1)
 
 /**
@@ -55,32 +56,33 @@
 #define SIM7020_AT_CIMI                                         SIM70XX_CMD("AT+CIMI", true, 1, 1)
 #define SIM7020_AT_CCID                                         SIM70XX_CMD("AT+CCID", true, 1, 1)
 #define SIM7020_AT_CGMR                                         SIM70XX_CMD("AT+CGMR", true, 1, 1)
-#define SIM7020_AT_CGCONTRDP_W(ID)                              SIM70XX_CMD("AT+CGCONTRDP=" + std::to_string(ID), true, 60, 1)
+#define SIM7020_AT_CGCONTRDP_W(ID)                              SIM70XX_CMD_FMT(true, 60, 1, "AT+CGCONTRDP=", ID)
 #define SIM7020_AT_CGCONTRDP                                    SIM70XX_CMD("AT+CGCONTRDP", true, 300, 1)
 #define SIM7020_AT_CGREG                                        SIM70XX_CMD("AT+CGREG?", true, 10, 1)
 #define SIM7020_AT_CSQ                                          SIM70XX_CMD("AT+CSQ", true, 1, 1)
 #define SIM7020_AT_CENG_R                                       SIM70XX_CMD("AT+CENG?", true, 1, 1)
-#define SIM7020_AT_CENG_W(Mode)                                 SIM70XX_CMD("AT+CENG=" + std::to_String(Mode), false, 1, 1)
+#define SIM7020_AT_CENG_W(Mode)                                 SIM70XX_CMD_FMT(false, 1, 1, "AT+CENG=", Mode)
 
 /**
  * 
  * Used in SIM7020 NVRAM driver.
  * 
  */
-#define SIM7020_AT_CNVMR(Key)                                   SIM70XX_CMD("AT+CNVMR=\"" + Key + "\"", true, 10, 1)
-#define SIM7020_AT_CNVMW(Key, Payload, Length)                  SIM70XX_CMD("AT+CNVMW=\"" + Key + "\",\"" + Payload + "\"," + std::to_string(Length), true, 10, 1)
+#define SIM7020_AT_CNVMR(Key)                                   SIM70XX_CMD_FMT(true, 10, 1, "AT+CNVMR=\"", Key, "\"")
+#define SIM7020_AT_CNVMW(Key, Payload, Length)                  SIM70XX_CMD_FMT(true, 10, 1, "AT+CNVMW=\"", Key, "\",\"", Payload, "\",", Length)
+#define SIM7020_AT_CNVMW_HEX(Key)                               SIM70XX_CMD_FMT(true, 10, 1, "AT+CNVMW=\"", Key, "\",\"")
 #define SIM7020_AT_CNVMGET                                      SIM70XX_CMD("AT+CNVMGET", true, 10, 0)
-#define SIM7020_AT_CNVMIVD(Key)                                 SIM70XX_CMD("AT+CNVMIVD=\"" + Key + "\"", true, 10, 1)
+#define SIM7020_AT_CNVMIVD(Key)                                 SIM70XX_CMD_FMT(true, 10, 1, "AT+CNVMIVD=\"", Key, "\"")
 
 /**
  * 
  * Used in SIM7020 Power Management driver.
  * 
  */
-#define SIM7020_AT_RETENTION(Enable)                            SIM70XX_CMD("AT+RETENTION=" + std::to_string(Enable), false, 10, 1)
-#define SIM7020_AT_CPSMS_DIS(Mode)                              SIM70XX_CMD("AT+CPSMS=" + std::to_string(Mode), false, 1, 1)
-#define SIM7020_AT_CPSMS_EN(TAU, Active)                        SIM70XX_CMD("AT+CPSMS=1,,,\"" + std::to_string(TAU) + "\",\"" + std::to_string(Active) + "\"", false, 1, 1)
-#define SIM7020_AT_CPSMSTATUS_W(Enable)                         SIM70XX_CMD("AT+CPSMSTATUS=" + std::to_string(Enable), false, 1, 1)
+#define SIM7020_AT_RETENTION(Enable)                            SIM70XX_CMD_FMT(false, 10, 1, "AT+RETENTION=", Enable)
+#define SIM7020_AT_CPSMS_DIS(Mode)                              SIM70XX_CMD_FMT(false, 1, 1, "AT+CPSMS=", Mode)
+#define SIM7020_AT_CPSMS_EN(TAU, Active)                        SIM70XX_CMD_FMT(false, 1, 1, "AT+CPSMS=1,,,\"", TAU, "\",\"", Active, "\"")
+#define SIM7020_AT_CPSMSTATUS_W(Enable)                         SIM70XX_CMD_FMT(false, 1, 1, "AT+CPSMSTATUS=", Enable)
 #define SIM7020_AT_CPSMSTATUS_R                                 SIM70XX_CMD("AT+CPSMSTATUS?", true, 1, 1)
 
 /**
@@ -88,20 +90,20 @@
  * Used in SIM7020 TCP driver.
  * 
  */
-#define SIM7020_AT_CDNSGIP(Host)                                SIM70XX_CMD("AT+CDNSGIP=\"" + Host + "\"", false, 1, 1)
-#define SIM7020_AT_CIPPING(Command)                             SIM70XX_CMD(Command, false, 60, 1)
-#define SIM7020_AT_CSOC(Command)                                SIM70XX_CMD(Command, true, 60, 1)
-#define SIM7020_AT_CSOCON(ID, Port, Address)                    SIM70XX_CMD("AT+CSOCON=" + std::to_string(ID) + "," + std::to_string(Port) + ",\"" + Address + "\"", false, 60, 1)
-#define SIM7020_AT_CCSOSEND_BYTES(ID, Length, Data)             SIM70XX_CMD("AT+CSOSEND=" + std::to_string(ID) + "," + std::to_string(Length) + "," + Data, false, 60, 1)
-#define SIM7020_AT_CCSOSEND_STRING(ID, Data)                    SIM70XX_CMD("AT+CSOSEND=" + std::to_string(ID) + ",0,\"" + Data + "\"", false, 60, 1)
-#define SIM7020_AT_CSOCL(ID)                                    SIM70XX_CMD("AT+CSOCL=" + std::to_string(ID), false, 60, 1)
+#define SIM7020_AT_CDNSGIP(Host)                                SIM70XX_CMD_FMT(false, 1, 1, "AT+CDNSGIP=\"", Host, "\"")
+#define SIM7020_AT_CIPPING(Host, Retries, Length, Timeout)     SIM70XX_CMD_FMT(false, 60, 1, "AT+CIPPING=\"", Host, "\",", Retries, ",", Length, ",", Timeout)
+#define SIM7020_AT_CSOC(Domain, Type, CID)                      SIM70XX_CMD_FMT(true, 60, 1, "AT+CSOC=", Domain, ",", Type, ",", CID)
+#define SIM7020_AT_CSOCON(ID, Port, Address)                    SIM70XX_CMD_FMT(false, 60, 1, "AT+CSOCON=", ID, ",", Port, ",\"", Address, "\"")
+#define SIM7020_AT_CCSOSEND_BYTES(ID, Length)                   SIM70XX_CMD_FMT(false, 60, 1, "AT+CSOSEND=", ID, ",", Length, ",")
+#define SIM7020_AT_CCSOSEND_STRING(ID)                          SIM70XX_CMD_FMT(false, 60, 1, "AT+CSOSEND=", ID, ",0,\"")
+#define SIM7020_AT_CSOCL(ID)                                    SIM70XX_CMD_FMT(false, 60, 1, "AT+CSOCL=", ID)
 
 /**
  * 
  * Used in SIM7020 SNTP driver.
  * 
  */
-#define SIM7020_AT_CSNTPSTART(Server, Zone)                     SIM70XX_CMD("AT+CSNTPSTART=\"" + Server + "\",\"" + Zone + "\"", false, 60, 1)
+#define SIM7020_AT_CSNTPSTART(Server, Zone)                     SIM70XX_CMD_FMT(false, 60, 1, "AT+CSNTPSTART=\"", Server, "\",\"", Zone, "\"")
 #define SIM7020_AT_CSNTPSTOP                                    SIM70XX_CMD("AT+CSNTPSTOP", false, 60, 1)
 
 /**
@@ -109,32 +111,35 @@
  * Used in SIM7020 HTTP(S) driver.
  * 
  */
-#define SIM7020_AT_CHTTPCREATE(Host)                            SIM70XX_CMD("AT+CHTTPCREATE=" + Host, true, 60, 1)
-#define SIM7020_AT_CHTTCON(ID)                                  SIM70XX_CMD("AT+CHTTPCON=" + std::to_string(ID), false, 60, 1)
-#define SIM7020_AT_CHTTPSEND(Command)                           SIM70XX_CMD(Command, false, 120, 1)
-#define SIM7020_AT_CHTTPSENDEXT(Command)                        SIM70XX_CMD(Command, false, 120, 1)
-#define SIM7020_AT_CHTTPDISCON(ID)                              SIM70XX_CMD("AT+CHTTPDISCON=" + std::to_string(ID), false, 10, 1)
-#define SIM7020_AT_CHTTPDESTROY(ID)                             SIM70XX_CMD("AT+CHTTPDESTROY=" + std::to_string(ID), false, 10, 1)
+#define SIM7020_AT_CHTTPCREATE(Host)                            SIM70XX_CMD_FMT(true, 60, 1, "AT+CHTTPCREATE=", Host)
+#define SIM7020_AT_CHTTCON(ID)                                  SIM70XX_CMD_FMT(false, 60, 1, "AT+CHTTPCON=", ID)
+#define SIM7020_AT_CHTTPSEND(ID, Method, Path)                  SIM70XX_CMD_FMT(false, 120, 1, "AT+CHTTPSEND=", ID, ",", Method, ",\"", Path, "\"")
+#define SIM7020_AT_CHTTPSENDEXT(More, Total, Length, Data)      SIM70XX_CMD_FMT(false, 120, 1, "AT+CHTTPSENDEXT=", More, ",", Total, ",", Length, ",", Data)
+#define SIM7020_AT_CHTTPSENDEXT_FIRST(More, Total, Length, Size)    SIM70XX_CMD_FMT(false, 120, 1, "AT+CHTTPSENDEXT=", More, ",", Total, ",", Length, ",", Size, ",")
+#define SIM7020_AT_CHTTPDISCON(ID)                              SIM70XX_CMD_FMT(false, 10, 1, "AT+CHTTPDISCON=", ID)
+#define SIM7020_AT_CHTTPDESTROY(ID)                             SIM70XX_CMD_FMT(false, 10, 1, "AT+CHTTPDESTROY=", ID)
 
 /**
  * 
  * Used in SIM7020 MQTT driver.
  * 
  */
-#define SIM7020_AT_CMQNEW(Command)                              SIM70XX_CMD(Command, true, 60, 1)
-#define SIM7020_AT_CMQCON(Command)                              SIM70XX_CMD(Command, false, 60, 1)
-#define SIM7020_AT_CMQPUB(Command)                              SIM70XX_CMD(Command, false, 60, 1)
-#define SIM7020_AT_CMQSUB(ID, Topic, QoS)                       SIM70XX_CMD("AT+CMQSUB=" + std::to_string(ID) + ",\"" + Topic + "\"," + std::to_string(QoS), false, 10, 1)
-#define SIM7020_AT_CMQUNSUB(ID, Topic)                          SIM70XX_CMD("AT+CMQUNSUB=" + std::to_string(ID) + ",\"" + Topic + "\"", false, 10, 1)
-#define SIM7020_AT_CMQDISCON(ID)                                SIM70XX_CMD("AT+CMQDISCON=" + std::to_string(ID), false, 10, 1)
+#define SIM7020_AT_CMQNEW(Broker, Port, Timeout, Size, CID)    SIM70XX_CMD_FMT(true, 60, 1, "AT+CMQNEW=\"", Broker, "\",\"", Port, "\",", Timeout, ",", Size, ",", CID)
+#define SIM7020_AT_CMQCON(ID, Version, Client, Alive, Clean, Will)  SIM70XX_CMD_FMT(false, 60, 1, "AT+CMQCON=", ID, ",", Version, ",\"", Client, "\",", Alive, ",", Clean, ",", Will)
+#define SIM7020_AT_CMQCON_AUTH(ID, Version, Client, Alive, Clean, Will, User, Password)  SIM70XX_CMD_FMT(false, 60, 1, "AT+CMQCON=", ID, ",", Version, ",\"", Client, "\",", Alive, ",", Clean, ",", Will, ",\"", User, "\",\"", Password, "\"")
+#define SIM7020_AT_CMQPUB(ID, Topic, QoS, Retained, Dup, Length)   SIM70XX_CMD_FMT(false, 60, 1, "AT+CMQPUB=", ID, ",\"", Topic, "\",", QoS, ",", Retained, ",", Dup, ",", Length, ",\"")
+#define SIM7020_AT_CMQSUB(ID, Topic, QoS)                       SIM70XX_CMD_FMT(false, 10, 1, "AT+CMQSUB=", ID, ",\"", Topic, "\",", QoS)
+#define SIM7020_AT_CMQUNSUB(ID, Topic)                          SIM70XX_CMD_FMT(false, 10, 1, "AT+CMQUNSUB=", ID, ",\"", Topic, "\"")
+#define SIM7020_AT_CMQDISCON(ID)                                SIM70XX_CMD_FMT(false, 10, 1, "AT+CMQDISCON=", ID)
 
 /**
  * 
  * Used in SIM7020 CoAP driver.
  * 
  */
-#define SIM7020_AT_CCOAPNEW(Command)                            SIM70XX_CMD(Command, true, 60, 1)
-#define SIM7020_AT_CCOAPCSEND(Command)                          SIM70XX_CMD(Command, false, 60, 1)
-#define SIM7020_AT_CCOAPDEL(ID)                                 SIM70XX_CMD("AT+CCOAPDEL=" + std::to_string(ID), false, 10, 1)
+#define SIM7020_AT_CCOAPNEW(Server, Port, CID)                  SIM70XX_CMD_FMT(true, 60, 1, "AT+CCOAPNEW=\"", Server, "\",", Port, ",", CID)
+#define SIM7020_AT_CCOAPCSEND(ID, Type, Code_H, Code_L)         SIM70XX_CMD_FMT(false, 60, 1, "AT+CCOAPCSEND=", ID, ",1,", Type, ",", Code_H, ",", Code_L)
+#define SIM7020_AT_CCOAPCSEND_DATA(ID, Length)                  SIM70XX_CMD_FMT(false, 60, 1, "AT+CCOAPCSEND=", ID, ",", Length, ",\"")
+#define SIM7020_AT_CCOAPDEL(ID)                                 SIM70XX_CMD_FMT(false, 10, 1, "AT+CCOAPDEL=", ID)
 
 #endif /* SIM7020_COMMANDS_H_ */
\ No newline at end of file
@@ -0,0 +1,224 @@
+ /*
+ * sim70xx_builder.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_BUILDER_H_
+#define SIM70XX_BUILDER_H_
+
+#include <string>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <type_traits>
+
+#include "sim70xx_errors.h"
+
+/** @brief Output object of the command builder. The command string is written into a command buffer or into a fixed buffer.
+ */
+typedef struct SIM70XX_Builder_Sink_t
+{
+    std::string* p_String;                          /**< Pointer to command buffer.
+                                                         NOTE: Set to NULL to write into the fixed buffer. */
+    char* p_Buffer;                                 /**< Pointer to fixed buffer. */
+    size_t Size;                                    /**< Size of the fixed buffer, including the string termination. */
+    size_t Length;                                  /**< Length of the command string. */
+    bool isOverflow;                                /**< #true when the command string doesn´t fit into the fixed buffer. */
+
+    /** @brief          Append characters to the output.
+     *  @param p_Data   Pointer to characters
+     *  @param Count    Number of characters
+     */
+    void append(const char* p_Data, size_t Count)
+    {
+        if(p_String != NULL)
+        {
+            p_String->append(p_Data, Count);
+        }
+        else
+        {
+            // NOTE: The last byte of the buffer is reserved for the string termination.
+            if((Length + Count) >= Size)
+            {
+                Count = (Length < Size) ? (Size - Length - 1) : 0;
+                isOverflow = true;
+            }
+
+            memcpy(&p_Buffer[Length], p_Data, Count);
+        }
+
+        Length += Count;
+    }
+} SIM70XX_Builder_Sink_t;
+
+/** @brief              SIM70XX command definition object.
+ *                      NOTE: The command string is not stored in the definition. It is written into the command buffer of the
+ *                            command object when the definition is assigned to the command object.
+ *  @tparam HasData     Set to #true to receive data from the command
+ *  @tparam TimeOut     Response timeout in seconds
+ *  @tparam Number      Number of response lines to receive
+ *  @tparam Formatter   Function object to write the command string
+ */
+template<bool HasData, uint32_t TimeOut, uint16_t Number, typename Formatter>
+struct SIM70XX_CmdDef_t
+{
+    static constexpr bool recData = HasData;        /**< Set to #true to receive data from the command. */
+    static constexpr uint32_t Timeout = TimeOut;    /**< Response timeout in seconds. */
+    static constexpr uint16_t Lines = Number;       /**< Number of response lines. */
+    Formatter Format;                               /**< Function object to write the command string into a builder output. */
+};
+
+/** @brief          Append a string to a builder output.
+ *  @param p_Sink   Pointer to builder output
+ *  @param p_Value  Pointer to string
+ */
+inline void SIM70XX_Builder_Append(SIM70XX_Builder_Sink_t* p_Sink, const char* p_Value)
+{
+    p_Sink->append(p_Value, strlen(p_Value));
+}
+
+/** @brief          Append a string to a builder output.
+ *  @param p_Sink   Pointer to builder output
+ *  @param p_Value  Reference to string
+ */
+inline void SIM70XX_Builder_Append(SIM70XX_Builder_Sink_t* p_Sink, const std::string& p_Value)
+{
+    p_Sink->append(p_Value.c_str(), p_Value.size());
+}
+
+/** @brief          Append an unsigned number in decimal format to a builder output.
+ *  @param p_Sink   Pointer to builder output
+ *  @param Value    Number
+ *  @param Negative Set to #true to add a leading '-'
+ */
+inline void SIM70XX_Builder_AppendNumber(SIM70XX_Builder_Sink_t* p_Sink, unsigned long long Value, bool Negative)
+{
+    char Digits[21];
+    char* p_Digit = &Digits[sizeof(Digits)];
+
+    // Write the digits from the end of the buffer to get the correct order without a reversal.
+    do
+    {
+        *--p_Digit = '0' + (Value % 10);
+        Value /= 10;
+    } while(Value > 0);
+
+    if(Negative)
+    {
+        *--p_Digit = '-';
+    }
+
+    p_Sink->append(p_Digit, &Digits[sizeof(Digits)] - p_Digit);
+}
+
+/** @brief          Append a number or an enum value in decimal format to a builder output.
+ *                  NOTE: Negative values get a leading '-'. No padding or grouping is used.
+ *  @param p_Sink   Pointer to builder output
+ *  @param Value    Number
+ */
+template<typename T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type SIM70XX_Builder_Append(SIM70XX_Builder_Sink_t* p_Sink, T Value)
+{
+    // NOTE: Enum values and small integer types are printed with the sign of their integer promotion (i. e. an uint8_t is never negative).
+    typedef decltype(+Value) Promoted_t;
+
+    if(std::is_signed<Promoted_t>::value && ((long long)Value < 0))
+    {
+        SIM70XX_Builder_AppendNumber(p_Sink, 0ULL - (unsigned long long)(long long)Value, true);
+    }
+    else
+    {
+        SIM70XX_Builder_AppendNumber(p_Sink, (unsigned long long)Value, false);
+    }
+}
+
+/** @brief          End of the argument list.
+ *  @param p_Sink   Pointer to builder output
+ */
+inline void SIM70XX_Builder_Format(SIM70XX_Builder_Sink_t* p_Sink)
+{
+}
+
+/** @brief          Write a list of arguments into a builder output.
+ *  @param p_Sink   Pointer to builder output
+ *  @param p_Value  First argument
+ *  @param p_Args   Remaining arguments
+ */
+template<typename T, typename... Args>
+inline void SIM70XX_Builder_Format(SIM70XX_Builder_Sink_t* p_Sink, const T& p_Value, const Args&... p_Args)
+{
+    SIM70XX_Builder_Append(p_Sink, p_Value);
+    SIM70XX_Builder_Format(p_Sink, p_Args...);
+}
+
+/** @brief          Create a command definition object.
+ *  @tparam HasData Set to #true to receive data from the command
+ *  @tparam TimeOut Response timeout in seconds
+ *  @tparam Number  Number of response lines to receive
+ *  @param Format   Function object to write the command string
+ *  @return         Command definition object
+ */
+template<bool HasData, uint32_t TimeOut, uint16_t Number, typename Formatter>
+inline SIM70XX_CmdDef_t<HasData, TimeOut, Number, Formatter> SIM70XX_Builder_Create(Formatter Format)
+{
+    return SIM70XX_CmdDef_t<HasData, TimeOut, Number, Formatter>{Format};
+}
+
+/** @brief              Write the command string of a command definition into a fixed buffer.
+ *                      NOTE: The command string is terminated with '\0'. A truncated command string is written when the buffer is too small.
+ *  @param p_Definition Command definition object
+ *  @param p_Buffer     Pointer to buffer
+ *  @param Size         Size of the buffer
+ *  @param p_Length     (Optional) Pointer to length of the command string, without the string termination
+ *  @return             SIM70XX_ERR_OK when successful
+ *                      SIM70XX_ERR_INVALID_ARG when an invalid argument is passed into the function
+ *                      SIM70XX_ERR_NO_MEM when the command string doesn´t fit into the buffer
+ */
+template<bool HasData, uint32_t TimeOut, uint16_t Number, typename Formatter>
+inline SIM70XX_Error_t SIM70XX_Builder_Write(const SIM70XX_CmdDef_t<HasData, TimeOut, Number, Formatter>& p_Definition, char* p_Buffer, size_t Size, size_t* p_Length = NULL)
+{
+    SIM70XX_Builder_Sink_t Sink = {NULL, p_Buffer, Size, 0, false};
+
+    if((p_Buffer == NULL) || (Size == 0))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    p_Definition.Format(&Sink);
+    p_Buffer[Sink.Length] = '\0';
+
+    if(p_Length != NULL)
+    {
+        *p_Length = Sink.Length;
+    }
+
+    return Sink.isOverflow ? SIM70XX_ERR_NO_MEM : SIM70XX_ERR_OK;
+}
+
+/** @brief              SIM70XX command generation macro with a list of command arguments.
+ *                      The arguments are written into the command buffer of the command object without creating temporary strings.
+ *                      Allowed arguments are string literals, std::string objects, numbers and enum values.
+ *                      NOTE: The arguments are captured by reference. So the definition must be assigned to the command object in the same statement.
+ *                      NOTE: The timeout and the number of lines are compile time constants of the definition.
+ *  @param HasData      Set to #true to receive data from the command
+ *  @param TimeOut      Response timeout in seconds
+ *  @param Number       Number of response lines to receive
+ *  @param ...          Command arguments
+ */
+#define SIM70XX_CMD_FMT(HasData, TimeOut, Number, ...)          SIM70XX_Builder_Create<HasData, TimeOut, Number>([&](SIM70XX_Builder_Sink_t* p_Sink) { SIM70XX_Builder_Format(p_Sink, __VA_ARGS__); })
+
+#endif /* SIM70XX_BUILDER_H_ */
@@ -24,13 +24,13 @@
 
 #include <sdkconfig.h>
 
-/** @brief      Create a new command object.
- *              An error is generated when no memory is available for allocation.
+/** @brief      Get a new command object from the command pool.
+ *              An error is generated when the command pool is exhausted.
  *  @param AT   Pointer to command object
  */
 #define SIM70XX_CREATE_CMD(AT)                                  do                                  \
                                                                 {                                   \
-                                                                    AT = new SIM70XX_TxCmd_t();     \
+                                                                    AT = SIM70XX_Queue_Acquire();   \
                                                                     if(AT == NULL)                  \
                                                                     {                               \
                                                                         return SIM70XX_ERR_NO_MEM;  \
@@ -43,12 +43,7 @@
  *  @param Timeout      Response timeout in seconds
  *  @param Number       Number of response lines to receive
  */
-#define SIM70XX_CMD(AT, HasData, TimeOut, Number)               {                                   \
-                                                                    .Command = AT,                  \
-                                                                    .recData = HasData,             \
-                                                                    .Timeout = TimeOut,             \
-                                                                    .Lines = Number,                \
-                                                                };
+#define SIM70XX_CMD(AT, HasData, TimeOut, Number)               SIM70XX_CMD_FMT(HasData, TimeOut, Number, AT)
 
 /**
  * 
@@ -56,9 +51,15 @@
  * 
  */
 #define SIM70XX_AT                                              SIM70XX_CMD("AT", false, 1, 1)
-#define SIM70XX_AT_CBAND_W(Band)                                SIM70XX_CMD("AT+CBAND=" + std::to_string(Band), false, 10, 1)
+#define SIM70XX_AT_ATZ                                          SIM70XX_CMD("ATZ", false, 1, 1)
+#define SIM70XX_AT_ATE0                                         SIM70XX_CMD("ATE0", false, 1, 1)
+#define SIM70XX_AT_IFC(DCE, DTE)                                SIM70XX_CMD_FMT(false, 1, 1, "AT+IFC=", DCE, ",", DTE)
+#define SIM70XX_AT_IPR_W(Baud)                                  SIM70XX_CMD_FMT(false, 10, 1, "AT+IPR=", Baud)
+#define SIM70XX_AT_ATW                                          SIM70XX_CMD("AT&W", false, 1, 1)
+#define SIM70XX_AT_CGMR                                         SIM70XX_CMD("AT+CGMR", true, 1, 1)
+#define SIM70XX_AT_CBAND_W(Band)                                SIM70XX_CMD_FMT(false, 10, 1, "AT+CBAND=", Band)
 #define SIM70XX_AT_CFUN_R                                       SIM70XX_CMD("AT+CFUN?", true, 10, 1)
-#define SIM70XX_AT_CFUN_W(Func, Reset)                          SIM70XX_CMD("AT+CFUN=" + std::to_string(Func) + "," + std::to_string(Reset), true, 60, 1)
+#define SIM70XX_AT_CFUN_W(Func, Reset)                          SIM70XX_CMD_FMT(true, 60, 1, "AT+CFUN=", Func, ",", Reset)
 #define SIM70XX_AT_CBAND_R                                      SIM70XX_CMD("AT+CBAND?", true, 10, 1)
 #define SIM70XX_AT_CGATT_R                                      SIM70XX_CMD("AT+CGATT?", true, 90, 1)
 #define SIM70XX_AT_CPIN_R                                       SIM70XX_CMD("AT+CPIN?", true, 10, 1)
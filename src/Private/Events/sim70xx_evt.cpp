@@ -24,12 +24,14 @@
 #include <freertos/event_groups.h>
 #include <freertos/queue.h>
 
-#include <list>
+#include <string.h>
+#include <algorithm>
 
 #include "sim70xx_evt.h"
+#include "sim70xx_urc.h"
 #include "../UART/sim70xx_uart.h"
 #include "../Queue/sim70xx_queue.h"
-#include "../Commands/sim7020_commands.h"
+#include "../Trace/sim70xx_trace.h"
 
 #include <sdkconfig.h>
 
@@ -47,144 +49,585 @@
     #define CONFIG_SIM70XX_TASK_COM_STACK       4096
 #endif
 
+#ifndef CONFIG_SIM70XX_UART_TX_BUFFER_SIZE
+    #define CONFIG_SIM70XX_UART_TX_BUFFER_SIZE  1024
+#endif
+
+#ifndef CONFIG_SIM70XX_UART_BUFFER_SIZE
+    #define CONFIG_SIM70XX_UART_BUFFER_SIZE     256
+#endif
+
+#ifndef CONFIG_SIM70XX_CMD_STALE_TIMEOUT
+    #define CONFIG_SIM70XX_CMD_STALE_TIMEOUT    1000
+#endif
+
+/** @brief Block size for raw data transmissions.
+ */
+#if(CONFIG_SIM70XX_UART_TX_BUFFER_SIZE > 0)
+    #define SIM70XX_EVT_RAW_BLOCK_SIZE          CONFIG_SIM70XX_UART_TX_BUFFER_SIZE
+#else
+    #define SIM70XX_EVT_RAW_BLOCK_SIZE          128
+#endif
+
+/** @brief Log output of the communication task. The output is removed when the verbose log is disabled.
+ */
+#ifdef CONFIG_SIM70XX_DEBUG_VERBOSE
+    #define SIM70XX_EVT_LOGI(...)               ESP_LOGI(TAG, __VA_ARGS__)
+#else
+    #define SIM70XX_EVT_LOGI(...)               do {} while(0)
+#endif
+
+#ifdef CONFIG_SIM70XX_TRACE
+    static uint16_t _SIM70XX_Evt_Sequence = 0;
+#endif
+
+/** @brief Line buffer of the communication task.
+ *         NOTE: The buffer keeps its capacity. So only longer lines are causing a heap allocation.
+ */
+static std::string _SIM70XX_Evt_Line;
+
+/** @brief Number of heap allocations in the communication task. This are the allocations of the line buffer, when a line doesn´t
+ *         fit into the buffer.
+ *         NOTE: Only written by the communication task.
+ */
+static volatile uint32_t _SIM70XX_Evt_Allocations = 0;
+
 static const char* TAG = "SIM70XX_Evt";
 
-/** @brief          This task handels the communication with the SIM70XX module.
- *                  The task will receive a reference to a SIM70XX_TxCmd_t object and start with the transmission of the data.
- *                  The reference to the object will be destroyed after the transmission.
- *  @param p_Arg    Pointer to task parameter
+/** @brief              Check if a received line is the final error code of a command.
+ *  @param Line         Received line without line end
+ *  @return             #true when the line is an error code
  */
-static void SIM70XX_Evt_Task(void* p_Arg)
+static inline bool SIM70XX_Evt_isError(const std::string& Line)
+{
+    return (Line.compare(0, 5, "ERROR") == 0) || (Line.compare(0, 10, "+CME ERROR") == 0);
+}
+
+/** @brief              Check if a received line is an unsolicited result code, which is received during the response of a command.
+ *                      NOTE: A line with the response prefix of the command belongs to the command, even when a handler is registered for the prefix.
+ *  @param Line         Received line without line end
+ *  @param p_Command    Pointer to command object
+ *  @return             #true when the line is an unsolicited result code
+ */
+static bool SIM70XX_Evt_isURC(const std::string& Line, const SIM70XX_TxCmd_t* p_Command)
+{
+    size_t Length;
+
+    if((Line.size() == 0) || (Line[0] != '+') || (SIM70XX_URC_isRegistered(Line) == false))
+    {
+        return false;
+    }
+
+    // Compare the line with the response prefix of the command (i.e. "+CGATT: " for "AT+CGATT?").
+    Length = Line.find(':');
+    if((Length != std::string::npos) && (p_Command->Command.compare(2, Length, Line, 0, Length) == 0))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/** @brief              Pass an asynchronous message to the device specific message filter.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to message
+ *                      NOTE: The message is the line buffer of the communication task. It is only valid during the call, so the
+ *                            handlers must copy the parts they want to keep.
+ */
+static void SIM70XX_Evt_Forward(void* p_Device, std::string* p_Message)
 {
-    uint32_t StatusUpdate = 0;
+    SIM70XX_EVT_LOGI("Event: %s", p_Message->c_str());
 
+    SIM70XX_TRACE(SIM70XX_TRACE_URC, *p_Message, p_Message->size(), SIM70XX_TRACE_NONE, 0);
+
+    SIM70XX_Evt_MessageFilter(p_Device, p_Message);
+}
+
+/** @brief              Get the response prefix of a command (i.e. "+CGATT" for "AT+CGATT?").
+ *  @param Command      Command string
+ *  @return             Response prefix or the command string for commands without a prefix
+ */
+static std::string SIM70XX_Evt_GetPrefix(const std::string& Command)
+{
+    size_t Start;
+
+    Start = Command.find("+");
+    if(Start == std::string::npos)
+    {
+        return Command;
+    }
+
+    return Command.substr(Start, Command.find_first_of("=?", Start) - Start);
+}
+
+/** @brief              Check if a received line belongs to the late response of an expired command.
+ *                      NOTE: The stale prefix is cleared when the final result code of the expired command is received.
+ *  @param Line         Received line without line end
+ *  @param p_Stale      Pointer to response prefix of the expired command
+ *  @return             #true when the line must be discarded
+ */
+static bool SIM70XX_Evt_isStale(const std::string& Line, std::string* p_Stale)
+{
+    if(p_Stale->size() == 0)
+    {
+        return false;
+    }
+
+    if((Line.compare(0, 2, "OK") == 0) || SIM70XX_Evt_isError(Line))
+    {
+        ESP_LOGW(TAG, "Discard late status: %s", Line.c_str());
+
+        SIM70XX_TRACE(SIM70XX_TRACE_DISCARD, *p_Stale, Line.size(), SIM70XX_Evt_isError(Line) ? SIM70XX_TRACE_ERROR : SIM70XX_TRACE_OK, _SIM70XX_Evt_Sequence);
+
+        p_Stale->clear();
+
+        return true;
+    }
+    else if(Line.compare(0, p_Stale->size(), *p_Stale) == 0)
+    {
+        ESP_LOGW(TAG, "Discard late response: %s", Line.c_str());
+
+        SIM70XX_TRACE(SIM70XX_TRACE_DISCARD, *p_Stale, Line.size(), SIM70XX_TRACE_NONE, _SIM70XX_Evt_Sequence);
+
+        return true;
+    }
+
+    return false;
+}
+
+/** @brief              Wait for the late response of an expired command before a new command is transmitted, so the late
+ *                      response isn´t assigned to the new command. Other messages are handled as asynchronous messages.
+ *                      NOTE: The wait is limited by #CONFIG_SIM70XX_CMD_STALE_TIMEOUT.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Stale      Pointer to response prefix of the expired command
+ */
+static void SIM70XX_Evt_DiscardStale(void* p_Device, std::string* p_Stale)
+{
     #if(CONFIG_SIMXX_DEV == 7020)
-        SIM7020_t* Device = (SIM7020_t*)p_Arg;
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
     #elif(CONFIG_SIMXX_DEV == 7080)
-        SIM7080_t* Device = (SIM7080_t*)p_Arg;
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
     #endif
 
-    // NOTE: We want to use a list here, because we don´t need random access. The list should be cleared in the same was as it was filled.
-    //       Also the list supports iterator invalidation which helps to remove processed commands from the list.
-    std::list<SIM70XX_CmdResp_t*> ActiveCommands;
+    uint32_t Now;
+    uint32_t Elapsed;
+    std::string& Line = _SIM70XX_Evt_Line;
 
-    while(true)
+    Now = SIM70XX_Tools_GetmsTimer();
+    while(p_Stale->size() > 0)
     {
-        uint32_t Messages;
-
-        // Get all pending messages from the queue.
-        Messages = uxQueueMessagesWaiting(Device->Internal.TxQueue);
+        Elapsed = SIM70XX_Tools_GetmsTimer() - Now;
 
-        if((SIM70XX_Tools_GetmsTimer() - StatusUpdate) > 1000)
+        // NOTE: Only complete lines are read, so the beginning of the next response doesn´t get lost. The task is blocked by the
+        //       UART driver until new data are received.
+        if((Elapsed >= CONFIG_SIM70XX_CMD_STALE_TIMEOUT) || (SIM70XX_UART_WaitLine(Device->UART, &Line, CONFIG_SIM70XX_CMD_STALE_TIMEOUT - Elapsed) == false))
         {
-            ESP_LOGD(TAG, "%u messages queued for transmission...", Messages);
+            break;
+        }
+
+        SIMXX_TOOLS_REMOVE_LINEEND(Line);
 
-            StatusUpdate = SIM70XX_Tools_GetmsTimer();
+        if((Line.size() > 0) && (SIM70XX_Evt_isStale(Line, p_Stale) == false))
+        {
+            SIM70XX_Evt_Forward(Device, &Line);
         }
+    }
+
+    if(p_Stale->size() > 0)
+    {
+        ESP_LOGW(TAG, "No late status received for %s!", p_Stale->c_str());
+
+        p_Stale->clear();
+    }
+}
+
+/** @brief              Wait for the prompt of a raw data transfer.
+ *                      NOTE: Complete lines before the prompt are handled as asynchronous messages, so they don´t get lost.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Command    Pointer to command object
+ *  @return             #true when the prompt was received
+ */
+static bool SIM70XX_Evt_WaitPrompt(void* p_Device, SIM70XX_TxCmd_t* p_Command)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    size_t PromptLength;
+    std::string& Line = _SIM70XX_Evt_Line;
 
-        if(Device->UART.isInitialized == false)
+    PromptLength = strlen(p_Command->p_Prompt);
+    Line.clear();
+
+    do
+    {
+        int c;
+
+        c = SIM70XX_UART_Read(Device->UART, 10);
+        if(c < 0)
         {
             continue;
         }
 
-        // Get the commands from the queue and send them.
-        for(uint32_t i = 0; i < Messages; i++)
+        if(c != '\n')
         {
-            // NOTE: We need pointers, because the object contains a String objects and these objects may be 
-            // problematic in FreeRTOS:
-            //      https://stackoverflow.com/questions/67346516/using-queue-of-string-in-freertos
-            // The application task will create the pointer with the commands and send them to the message
-            // queue. The command task will receive the pointer and process them, before releasing the memory.
-            SIM70XX_TxCmd_t* CmdObj;
+            Line += (char)c;
 
-            if(xQueueReceive(Device->Internal.TxQueue, &CmdObj, 0) == pdPASS)
+            // NOTE: The prompt isn´t terminated with a line end. So we have to check each received character.
+            if((Line.size() >= PromptLength) && (Line.compare(Line.size() - PromptLength, PromptLength, p_Command->p_Prompt) == 0))
             {
-                SIM70XX_CmdResp_t* Command = new SIM70XX_CmdResp_t();
+                return true;
+            }
 
-                Command->isError = false;
-                Command->isTimeout = false;
-                Command->recData = CmdObj->recData;
-                Command->Timeout = CmdObj->Timeout * 1000;
-                Command->Lines = CmdObj->Lines;
-                Command->Length = CmdObj->Command.size();
-                ActiveCommands.push_back(Command);
+            continue;
+        }
 
-                ESP_LOGI(TAG, "Transmit command: %s", CmdObj->Command.c_str());
+        SIMXX_TOOLS_REMOVE_LINEEND(Line);
 
-                // Transmit the command. The command has the layout
-                //  Command<CR><LF>
-                SIM70XX_UART_SendLine(Device->UART, CmdObj->Command);
+        // Filter out empty lines and the command echo.
+        if((Line.size() > 0) && (Line != p_Command->Command))
+        {
+            if(SIM70XX_Evt_isError(Line))
+            {
+                ESP_LOGE(TAG, "     Device response error!");
 
-                // Flush the string, because the data aren´t needed anymore.
-                CmdObj->Command.clear();
+                p_Command->Result.Status = Line;
+                p_Command->Result.isError = true;
 
-                // Destroy the command.
-                delete CmdObj;
+                return false;
             }
 
-            vTaskDelay(10 / portTICK_PERIOD_MS);
+            SIM70XX_Evt_Forward(Device, &Line);
         }
 
-        // Asynchronous responses from the module.
-        // No messages pending. Get the asynchronous messages.
-        if(Messages == 0)
+        Line.clear();
+    } while(SIM70XX_Queue_isExpired(p_Command) == false);
+
+    ESP_LOGE(TAG, "     Device prompt timout!");
+
+    p_Command->Result.isTimeout = true;
+
+    return false;
+}
+
+/** @brief              Process all complete lines from the receive buffer as asynchronous messages.
+ *  @param p_Device     Pointer to device object
+ */
+static void SIM70XX_Evt_ProcessLines(void* p_Device)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    std::string& Line = _SIM70XX_Evt_Line;
+
+    while(SIM70XX_UART_ReadLine(Device->UART, &Line))
+    {
+        SIMXX_TOOLS_REMOVE_LINEEND(Line);
+
+        if(Line.size() > 0)
+        {
+            SIM70XX_Evt_Forward(Device, &Line);
+        }
+    }
+}
+
+/** @brief              Read the length field of a raw data transfer. The length is terminated by ',' or by a line end.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Command    Pointer to command object
+ *  @param p_Length     Pointer to data length
+ *  @return             #true when the length was received
+ */
+static bool SIM70XX_Evt_ReadLength(void* p_Device, SIM70XX_TxCmd_t* p_Command, size_t* p_Length)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    int c;
+
+    *p_Length = 0;
+
+    do
+    {
+        c = SIM70XX_UART_Read(Device->UART, 1000);
+        if((c >= '0') && (c <= '9'))
         {
-            // New data available?
-            if(SIM70XX_UART_Available(Device->UART) > std::string("\r\n").size())
+            *p_Length = (*p_Length * 10) + (c - '0');
+        }
+    } while((c != ',') && (c != '\n') && (c != -1));
+
+    if(c == -1)
+    {
+        ESP_LOGE(TAG, "     Device response timout!");
+
+        p_Command->Result.isTimeout = true;
+
+        return false;
+    }
+
+    return true;
+}
+
+/** @brief              Process the raw data transfer of a command.
+ *                      Transmitted data are written directly from the buffer of the caller to the UART driver and received
+ *                      data are written directly from the UART driver into the buffer of the caller.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Command    Pointer to command object
+ */
+static void SIM70XX_Evt_RawTransfer(void* p_Device, SIM70XX_TxCmd_t* p_Command)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    if(SIM70XX_Evt_WaitPrompt(Device, p_Command) == false)
+    {
+        return;
+    }
+
+    // The caller has stopped waiting. The buffer of the caller can not be used anymore.
+    if(SIM70XX_Queue_BeginRaw(p_Command) == false)
+    {
+        ESP_LOGE(TAG, "     Raw transfer abandoned!");
+
+        p_Command->Result.isTimeout = true;
+
+        return;
+    }
+
+    if(p_Command->p_TxData != NULL)
+    {
+        const uint8_t* p_Data = (const uint8_t*)p_Command->p_TxData;
+
+        SIM70XX_EVT_LOGI("     Transmit %u raw bytes", p_Command->RawLength);
+
+        // NOTE: The data are transmitted in blocks. Messages which are received during a long transfer are processed between the blocks.
+        for(size_t Offset = 0; Offset < p_Command->RawLength; )
+        {
+            size_t Length;
+
+            Length = std::min((size_t)SIM70XX_EVT_RAW_BLOCK_SIZE, p_Command->RawLength - Offset);
+            SIM70XX_UART_Send(Device->UART, &p_Data[Offset], Length);
+            Offset += Length;
+
+            // NOTE: The module answers after the last block. Don´t process the lines after the last block, because the
+            //       status of the command would be handled as asynchronous message.
+            if(Offset < p_Command->RawLength)
             {
-                std::string* Message = new std::string();
+                SIM70XX_Evt_ProcessLines(Device);
+            }
+        }
 
-                // Get the event message.
-                do
-                {
-                    Message->append(SIM70XX_UART_ReadString(Device->UART));
-                } while(SIM70XX_UART_Available(Device->UART));
+        SIM70XX_TRACE(SIM70XX_TRACE_RAW_TX, p_Command->Command, p_Command->RawLength, SIM70XX_TRACE_NONE, _SIM70XX_Evt_Sequence);
+    }
+    else
+    {
+        size_t Length;
+        size_t Read;
 
-                ESP_LOGI(TAG, "Event: %s", Message->c_str());
+        if(SIM70XX_Evt_ReadLength(Device, p_Command, &Length))
+        {
+            Read = SIM70XX_UART_ReadBytes(Device->UART, (uint8_t*)p_Command->p_RxData, std::min(Length, p_Command->RawLength), 1000);
 
-                SIM70XX_Evt_MessageFilter(Device, Message);
+            SIM70XX_EVT_LOGI("     Received %u raw bytes", Read);
+
+            // Discard all data which doesn´t fit into the buffer of the caller.
+            if(Length > p_Command->RawLength)
+            {
+                ESP_LOGW(TAG, "     Discard %u raw bytes!", Length - p_Command->RawLength);
+
+                for(size_t i = p_Command->RawLength; i < Length; i++)
+                {
+                    if(SIM70XX_UART_Read(Device->UART, 1000) == -1)
+                    {
+                        break;
+                    }
+                }
             }
+
+            p_Command->RawLength = Read;
+
+            SIM70XX_TRACE(SIM70XX_TRACE_RAW_RX, p_Command->Command, Read, SIM70XX_TRACE_NONE, _SIM70XX_Evt_Sequence);
+        }
+    }
+
+    SIM70XX_Queue_EndRaw(p_Command);
+}
+
+/** @brief          This task handels the communication with the SIM70XX module.
+ *                  The task will receive a reference to a SIM70XX_TxCmd_t object and start with the transmission of the data.
+ *                  The result is stored in the command object and the waiting task is notified through the completion handle of the command.
+ *                  NOTE: The task is blocked until a new command is queued or until the UART driver reports new data.
+ *  @param p_Arg    Pointer to task parameter
+ */
+static void SIM70XX_Evt_Task(void* p_Arg)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Arg;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Arg;
+    #endif
+
+    // NOTE: The commands are serialized. So only one command is active. A queued command is transmitted in the next loop pass, after the
+    //       response of the active command was received.
+    SIM70XX_TxCmd_t* Active = NULL;
+    std::string Stale;
+    size_t LineCapacity;
+
+    _SIM70XX_Evt_Line.reserve(CONFIG_SIM70XX_UART_BUFFER_SIZE);
+    LineCapacity = _SIM70XX_Evt_Line.capacity();
+
+    // Remove all data which were received before the task was started.
+    // NOTE: The task is the only consumer of the receive buffer. So the buffer is flushed here and not by the task which starts the driver.
+    SIM70XX_UART_Flush(Device->UART);
+
+    while(true)
+    {
+        QueueSetMemberHandle_t Member;
+
+        // Wait until a new command is queued for transmission or until the UART driver reports new data.
+        // NOTE: Each item in the queue set must be read from the corresponding queue.
+        Member = xQueueSelectFromSet(Device->Internal.QueueSet, portMAX_DELAY);
+
+        // A line from the last loop pass didn´t fit into the line buffer.
+        if(_SIM70XX_Evt_Line.capacity() != LineCapacity)
+        {
+            _SIM70XX_Evt_Allocations++;
+            LineCapacity = _SIM70XX_Evt_Line.capacity();
         }
 
-        // Synchronous responses from the module.
-        // All messages have been send. Now we need to handle the responses. We expect a response for each command.
-        std::list<SIM70XX_CmdResp_t*>::iterator it = ActiveCommands.begin();
-        while(it != ActiveCommands.end())
+        if((Member == Device->Internal.TxQueue.Lanes[SIM70XX_LANE_CONTROL]) || (Member == Device->Internal.TxQueue.Lanes[SIM70XX_LANE_BULK]))
         {
-            uint32_t Now;
+            // NOTE: We need pointers, because the object contains a String objects and these objects may be 
+            // problematic in FreeRTOS:
+            //      https://stackoverflow.com/questions/67346516/using-queue-of-string-in-freertos
+            // The application task will create the pointer with the commands and send them to the message
+            // queue. The command task will receive the pointer and process them, before the application task
+            // releases the memory.
+            // NOTE: The queue set reports one member for each queued command. A control command is always taken first, even when
+            //       the queue set has reported the bulk lane, so the number of received commands still matches the queue set.
+            SIM70XX_TxCmd_t* CmdObj;
+
+            CmdObj = SIM70XX_Queue_Next(Device->Internal.TxQueue);
+
+            // The deadline of the command has expired while the command was queued or the command was cancelled. Don´t transmit it.
+            if((CmdObj != NULL) && SIM70XX_Queue_isExpired(CmdObj))
+            {
+                ESP_LOGW(TAG, "Drop expired command: %s", CmdObj->Command.c_str());
+
+                CmdObj->Result.isTimeout = true;
+                SIM70XX_TRACE(SIM70XX_TRACE_RX, CmdObj->Command, 0, SIM70XX_TRACE_EXPIRED, ++_SIM70XX_Evt_Sequence);
+                SIM70XX_Queue_Complete(CmdObj);
+                CmdObj = NULL;
+            }
+
+            if(CmdObj != NULL)
+            {
+                // The response of the last command is still outstanding. Remove it first.
+                SIM70XX_Evt_DiscardStale(Device, &Stale);
+
+                CmdObj->Result.isError = false;
+                CmdObj->Result.isTimeout = false;
+                Active = CmdObj;
+
+                SIM70XX_Queue_BeginTransmit(CmdObj);
+
+                SIM70XX_EVT_LOGI("Transmit command: %s", CmdObj->Command.c_str());
+
+                // Transmit the command. The command has the layout
+                //  Command[Payload][Suffix]<CR><LF>
+                if((CmdObj->p_Payload == NULL) && (CmdObj->p_Suffix == NULL))
+                {
+                    SIM70XX_UART_SendLine(Device->UART, CmdObj->Command);
+                }
+                // The payload and the suffix are buffers of the caller. The caller must not stop waiting while they are transmitted.
+                else if(SIM70XX_Queue_BeginRaw(CmdObj))
+                {
+                    SIM70XX_UART_Fragment_t Fragments[] = {
+                        {CmdObj->Command.c_str(), CmdObj->Command.size(), SIM70XX_ENC_RAW},
+                        {CmdObj->p_Payload, CmdObj->PayloadLength, CmdObj->Encoding},
+                        {CmdObj->p_Suffix, (CmdObj->p_Suffix != NULL) ? strlen(CmdObj->p_Suffix) : 0, SIM70XX_ENC_RAW},
+                        {"\r\n", 2, SIM70XX_ENC_RAW},
+                    };
+
+                    SIM70XX_UART_SendFragments(Device->UART, Fragments, sizeof(Fragments) / sizeof(Fragments[0]));
+                    SIM70XX_Queue_EndRaw(CmdObj);
+                }
+                // The caller has stopped waiting before the transmission. The payload can not be used anymore.
+                else
+                {
+                    ESP_LOGE(TAG, "Payload transfer abandoned!");
+
+                    CmdObj->Result.isTimeout = true;
+                    SIM70XX_Queue_Complete(CmdObj);
+                    Active = NULL;
 
-            ESP_LOGD(TAG, "Active commands: %u", ActiveCommands.size());
+                    continue;
+                }
 
-            SIM70XX_UART_ReadStringUntil(Device->UART);
+                SIM70XX_TRACE(SIM70XX_TRACE_TX, CmdObj->Command, CmdObj->Command.size() + SIM70XX_Tools_GetEncodedLength(CmdObj->Encoding, CmdObj->PayloadLength) + 2,
+                              SIM70XX_TRACE_NONE, ++_SIM70XX_Evt_Sequence);
+            }
+        }
+        else if(Member == Device->UART.EventQueue)
+        {
+            SIM70XX_UART_ProcessEvent(Device->UART);
+        }
 
+        // Synchronous response from the module.
+        // The command has been send. Now we need to handle the response.
+        if(Active != NULL)
+        {
+            // Commands with a raw data transfer. The transmission has the following layout
+            //  <CR><LF><Prompt>[<Length>,]<Data>
+            if(Active->p_Prompt != NULL)
+            {
+                SIM70XX_Evt_RawTransfer(Device, Active);
+            }
             // Get the data from the command. The transmission has the following layout
             //  <CR><LF>+<Command>: <Data><CR><LF>
-            if((*it)->recData)
+            // NOTE: The read functions are blocking until a new line is received. So we don´t need any delays here.
+            else if(Active->recData)
             {
+                SIM70XX_UART_ReadStringUntil(Device->UART);
+
                 // Wait for the device response and process the response.
-                Now = SIM70XX_Tools_GetmsTimer();
                 do
                 {
-                    std::string Line;
+                    std::string& Line = _SIM70XX_Evt_Line;
 
                     // Read a new line from the serial interface.
                     // NOTE: The trailing \n is removed from the response!
-                    Line = std::string(SIM70XX_UART_ReadStringUntil(Device->UART));
+                    SIM70XX_UART_ReadStringUntil(Device->UART, &Line);
 
                     // Remove the line ending.
                     SIMXX_TOOLS_REMOVE_LINEEND(Line);
 
                     if(Line.size() > 0)
                     {
-                        ESP_LOGI(TAG, "     Device response: %s", Line.c_str());
+                        SIM70XX_EVT_LOGI("     Device response: %s", Line.c_str());
                     }
 
+                    // Unsolicited result codes can be received before the response.
+                    if(SIM70XX_Evt_isURC(Line, Active))
+                    {
+                        SIM70XX_Evt_Forward(Device, &Line);
+                    }
                     // The device has reported an error.
-                    if(Line.find("ERROR") != std::string::npos)
+                    else if(Line.find("ERROR") != std::string::npos)
                     {
                         ESP_LOGE(TAG, "     Device response error!");
 
-                        (*it)->isError = true;
+                        Active->Result.isError = true;
 
                         break;
                     }
@@ -193,96 +636,153 @@ static void SIM70XX_Evt_Task(void* p_Arg)
                     {
                         size_t Index;
 
-                        // Remove the command from the response.
+                        // Remove the command from the response (i.e. "+CSQ: ").
+                        // NOTE: The line is modified in place to avoid heap allocations.
                         Index = Line.find("+");
                         if(Index != std::string::npos)
                         {
-                            std::string Dummy;
+                            size_t Colon;
 
-                            Dummy = Line.substr(Index, Line.find(":") + 1) + " ";
-                            Line = Line.replace(Line.find(Dummy), Dummy.size(), "");
+                            Colon = Line.find(':', Index);
+                            if((Colon != std::string::npos) && (Line.compare(Colon + 1, 1, " ") == 0))
+                            {
+                                Line.erase(Index, Colon + 2 - Index);
+                            }
                         }
 
                         // Add the received line to the response when the number of lines is 0.
-                        if((*it)->Lines > 1)
+                        if(Active->Lines > 1)
                         {
-                            (*it)->Response += Line + '\n';
-                            (*it)->Lines--;
+                            Active->Result.Response.append(Line);
+                            Active->Result.Response.push_back('\n');
+                            Active->Lines--;
                         }
                         // Abort when all lines are received.
                         else
                         {
-                            (*it)->Response += Line;
+                            Active->Result.Response += Line;
 
                             break;
                         }
                     }
                     // Abort when an empty line was received.
-                    else if((Line.size() == 0) && ((*it)->Lines == 0))
+                    else if((Line.size() == 0) && (Active->Lines == 0))
                     {
                         break;
                     }
-                    // Abort when a timeout occurs.
-                    // NOTE: Value 0 will disable the timeout function. This can be used by commands which will report a result anyway.
-                    else if(((*it)->Timeout != 0) && (SIM70XX_Tools_GetmsTimer() - Now) > (*it)->Timeout)
+                    // Abort when the deadline has expired or when the command was cancelled.
+                    // NOTE: Commands without deadline will report a result anyway.
+                    else if(SIM70XX_Queue_isExpired(Active))
                     {
                         ESP_LOGE(TAG, "     Device response timout!");
 
-                        (*it)->isTimeout = true;
+                        Active->Result.isTimeout = true;
 
                         break;
                     }
-
-                    vTaskDelay(20 / portTICK_PERIOD_MS);
                 } while(true);
             }
 
             // The device has not reported an error and no receive timeout was detected. We have to receive the status message now.
-            if(((*it)->isError == false) && ((*it)->isTimeout == false))
+            if((Active->Result.isError == false) && (Active->Result.isTimeout == false))
             {
                 // Wait for the status code with the layout
                 //  <CR><LF>Status<CR><LF>
-                Now = SIM70XX_Tools_GetmsTimer();
                 do
                 {
+                    std::string& Line = _SIM70XX_Evt_Line;
+
                     // Read a new line from the serial interface.
                     // NOTE: The trailing \n is removed from the response!
-                    (*it)->Status.append(SIM70XX_UART_ReadStringUntil(Device->UART));
+                    SIM70XX_UART_ReadStringUntil(Device->UART, &Line);
+
+                    // Remove the line endings.
+                    SIMXX_TOOLS_REMOVE_LINEEND(Line);
+
+                    // Filter out empty lines and the command echo.
+                    if((Line.size() > 0) && (Line != Active->Command))
+                    {
+                        // Asynchronous messages can be received between the raw data and the status code and before the status code.
+                        if(((Active->p_Prompt != NULL) && (Line.find("OK") == std::string::npos) && (SIM70XX_Evt_isError(Line) == false)) ||
+                           SIM70XX_Evt_isURC(Line, Active))
+                        {
+                            SIM70XX_Evt_Forward(Device, &Line);
+                        }
+                        else
+                        {
+                            Active->Result.Status.assign(Line);
+
+                            break;
+                        }
+                    }
 
-                    // Abort when a timeout occurs.
-                    if(((*it)->Timeout != 0) && (SIM70XX_Tools_GetmsTimer() - Now) > (*it)->Timeout)
+                    // Abort when the deadline has expired or when the command was cancelled.
+                    if(SIM70XX_Queue_isExpired(Active))
                     {
                         ESP_LOGE(TAG, "     Device status timout!");
 
-                        (*it)->isTimeout = true;
+                        Active->Result.isTimeout = true;
 
                         break;
                     }
-
-                    vTaskDelay(20 / portTICK_PERIOD_MS);
-                } while((*it)->Status.size() < 2);
-
-                // Remove the line endings.
-                SIMXX_TOOLS_REMOVE_LINEEND((*it)->Status);
+                } while(true);
 
                 // Transmission is without error when 'OK' as status code is transmitted and when no event data are received.
-                if((*it)->Status.find("OK") == std::string::npos)
+                if(Active->Result.Status.find("OK") == std::string::npos)
                 {
                     ESP_LOGE(TAG, "     Device status error!");
 
-                    (*it)->isError = true;
+                    Active->Result.isError = true;
                 }
 
-                ESP_LOGI(TAG, "     Device Status: %s", (*it)->Status.c_str());
+                SIM70XX_EVT_LOGI("     Device Status: %s", Active->Result.Status.c_str());
+            }
+
+            // The module may still answer the expired command. Remember the command, so the late response can be discarded.
+            if(Active->Result.isTimeout)
+            {
+                Stale = SIM70XX_Evt_GetPrefix(Active->Command);
             }
 
-            // The command was processed completly. Push it to the response queue and remove it from the command list.
-            xQueueSend(Device->Internal.RxQueue, &(*it), 0);
-            ActiveCommands.erase(it++);
+            SIM70XX_TRACE(SIM70XX_TRACE_RX, Active->Command, Active->Result.Response.size() + Active->Result.Status.size(),
+                          Active->Result.isTimeout ? SIM70XX_TRACE_TIMEOUT : (Active->Result.isError ? SIM70XX_TRACE_ERROR : SIM70XX_TRACE_OK), _SIM70XX_Evt_Sequence);
+
+            // The command was processed completly. Notify the waiting task.
+            SIM70XX_Queue_Complete(Active);
+            Active = NULL;
+        }
+
+        // Asynchronous responses from the module.
+        // No commands pending. Get the asynchronous messages line by line.
+        // NOTE: Only complete lines are read. The rest of an incomplete line is received with the next event of the UART driver.
+        if(SIM70XX_Queue_Pending(Device->Internal.TxQueue) == 0)
+        {
+            std::string& Line = _SIM70XX_Evt_Line;
+
+            while(SIM70XX_UART_ReadLine(Device->UART, &Line))
+            {
+                SIMXX_TOOLS_REMOVE_LINEEND(Line);
+
+                // Filter out empty lines and the late response of an expired command.
+                if((Line.size() == 0) || SIM70XX_Evt_isStale(Line, &Stale))
+                {
+                    continue;
+                }
+
+                SIM70XX_Evt_Forward(Device, &Line);
+            }
         }
+    }
+}
 
-        vTaskDelay(20 / portTICK_PERIOD_MS);
+void SIM70XX_Evt_GetStatistics(SIM70XX_Statistics_t* p_Stats)
+{
+    if(p_Stats == NULL)
+    {
+        return;
     }
+
+    p_Stats->Allocations += _SIM70XX_Evt_Allocations;
 }
 
 SIM70XX_Error_t SIM70XX_Evt_StartTask(TaskHandle_t* p_Handle, void* p_Arg)
@@ -292,15 +792,45 @@ SIM70XX_Error_t SIM70XX_Evt_StartTask(TaskHandle_t* p_Handle, void* p_Arg)
         return SIM70XX_ERR_INVALID_ARG;
     }
 
-	#ifdef CONFIG_SIM7020_TASK_CORE_AFFINITY
-        xTaskCreatePinnedToCore(SIM70XX_Evt_Task, "SIM70XX_Evt", SIM70XX_TASK_COM_STACK, p_Arg, CONFIG_SIM70XX_TASK_COM_PRIO, p_Handle, CONFIG_SIM70XX_TASK_COM_CORE);
-	#else
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Arg;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Arg;
+    #endif
+
+    // Create the queue set for the transmit queue lanes and the UART driver events.
+    // NOTE: The queues must be empty when they are added to the queue set.
+    Device->Internal.QueueSet = xQueueCreateSet((CONFIG_SIM70XX_QUEUE_LENGTH * 2) + CONFIG_SIM70XX_QUEUE_BULK_LENGTH);
+    if(Device->Internal.QueueSet == NULL)
+    {
+        return SIM70XX_ERR_NO_MEM;
+    }
+
+    xQueueReset(Device->UART.EventQueue);
+    if((xQueueAddToSet(Device->Internal.TxQueue.Lanes[SIM70XX_LANE_CONTROL], Device->Internal.QueueSet) != pdPASS) ||
+       (xQueueAddToSet(Device->Internal.TxQueue.Lanes[SIM70XX_LANE_BULK], Device->Internal.QueueSet) != pdPASS) ||
+       (xQueueAddToSet(Device->UART.EventQueue, Device->Internal.QueueSet) != pdPASS))
+    {
+        vQueueDelete(Device->Internal.QueueSet);
+        Device->Internal.QueueSet = NULL;
+
+        return SIM70XX_ERR_QUEUE_ERR;
+    }
+
+    *p_Handle = NULL;
+
+    #ifdef CONFIG_SIM70XX_TASK_CORE_AFFINITY
+        xTaskCreatePinnedToCore(SIM70XX_Evt_Task, "SIM70XX_Evt", CONFIG_SIM70XX_TASK_COM_STACK, p_Arg, CONFIG_SIM70XX_TASK_COM_PRIO, p_Handle, CONFIG_SIM70XX_TASK_COM_CORE);
+    #else
         xTaskCreate(SIM70XX_Evt_Task, "SIM70XX_Evt", CONFIG_SIM70XX_TASK_COM_STACK, p_Arg, CONFIG_SIM70XX_TASK_COM_PRIO, p_Handle);
-	#endif
-    if(p_Handle == NULL)
+    #endif
+    if(*p_Handle == NULL)
     {
         return SIM70XX_ERR_NO_MEM;
     }
 
+    // From now on only the communication task reads from the interface.
+    Device->UART.Consumer = *p_Handle;
+
     return SIM70XX_ERR_OK;
 }
\ No newline at end of file
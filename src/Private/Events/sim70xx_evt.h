@@ -35,9 +35,16 @@
 /** @brief              Device specific event message filter.
  *  @param p_Device     Pointer to device object
  *  @param p_Message    Pointer to event message
+ *                      NOTE: The message is only valid during the call.
  */
 extern void SIM70XX_Evt_MessageFilter(void* p_Device, std::string* p_Message);
 
+/** @brief          Add the heap allocations of the communication task to the driver statistics.
+ *                  NOTE: Call this function after #SIM70XX_Queue_GetStatistics.
+ *  @param p_Stats  Pointer to statistics object
+ */
+void SIM70XX_Evt_GetStatistics(SIM70XX_Statistics_t* p_Stats);
+
 /** @brief          Start the SIM70XX event task.
  *  @param p_Handle Pointer to task handle
  *  @param p_Arg    Pointer to task arguments
@@ -0,0 +1,591 @@
+ /*
+ * sim70xx_mailbox.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <ctype.h>
+#include <string.h>
+
+#include <esp_log.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#include "sim70xx_urc.h"
+#include "sim70xx_mailbox.h"
+
+/** @brief Registered event prefix definition.
+ */
+typedef struct
+{
+    const char* p_Prefix;                           /**< Event prefix. */
+    size_t Length;                                  /**< Length of the prefix. */
+    bool hasID;                                     /**< #true when the first field of the event is a socket ID. */
+} SIM70XX_Mailbox_Key_t;
+
+/** @brief Event mailbox definition.
+ */
+typedef struct
+{
+    QueueHandle_t Queue;                            /**< Pending events. */
+    const SIM70XX_Mailbox_Key_t* p_Key;             /**< Event prefix of the mailbox.
+                                                         NOTE: #NULL when the mailbox is unused. */
+    uint8_t ID;                                     /**< Socket ID of the mailbox. */
+    uint32_t Waiters;                               /**< Number of tasks waiting on the mailbox.
+                                                         NOTE: A mailbox with waiting tasks is never reused for another event. */
+    uint32_t Dropped;                               /**< Number of dropped events since the last flush. */
+} SIM70XX_Mailbox_t;
+
+static SIM70XX_Mailbox_Key_t _SIM70XX_Mailbox_Keys[CONFIG_SIM70XX_MAILBOX_COUNT];
+static size_t _SIM70XX_Mailbox_KeyCount = 0;
+static SIM70XX_Mailbox_t _SIM70XX_Mailboxes[CONFIG_SIM70XX_MAILBOX_COUNT];
+
+/** @brief Event buffers. The buffers are moved between the free list and the mailboxes, so they keep their capacity.
+ *         NOTE: Each mailbox has one additional buffer for the event which is copied by a waiting task.
+ */
+static std::string _SIM70XX_Mailbox_Buffers[CONFIG_SIM70XX_MAILBOX_COUNT * (CONFIG_SIM70XX_MAILBOX_DEPTH + 1)];
+static std::string* _SIM70XX_Mailbox_Free[CONFIG_SIM70XX_MAILBOX_COUNT * (CONFIG_SIM70XX_MAILBOX_DEPTH + 1)];
+static size_t _SIM70XX_Mailbox_FreeCount = 0;
+static uint32_t _SIM70XX_Mailbox_Dropped = 0;
+static uint32_t _SIM70XX_Mailbox_Allocations = 0;
+static uint32_t _SIM70XX_Mailbox_Generation = 0;
+static SemaphoreHandle_t _SIM70XX_Mailbox_Lock = NULL;
+
+static const char* TAG = "SIM70XX_Mailbox";
+
+/** @brief              Get the registered key for an event prefix.
+ *                      NOTE: The mailbox lock must be held.
+ *  @param p_Prefix     Event prefix
+ *  @return             Pointer to key or #NULL when the prefix is not registered
+ */
+static const SIM70XX_Mailbox_Key_t* SIM70XX_Mailbox_GetKey(const char* p_Prefix)
+{
+    for(size_t i = 0; i < _SIM70XX_Mailbox_KeyCount; i++)
+    {
+        if(strcmp(_SIM70XX_Mailbox_Keys[i].p_Prefix, p_Prefix) == 0)
+        {
+            return &_SIM70XX_Mailbox_Keys[i];
+        }
+    }
+
+    return NULL;
+}
+
+/** @brief              Return an event buffer to the free list.
+ *                      NOTE: The mailbox lock must be held.
+ *  @param p_Event      Pointer to event buffer
+ */
+static inline void SIM70XX_Mailbox_FreeEvent(std::string* p_Event)
+{
+    p_Event->clear();
+    _SIM70XX_Mailbox_Free[_SIM70XX_Mailbox_FreeCount++] = p_Event;
+}
+
+/** @brief              Remove all pending events from a mailbox.
+ *                      NOTE: The mailbox lock must be held. Empty events from #SIM70XX_Mailbox_WakeAll are removed too, but not counted.
+ *  @param p_Mailbox    Pointer to mailbox
+ *  @return             Number of removed events
+ */
+static uint32_t SIM70XX_Mailbox_Clear(SIM70XX_Mailbox_t* p_Mailbox)
+{
+    uint32_t Count;
+    std::string* Event;
+
+    Count = 0;
+    while(xQueueReceive(p_Mailbox->Queue, &Event, 0) == pdPASS)
+    {
+        if(Event != NULL)
+        {
+            SIM70XX_Mailbox_FreeEvent(Event);
+            Count++;
+        }
+    }
+
+    return Count;
+}
+
+/** @brief              Get the mailbox for an event prefix and a socket ID.
+ *                      A new mailbox is assigned when no mailbox exists.
+ *                      NOTE: The mailbox lock must be held.
+ *  @param p_Key        Pointer to event key
+ *  @param ID           Socket ID
+ *  @return             Pointer to mailbox or #NULL when no mailbox is available
+ */
+static SIM70XX_Mailbox_t* SIM70XX_Mailbox_Get(const SIM70XX_Mailbox_Key_t* p_Key, uint8_t ID)
+{
+    SIM70XX_Mailbox_t* Unused;
+    SIM70XX_Mailbox_t* Idle;
+
+    Unused = NULL;
+    Idle = NULL;
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_MAILBOX_COUNT; i++)
+    {
+        SIM70XX_Mailbox_t* Mailbox = &_SIM70XX_Mailboxes[i];
+
+        if((Mailbox->p_Key == p_Key) && (Mailbox->ID == ID))
+        {
+            return Mailbox;
+        }
+        else if((Mailbox->p_Key == NULL) && (Unused == NULL))
+        {
+            Unused = Mailbox;
+        }
+        else if((Mailbox->Waiters == 0) && (Idle == NULL))
+        {
+            Idle = Mailbox;
+        }
+    }
+
+    // Reuse a mailbox nobody is waiting on when all mailboxes are assigned. The old events of the mailbox are lost.
+    if(Unused == NULL)
+    {
+        if(Idle == NULL)
+        {
+            return NULL;
+        }
+
+        _SIM70XX_Mailbox_Dropped += SIM70XX_Mailbox_Clear(Idle);
+        Unused = Idle;
+    }
+
+    Unused->p_Key = p_Key;
+    Unused->ID = ID;
+    Unused->Dropped = 0;
+
+    return Unused;
+}
+
+/** @brief              URC handler for all registered event prefixes.
+ *                      The message is copied into a buffer from the free list and the buffer is put into the mailbox of the event.
+ *                      The buffer of the oldest event is reused when the mailbox is full.
+ *                      NOTE: The handler never blocks, because it is called by the communication task.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to message
+ */
+static void SIM70XX_Mailbox_on_Event(void* p_Device, std::string* p_Message)
+{
+    uint8_t ID;
+    size_t Capacity;
+    std::string* Event;
+    SIM70XX_Mailbox_t* Mailbox;
+    const SIM70XX_Mailbox_Key_t* Key;
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+
+    Key = NULL;
+    for(size_t i = 0; i < _SIM70XX_Mailbox_KeyCount; i++)
+    {
+        if(p_Message->compare(0, _SIM70XX_Mailbox_Keys[i].Length, _SIM70XX_Mailbox_Keys[i].p_Prefix) == 0)
+        {
+            Key = &_SIM70XX_Mailbox_Keys[i];
+
+            break;
+        }
+    }
+
+    if(Key == NULL)
+    {
+        xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+
+        return;
+    }
+
+    // Get the socket ID. The event has the layout
+    //  <Prefix>: <ID>,...
+    ID = SIM70XX_MAILBOX_NO_ID;
+    if(Key->hasID)
+    {
+        size_t Index;
+
+        Index = p_Message->find_first_not_of(": ", Key->Length);
+        if((Index != std::string::npos) && (isdigit((unsigned char)(*p_Message)[Index])))
+        {
+            ID = 0;
+            while((Index < p_Message->size()) && isdigit((unsigned char)(*p_Message)[Index]))
+            {
+                ID = (ID * 10) + ((*p_Message)[Index++] - '0');
+            }
+        }
+    }
+
+    Mailbox = SIM70XX_Mailbox_Get(Key, ID);
+    if(Mailbox == NULL)
+    {
+        _SIM70XX_Mailbox_Dropped++;
+        xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+
+        ESP_LOGW(TAG, "No mailbox available. Drop event: %s", p_Message->c_str());
+
+        return;
+    }
+
+    // Drop the oldest event when the mailbox is full and reuse the buffer. The reader detects the loss with #SIM70XX_Mailbox_GetDropped.
+    Event = NULL;
+    if(uxQueueSpacesAvailable(Mailbox->Queue) == 0)
+    {
+        // NOTE: An empty event is a wake up from #SIM70XX_Mailbox_WakeAll, which wasn´t received by a waiting task. It isn´t counted.
+        if((xQueueReceive(Mailbox->Queue, &Event, 0) == pdPASS) && (Event != NULL))
+        {
+            ESP_LOGW(TAG, "Mailbox full. Drop event: %s", Event->c_str());
+
+            _SIM70XX_Mailbox_Dropped++;
+            Mailbox->Dropped++;
+        }
+    }
+
+    if(Event == NULL)
+    {
+        // NOTE: The free list is only empty when several tasks are copying the events of the same mailbox at the same time.
+        if(_SIM70XX_Mailbox_FreeCount == 0)
+        {
+            _SIM70XX_Mailbox_Dropped++;
+            Mailbox->Dropped++;
+            xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+
+            ESP_LOGW(TAG, "No event buffer available. Drop event: %s", p_Message->c_str());
+
+            return;
+        }
+
+        Event = _SIM70XX_Mailbox_Free[--_SIM70XX_Mailbox_FreeCount];
+    }
+
+    // NOTE: The buffer only causes a heap allocation when the event doesn´t fit into the buffer.
+    Capacity = Event->capacity();
+    Event->assign(*p_Message);
+    if(Event->capacity() != Capacity)
+    {
+        _SIM70XX_Mailbox_Allocations++;
+    }
+
+    xQueueSend(Mailbox->Queue, &Event, 0);
+
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+}
+
+void SIM70XX_Mailbox_Init(void)
+{
+    if(_SIM70XX_Mailbox_Lock != NULL)
+    {
+        return;
+    }
+
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_MAILBOX_COUNT; i++)
+    {
+        _SIM70XX_Mailboxes[i].Queue = xQueueCreate(CONFIG_SIM70XX_MAILBOX_DEPTH, sizeof(std::string*));
+        _SIM70XX_Mailboxes[i].p_Key = NULL;
+        _SIM70XX_Mailboxes[i].ID = SIM70XX_MAILBOX_NO_ID;
+        _SIM70XX_Mailboxes[i].Waiters = 0;
+        _SIM70XX_Mailboxes[i].Dropped = 0;
+    }
+
+    for(uint32_t i = 0; i < (sizeof(_SIM70XX_Mailbox_Buffers) / sizeof(_SIM70XX_Mailbox_Buffers[0])); i++)
+    {
+        _SIM70XX_Mailbox_Buffers[i].reserve(CONFIG_SIM70XX_MAILBOX_EVENT_LENGTH);
+        _SIM70XX_Mailbox_Free[i] = &_SIM70XX_Mailbox_Buffers[i];
+    }
+    _SIM70XX_Mailbox_FreeCount = sizeof(_SIM70XX_Mailbox_Buffers) / sizeof(_SIM70XX_Mailbox_Buffers[0]);
+
+    _SIM70XX_Mailbox_Lock = xSemaphoreCreateMutex();
+}
+
+SIM70XX_Error_t SIM70XX_Mailbox_Register(const char* p_Prefix, bool hasID)
+{
+    SIM70XX_Error_t Error;
+
+    if(p_Prefix == NULL)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(_SIM70XX_Mailbox_Lock == NULL)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    Error = SIM70XX_ERR_OK;
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+
+    if(SIM70XX_Mailbox_GetKey(p_Prefix) == NULL)
+    {
+        if(_SIM70XX_Mailbox_KeyCount >= CONFIG_SIM70XX_MAILBOX_COUNT)
+        {
+            Error = SIM70XX_ERR_NO_MEM;
+        }
+        else
+        {
+            Error = SIM70XX_URC_Register(p_Prefix, SIM70XX_Mailbox_on_Event);
+            if(Error == SIM70XX_ERR_OK)
+            {
+                _SIM70XX_Mailbox_Keys[_SIM70XX_Mailbox_KeyCount].p_Prefix = p_Prefix;
+                _SIM70XX_Mailbox_Keys[_SIM70XX_Mailbox_KeyCount].Length = strlen(p_Prefix);
+                _SIM70XX_Mailbox_Keys[_SIM70XX_Mailbox_KeyCount].hasID = hasID;
+                _SIM70XX_Mailbox_KeyCount++;
+            }
+        }
+    }
+
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+
+    return Error;
+}
+
+SIM70XX_Error_t SIM70XX_Mailbox_Wait(const char* p_Prefix, uint8_t ID, std::string* p_Event, TickType_t Timeout)
+{
+    bool isReceived;
+    bool isAborted;
+    uint32_t Generation;
+    TickType_t Start;
+    std::string* Event;
+    SIM70XX_Mailbox_t* Mailbox;
+    const SIM70XX_Mailbox_Key_t* Key;
+
+    if((p_Prefix == NULL) || (p_Event == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(_SIM70XX_Mailbox_Lock == NULL)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+
+    Mailbox = NULL;
+    Key = SIM70XX_Mailbox_GetKey(p_Prefix);
+    if(Key != NULL)
+    {
+        Mailbox = SIM70XX_Mailbox_Get(Key, ID);
+        if(Mailbox != NULL)
+        {
+            Mailbox->Waiters++;
+        }
+    }
+
+    Generation = _SIM70XX_Mailbox_Generation;
+
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+
+    if(Key == NULL)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(Mailbox == NULL)
+    {
+        return SIM70XX_ERR_NO_MEM;
+    }
+
+    // Block on the mailbox until the event is received.
+    // NOTE: The lock is not hold here, because the communication task has to fill the mailbox.
+    // NOTE: An empty event is used to wake up the waiting tasks. The wait is only aborted when #SIM70XX_Mailbox_WakeAll was called
+    //       after the wait has started. Older empty events were left by tasks which had already stopped waiting and are skipped.
+    isAborted = false;
+    Start = xTaskGetTickCount();
+    do
+    {
+        TickType_t Remaining;
+
+        Remaining = Timeout;
+        if(Timeout != portMAX_DELAY)
+        {
+            TickType_t Elapsed = xTaskGetTickCount() - Start;
+
+            Remaining = (Elapsed < Timeout) ? (Timeout - Elapsed) : 0;
+        }
+
+        isReceived = (xQueueReceive(Mailbox->Queue, &Event, Remaining) == pdPASS);
+        if(isReceived && (Event == NULL))
+        {
+            xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+            isAborted = (Generation != _SIM70XX_Mailbox_Generation);
+            xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+        }
+    } while(isReceived && (Event == NULL) && (isAborted == false));
+
+    // NOTE: The event is copied, so the buffer keeps its capacity for the next event.
+    if(isReceived && (Event != NULL))
+    {
+        p_Event->assign(*Event);
+    }
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+    if(isReceived && (Event != NULL))
+    {
+        SIM70XX_Mailbox_FreeEvent(Event);
+    }
+    Mailbox->Waiters--;
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+
+    if(isAborted)
+    {
+        return SIM70XX_ERR_INVALID_STATE;
+    }
+    else if(isReceived == false)
+    {
+        return SIM70XX_ERR_TIMEOUT;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+void SIM70XX_Mailbox_Flush(const char* p_Prefix, uint8_t ID, bool isReader)
+{
+    SIM70XX_Mailbox_t* Mailbox;
+    const SIM70XX_Mailbox_Key_t* Key;
+
+    if((p_Prefix == NULL) || (_SIM70XX_Mailbox_Lock == NULL))
+    {
+        return;
+    }
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+
+    Key = SIM70XX_Mailbox_GetKey(p_Prefix);
+    if(Key != NULL)
+    {
+        // NOTE: The mailbox of a reader is assigned here, so the events are not dropped before the first wait.
+        Mailbox = NULL;
+        for(uint32_t i = 0; i < CONFIG_SIM70XX_MAILBOX_COUNT; i++)
+        {
+            if((_SIM70XX_Mailboxes[i].p_Key == Key) && (_SIM70XX_Mailboxes[i].ID == ID))
+            {
+                Mailbox = &_SIM70XX_Mailboxes[i];
+            }
+        }
+
+        if((Mailbox == NULL) && isReader)
+        {
+            Mailbox = SIM70XX_Mailbox_Get(Key, ID);
+        }
+
+        if(Mailbox != NULL)
+        {
+            SIM70XX_Mailbox_Clear(Mailbox);
+            Mailbox->Dropped = 0;
+        }
+    }
+
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+}
+
+void SIM70XX_Mailbox_Release(const char* p_Prefix, uint8_t ID)
+{
+    const SIM70XX_Mailbox_Key_t* Key;
+
+    if((p_Prefix == NULL) || (_SIM70XX_Mailbox_Lock == NULL))
+    {
+        return;
+    }
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+
+    Key = SIM70XX_Mailbox_GetKey(p_Prefix);
+    if(Key != NULL)
+    {
+        for(uint32_t i = 0; i < CONFIG_SIM70XX_MAILBOX_COUNT; i++)
+        {
+            SIM70XX_Mailbox_t* Mailbox = &_SIM70XX_Mailboxes[i];
+
+            if((Mailbox->p_Key == Key) && (Mailbox->ID == ID))
+            {
+                SIM70XX_Mailbox_Clear(Mailbox);
+                Mailbox->Dropped = 0;
+
+                if(Mailbox->Waiters == 0)
+                {
+                    Mailbox->p_Key = NULL;
+                    Mailbox->ID = SIM70XX_MAILBOX_NO_ID;
+                }
+            }
+        }
+    }
+
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+}
+
+uint32_t SIM70XX_Mailbox_GetDropped(const char* p_Prefix, uint8_t ID)
+{
+    uint32_t Dropped;
+    const SIM70XX_Mailbox_Key_t* Key;
+
+    if((p_Prefix == NULL) || (_SIM70XX_Mailbox_Lock == NULL))
+    {
+        return 0;
+    }
+
+    Dropped = 0;
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+
+    Key = SIM70XX_Mailbox_GetKey(p_Prefix);
+    if(Key != NULL)
+    {
+        for(uint32_t i = 0; i < CONFIG_SIM70XX_MAILBOX_COUNT; i++)
+        {
+            if((_SIM70XX_Mailboxes[i].p_Key == Key) && (_SIM70XX_Mailboxes[i].ID == ID))
+            {
+                Dropped = _SIM70XX_Mailboxes[i].Dropped;
+            }
+        }
+    }
+
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+
+    return Dropped;
+}
+
+void SIM70XX_Mailbox_WakeAll(void)
+{
+    std::string* Event;
+
+    if(_SIM70XX_Mailbox_Lock == NULL)
+    {
+        return;
+    }
+
+    Event = NULL;
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+
+    // Only the tasks which are waiting now are aborted by the empty events.
+    _SIM70XX_Mailbox_Generation++;
+
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_MAILBOX_COUNT; i++)
+    {
+        // Send one empty event for each waiting task.
+        for(uint32_t j = 0; j < _SIM70XX_Mailboxes[i].Waiters; j++)
+        {
+            xQueueSendToFront(_SIM70XX_Mailboxes[i].Queue, &Event, 0);
+        }
+    }
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+}
+
+void SIM70XX_Mailbox_GetStatistics(SIM70XX_Statistics_t* p_Stats)
+{
+    if((p_Stats == NULL) || (_SIM70XX_Mailbox_Lock == NULL))
+    {
+        return;
+    }
+
+    xSemaphoreTake(_SIM70XX_Mailbox_Lock, portMAX_DELAY);
+    p_Stats->Dropped = _SIM70XX_Mailbox_Dropped;
+    p_Stats->Allocations += _SIM70XX_Mailbox_Allocations;
+    xSemaphoreGive(_SIM70XX_Mailbox_Lock);
+}
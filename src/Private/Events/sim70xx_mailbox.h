@@ -0,0 +1,112 @@
+ /*
+ * sim70xx_mailbox.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_MAILBOX_H_
+#define SIM70XX_MAILBOX_H_
+
+#include <string>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <freertos/FreeRTOS.h>
+
+#include <sdkconfig.h>
+
+#include "sim70xx_defs.h"
+#include "sim70xx_errors.h"
+
+#ifndef CONFIG_SIM70XX_MAILBOX_COUNT
+    #define CONFIG_SIM70XX_MAILBOX_COUNT            8
+#endif
+
+#ifndef CONFIG_SIM70XX_MAILBOX_DEPTH
+    #define CONFIG_SIM70XX_MAILBOX_DEPTH            4
+#endif
+
+#ifndef CONFIG_SIM70XX_MAILBOX_EVENT_LENGTH
+    #define CONFIG_SIM70XX_MAILBOX_EVENT_LENGTH     128
+#endif
+
+/** @brief  ID for events without a socket ID.
+ */
+#define SIM70XX_MAILBOX_NO_ID                       0xFF
+
+/** @brief  Initialize the event mailboxes.
+ *          NOTE: All memory for the mailboxes is allocated once.
+ */
+void SIM70XX_Mailbox_Init(void);
+
+/** @brief              Route all asynchronous messages with the given prefix into the event mailboxes.
+ *                      NOTE: Registering the same prefix again has no effect.
+ *  @param p_Prefix     Event prefix (e.g. "+CDNSGIP")
+ *                      NOTE: The prefix is not copied. It must stay valid while the driver is running.
+ *  @param hasID        #true when the first field of the event is a socket ID. Events with different IDs are stored in different mailboxes.
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_Mailbox_Register(const char* p_Prefix, bool hasID);
+
+/** @brief              Wait for an event.
+ *  @param p_Prefix     Event prefix
+ *  @param ID           Socket ID of the event
+ *                      NOTE: Use #SIM70XX_MAILBOX_NO_ID for events without a socket ID.
+ *  @param p_Event      Pointer to event message
+ *  @param Timeout      Timeout in ticks
+ *  @return             SIM70XX_ERR_OK when successful
+ *                      SIM70XX_ERR_TIMEOUT when no event was received
+ *                      SIM70XX_ERR_NO_MEM when no mailbox was available
+ *                      SIM70XX_ERR_INVALID_STATE when the wait was aborted with #SIM70XX_Mailbox_WakeAll
+ */
+SIM70XX_Error_t SIM70XX_Mailbox_Wait(const char* p_Prefix, uint8_t ID, std::string* p_Event, TickType_t Timeout);
+
+/** @brief              Remove all pending events from a mailbox and reset the number of dropped events of the mailbox.
+ *                      NOTE: Use this function before a request is started to remove old responses.
+ *  @param p_Prefix     Event prefix
+ *  @param ID           Socket ID of the event
+ *  @param isReader     (Optional) #true when the caller reads the events of the following response. The mailbox is assigned immediately,
+ *                      so no event is lost before the first #SIM70XX_Mailbox_Wait.
+ *                      NOTE: The communication task never waits for free space. The oldest event is dropped when the mailbox is full.
+ */
+void SIM70XX_Mailbox_Flush(const char* p_Prefix, uint8_t ID, bool isReader = false);
+
+/** @brief              Remove all pending events from a mailbox and release the mailbox for other events.
+ *                      NOTE: Use this function when a socket is closed. The mailbox is kept when a task still waits on it.
+ *  @param p_Prefix     Event prefix
+ *  @param ID           Socket ID of the event
+ */
+void SIM70XX_Mailbox_Release(const char* p_Prefix, uint8_t ID);
+
+/** @brief              Get the number of events which were dropped from a mailbox since the last #SIM70XX_Mailbox_Flush.
+ *  @param p_Prefix     Event prefix
+ *  @param ID           Socket ID of the event
+ *  @return             Number of dropped events
+ */
+uint32_t SIM70XX_Mailbox_GetDropped(const char* p_Prefix, uint8_t ID);
+
+/** @brief  Wake up all tasks which are waiting for an event. The waits are returning with SIM70XX_ERR_INVALID_STATE.
+ *          NOTE: Used when the device is powered down, so no task waits until the timeout. Waits which are started later are not affected.
+ */
+void SIM70XX_Mailbox_WakeAll(void);
+
+/** @brief              Get the statistics of the event mailboxes.
+ *                      NOTE: Only the mailbox related fields are updated.
+ *  @param p_Stats      Pointer to statistics object
+ */
+void SIM70XX_Mailbox_GetStatistics(SIM70XX_Statistics_t* p_Stats);
+
+#endif /* SIM70XX_MAILBOX_H_ */
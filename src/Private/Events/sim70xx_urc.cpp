@@ -0,0 +1,218 @@
+ /*
+ * sim70xx_urc.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <string.h>
+
+#include <freertos/FreeRTOS.h>
+
+#include "sim70xx_urc.h"
+
+/** @brief URC handler entry definition.
+ */
+typedef struct
+{
+    const char* p_Prefix;                           /**< URC prefix. */
+    size_t Length;                                  /**< Length of the prefix. */
+    SIM70XX_URC_Handler_t Handler;                  /**< URC handler. */
+} SIM70XX_URC_Entry_t;
+
+// NOTE: The entries are sorted by prefix, so a message can be matched with a binary search.
+static SIM70XX_URC_Entry_t _SIM70XX_URC_Entries[CONFIG_SIM70XX_URC_COUNT];
+static size_t _SIM70XX_URC_Count = 0;
+static portMUX_TYPE _SIM70XX_URC_Lock = portMUX_INITIALIZER_UNLOCKED;
+
+/** @brief              Compare the beginning of a message with a URC prefix.
+ *  @param p_Message    Pointer to message
+ *  @param Length       Length of the message
+ *  @param p_Entry      Pointer to handler entry
+ *  @return             0 when the message starts with the prefix, < 0 or > 0 when the message is sorted before or after the prefix
+ */
+static int SIM70XX_URC_Compare(const char* p_Message, size_t Length, const SIM70XX_URC_Entry_t* p_Entry)
+{
+    int Result;
+
+    if(Length < p_Entry->Length)
+    {
+        Result = memcmp(p_Message, p_Entry->p_Prefix, Length);
+
+        return (Result != 0) ? Result : -1;
+    }
+
+    return memcmp(p_Message, p_Entry->p_Prefix, p_Entry->Length);
+}
+
+/** @brief              Search the index of a URC prefix or the index where the prefix has to be inserted.
+ *                      NOTE: The URC lock must be held.
+ *  @param p_Message    Pointer to message or prefix
+ *  @param Length       Length of the message or prefix
+ *  @param p_Found      Set to #true when a matching entry was found
+ *  @return             Index of the matching entry or the insert position
+ */
+static size_t SIM70XX_URC_Search(const char* p_Message, size_t Length, bool* p_Found)
+{
+    size_t Low;
+    size_t High;
+
+    Low = 0;
+    High = _SIM70XX_URC_Count;
+    while(Low < High)
+    {
+        size_t Middle;
+        int Result;
+
+        Middle = Low + ((High - Low) / 2);
+        Result = SIM70XX_URC_Compare(p_Message, Length, &_SIM70XX_URC_Entries[Middle]);
+        if(Result == 0)
+        {
+            *p_Found = true;
+
+            return Middle;
+        }
+        else if(Result < 0)
+        {
+            High = Middle;
+        }
+        else
+        {
+            Low = Middle + 1;
+        }
+    }
+
+    *p_Found = false;
+
+    return Low;
+}
+
+SIM70XX_Error_t SIM70XX_URC_Register(const char* p_Prefix, SIM70XX_URC_Handler_t Handler)
+{
+    bool Found;
+    size_t Index;
+    size_t Length;
+    SIM70XX_Error_t Error;
+
+    if((p_Prefix == NULL) || (Handler == NULL) || (*p_Prefix == '\0'))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    Length = strlen(p_Prefix);
+    Error = SIM70XX_ERR_OK;
+
+    portENTER_CRITICAL(&_SIM70XX_URC_Lock);
+
+    Index = SIM70XX_URC_Search(p_Prefix, Length, &Found);
+    if(Found)
+    {
+        // Only the same prefix can be replaced. A longer or shorter prefix would break the search.
+        if(_SIM70XX_URC_Entries[Index].Length == Length)
+        {
+            _SIM70XX_URC_Entries[Index].Handler = Handler;
+        }
+        else
+        {
+            Error = SIM70XX_ERR_INVALID_ARG;
+        }
+    }
+    else if((Index < _SIM70XX_URC_Count) && (strncmp(_SIM70XX_URC_Entries[Index].p_Prefix, p_Prefix, Length) == 0))
+    {
+        // The new prefix is the beginning of a registered prefix.
+        Error = SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(_SIM70XX_URC_Count >= CONFIG_SIM70XX_URC_COUNT)
+    {
+        Error = SIM70XX_ERR_NO_MEM;
+    }
+    else
+    {
+        memmove(&_SIM70XX_URC_Entries[Index + 1], &_SIM70XX_URC_Entries[Index], (_SIM70XX_URC_Count - Index) * sizeof(SIM70XX_URC_Entry_t));
+        _SIM70XX_URC_Entries[Index].p_Prefix = p_Prefix;
+        _SIM70XX_URC_Entries[Index].Length = Length;
+        _SIM70XX_URC_Entries[Index].Handler = Handler;
+        _SIM70XX_URC_Count++;
+    }
+
+    portEXIT_CRITICAL(&_SIM70XX_URC_Lock);
+
+    return Error;
+}
+
+void SIM70XX_URC_Unregister(const char* p_Prefix)
+{
+    bool Found;
+    size_t Index;
+    size_t Length;
+
+    if(p_Prefix == NULL)
+    {
+        return;
+    }
+
+    Length = strlen(p_Prefix);
+
+    portENTER_CRITICAL(&_SIM70XX_URC_Lock);
+
+    Index = SIM70XX_URC_Search(p_Prefix, Length, &Found);
+    if(Found && (_SIM70XX_URC_Entries[Index].Length == Length))
+    {
+        memmove(&_SIM70XX_URC_Entries[Index], &_SIM70XX_URC_Entries[Index + 1], (_SIM70XX_URC_Count - Index - 1) * sizeof(SIM70XX_URC_Entry_t));
+        _SIM70XX_URC_Count--;
+    }
+
+    portEXIT_CRITICAL(&_SIM70XX_URC_Lock);
+}
+
+bool SIM70XX_URC_Dispatch(void* p_Device, std::string* p_Message)
+{
+    bool Found;
+    size_t Index;
+    SIM70XX_URC_Handler_t Handler;
+
+    Handler = NULL;
+
+    portENTER_CRITICAL(&_SIM70XX_URC_Lock);
+
+    Index = SIM70XX_URC_Search(p_Message->c_str(), p_Message->size(), &Found);
+    if(Found)
+    {
+        Handler = _SIM70XX_URC_Entries[Index].Handler;
+    }
+
+    portEXIT_CRITICAL(&_SIM70XX_URC_Lock);
+
+    // The handler is called without holding the lock, because it can block.
+    if(Handler == NULL)
+    {
+        return false;
+    }
+
+    Handler(p_Device, p_Message);
+
+    return true;
+}
+
+bool SIM70XX_URC_isRegistered(const std::string& Message)
+{
+    bool Found;
+
+    portENTER_CRITICAL(&_SIM70XX_URC_Lock);
+    SIM70XX_URC_Search(Message.c_str(), Message.size(), &Found);
+    portEXIT_CRITICAL(&_SIM70XX_URC_Lock);
+
+    return Found;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+ /*
+ * sim70xx_urc.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_URC_H_
+#define SIM70XX_URC_H_
+
+#include <string>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <sdkconfig.h>
+
+#include "sim70xx_errors.h"
+
+#ifndef CONFIG_SIM70XX_URC_COUNT
+    #define CONFIG_SIM70XX_URC_COUNT                16
+#endif
+
+/** @brief              URC handler definition.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to URC message
+ *                      NOTE: The message is only valid during the call. The handler must copy the parts it wants to keep.
+ */
+typedef void (*SIM70XX_URC_Handler_t)(void* p_Device, std::string* p_Message);
+
+/** @brief              Register a handler for an unsolicited result code.
+ *                      NOTE: Registering the same prefix again replaces the handler.
+ *                      NOTE: A prefix must not be the beginning of another registered prefix.
+ *  @param p_Prefix     URC prefix (e.g. "+CSOERR")
+ *                      NOTE: The prefix is not copied. It must stay valid while the handler is registered.
+ *  @param Handler      URC handler
+ *  @return             SIM70XX_ERR_OK when successful
+ *                      SIM70XX_ERR_INVALID_ARG when the prefix is invalid or overlaps with a registered prefix
+ *                      SIM70XX_ERR_NO_MEM when all handler entries are in use
+ */
+SIM70XX_Error_t SIM70XX_URC_Register(const char* p_Prefix, SIM70XX_URC_Handler_t Handler);
+
+/** @brief              Remove the handler for an unsolicited result code.
+ *  @param p_Prefix     URC prefix
+ */
+void SIM70XX_URC_Unregister(const char* p_Prefix);
+
+/** @brief              Call the handler which is registered for the prefix of a message.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Message    Pointer to message
+ *  @return             #true when a handler was called
+ */
+bool SIM70XX_URC_Dispatch(void* p_Device, std::string* p_Message);
+
+/** @brief              Check if a handler is registered for the prefix of a message.
+ *  @param Message      Message
+ *  @return             #true when a handler is registered
+ */
+bool SIM70XX_URC_isRegistered(const std::string& Message);
+
+#endif /* SIM70XX_URC_H_ */
@@ -17,40 +17,10 @@
  * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
  */
 
-#include <esp_err.h>
 #include <esp_log.h>
 
-#include <driver/gpio.h>
-
 #include "sim70xx_gpio.h"
-
-static gpio_config_t _SIM70XX_PwrKey_Config = {
-    .pin_bit_mask = BIT(CONFIG_SIM70XX_GPIO_PWRKEY_PIN),
-    .mode = GPIO_MODE_OUTPUT,
-    #ifdef CIONFIG_SIM70XX_GPIO_PWRKEY_ENABLE_PULL
-        #ifdef CONFIG_SIM70XX_GPIO_PWRKEY_INVERT
-            .pull_up_en = GPIO_PULLUP_DISABLE,
-            .pull_down_en = GPIO_PULLDOWN_ENABLE,
-        #else
-            .pull_up_en = GPIO_PULLUP_ENABLE,
-            .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        #endif
-    #else
-        .pull_up_en = GPIO_PULLUP_DISABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-    #endif
-    .intr_type = GPIO_INTR_DISABLE,
-};
-
-#ifdef CONFIG_SIM70XX_GPIO_USE_STATUS
-    static gpio_config_t _SIM70XX_Status_Config = {
-    };
-#endif
-
-#ifdef CONFIG_SIM70XX_GPIO_USE_NETLIGHT
-    static gpio_config_t _SIM70XX_Netlight_Config = {
-    };
-#endif
+#include "../Port/sim70xx_port.h"
 
 static const char* TAG = "SIM70XX_GPIO";
 
@@ -58,25 +28,29 @@ void SIM70XX_GPIO_Init(void)
 {
     ESP_LOGI(TAG, "Initialize GPIO...");
 
-    gpio_config(&_SIM70XX_PwrKey_Config);
+    #if(defined CONFIG_SIM70XX_GPIO_PWRKEY_ENABLE_PULL && defined CONFIG_SIM70XX_GPIO_PWRKEY_INVERT)
+        SIM70XX_Port_GPIO_Config((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, true, false, true);
+    #elif(defined CONFIG_SIM70XX_GPIO_PWRKEY_ENABLE_PULL)
+        SIM70XX_Port_GPIO_Config((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, true, true, false);
+    #else
+        SIM70XX_Port_GPIO_Config((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, true, false, false);
+    #endif
 
     #ifdef CONFIG_SIM70XX_GPIO_USE_STATUS
         ESP_LOGI(TAG, "     Use status signal: [x]");
-        gpio_config(&_SIM70XX_Status_Config);
     #else
         ESP_LOGI(TAG, "     Use status signal: [ ]");
     #endif
 
     #ifdef CONFIG_SIM70XX_GPIO_USE_NETLIGHT
         ESP_LOGI(TAG, "     Use netlight signal: [x]");
-        gpio_config(&_SIM70XX_Netlight_Config);
     #else
         ESP_LOGI(TAG, "     Use netlight signal: [ ]");
     #endif
 
     #ifdef CONFIG_SIM70XX_GPIO_PWRKEY_INVERT
-        gpio_set_level((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, false);
+        SIM70XX_Port_GPIO_SetLevel((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, false);
     #else
-        gpio_set_level((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, true);
+        SIM70XX_Port_GPIO_SetLevel((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, true);
     #endif
 }
\ No newline at end of file
@@ -23,6 +23,8 @@
 #include "sim70xx_defs.h"
 #include "sim70xx_errors.h"
 
+#include "../Port/sim70xx_port.h"
+
 #include <sdkconfig.h>
 
 /** @brief          Enable / Disable the PwrKey pin.
@@ -31,9 +33,9 @@
 inline __attribute__((always_inline)) void SIM70XX_GPIO_SetPwrKey(bool Enable)
 {
     #ifdef CONFIG_SIM70XX_GPIO_PWRKEY_INVERT
-        gpio_set_level((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, Enable);
+        SIM70XX_Port_GPIO_SetLevel((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, Enable);
     #else
-        gpio_set_level((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, !Enable);
+        SIM70XX_Port_GPIO_SetLevel((gpio_num_t)CONFIG_SIM70XX_GPIO_PWRKEY_PIN, !Enable);
     #endif
 }
 
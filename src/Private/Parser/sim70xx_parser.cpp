@@ -0,0 +1,313 @@
+ /*
+ * sim70xx_parser.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <string.h>
+
+#include "sim70xx_parser.h"
+
+/** @brief          Check if a character is a white space or a line ending.
+ *  @param Char     Character
+ *  @return         #true when the character is a white space
+ */
+static inline bool SIM70XX_Parser_isSpace(char Char)
+{
+    return (Char == ' ') || (Char == '\t') || (Char == '\r') || (Char == '\n');
+}
+
+/** @brief          Remove leading and trailing white spaces from a field.
+ *  @param p_Field  Pointer to field object
+ */
+static void SIM70XX_Parser_Trim(SIM70XX_Field_t* p_Field)
+{
+    while((p_Field->Length > 0) && SIM70XX_Parser_isSpace(p_Field->p_Data[0]))
+    {
+        p_Field->p_Data++;
+        p_Field->Length--;
+    }
+
+    while((p_Field->Length > 0) && SIM70XX_Parser_isSpace(p_Field->p_Data[p_Field->Length - 1]))
+    {
+        p_Field->Length--;
+    }
+}
+
+/** @brief          Convert a field into an unsigned number.
+ *  @param p_Field  Pointer to field object
+ *  @param Base     Number base (10 or 16)
+ *  @param p_Value  Pointer to number
+ *  @return         #true when successful
+ */
+static bool SIM70XX_Parser_ToNumber(const SIM70XX_Field_t* p_Field, uint8_t Base, uint32_t* p_Value)
+{
+    uint32_t Value = 0;
+
+    if(p_Field->Length == 0)
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < p_Field->Length; i++)
+    {
+        char Char = p_Field->p_Data[i];
+        uint8_t Digit;
+
+        if((Char >= '0') && (Char <= '9'))
+        {
+            Digit = Char - '0';
+        }
+        else if((Base == 16) && (Char >= 'a') && (Char <= 'f'))
+        {
+            Digit = Char - 'a' + 10;
+        }
+        else if((Base == 16) && (Char >= 'A') && (Char <= 'F'))
+        {
+            Digit = Char - 'A' + 10;
+        }
+        else
+        {
+            return false;
+        }
+
+        // Overflow.
+        if(Value > ((UINT32_MAX - Digit) / Base))
+        {
+            return false;
+        }
+
+        Value = (Value * Base) + Digit;
+    }
+
+    *p_Value = Value;
+
+    return true;
+}
+
+void SIM70XX_Parser_Init(SIM70XX_Parser_t* p_Parser, const std::string& p_Input)
+{
+    SIM70XX_Parser_Init(p_Parser, p_Input.data(), p_Input.size());
+}
+
+void SIM70XX_Parser_Init(SIM70XX_Parser_t* p_Parser, const char* p_Data, size_t Length)
+{
+    p_Parser->p_Position = p_Data;
+    p_Parser->p_End = p_Data + Length;
+    p_Parser->isError = false;
+}
+
+bool SIM70XX_Parser_SkipPrefix(SIM70XX_Parser_t* p_Parser, const char* p_Prefix)
+{
+    size_t Length;
+
+    Length = strlen(p_Prefix);
+    if(p_Parser->p_Position != NULL)
+    {
+        for(const char* p_Start = p_Parser->p_Position; (p_Start + Length) <= p_Parser->p_End; p_Start++)
+        {
+            if(memcmp(p_Start, p_Prefix, Length) == 0)
+            {
+                p_Parser->p_Position = p_Start + Length;
+
+                return true;
+            }
+        }
+    }
+
+    p_Parser->isError = true;
+
+    return false;
+}
+
+bool SIM70XX_Parser_Next(SIM70XX_Parser_t* p_Parser, SIM70XX_Field_t* p_Field, char Delimiter)
+{
+    bool isQuoted;
+    const char* p_Start;
+    const char* p_Stop;
+    const char* p_Delimiter;
+    SIM70XX_Field_t Field;
+
+    // NOTE: The position is set to NULL after the last field was read. So an empty last field (i. e. "1,") is still reported.
+    if(p_Parser->p_Position == NULL)
+    {
+        p_Parser->isError = true;
+
+        return false;
+    }
+
+    p_Start = p_Parser->p_Position;
+    while((p_Start < p_Parser->p_End) && SIM70XX_Parser_isSpace(*p_Start))
+    {
+        p_Start++;
+    }
+
+    // Quoted fields can contain the delimiter. So we have to search the closing quote first.
+    isQuoted = (p_Start < p_Parser->p_End) && (*p_Start == '"');
+    if(isQuoted)
+    {
+        p_Start++;
+        p_Stop = (const char*)memchr(p_Start, '"', p_Parser->p_End - p_Start);
+        if(p_Stop == NULL)
+        {
+            p_Parser->isError = true;
+            p_Parser->p_Position = NULL;
+
+            return false;
+        }
+
+        Field.p_Data = p_Start;
+        Field.Length = p_Stop - p_Start;
+        p_Start = p_Stop + 1;
+    }
+
+    p_Delimiter = (const char*)memchr(p_Start, Delimiter, p_Parser->p_End - p_Start);
+    if(p_Delimiter == NULL)
+    {
+        p_Stop = p_Parser->p_End;
+        p_Parser->p_Position = NULL;
+    }
+    else
+    {
+        p_Stop = p_Delimiter;
+        p_Parser->p_Position = p_Delimiter + 1;
+    }
+
+    // Unquoted field. The field ends at the delimiter.
+    if(isQuoted == false)
+    {
+        Field.p_Data = p_Start;
+        Field.Length = p_Stop - p_Start;
+        SIM70XX_Parser_Trim(&Field);
+    }
+
+    if(p_Field != NULL)
+    {
+        *p_Field = Field;
+    }
+
+    return true;
+}
+
+bool SIM70XX_Parser_GetString(SIM70XX_Parser_t* p_Parser, std::string* p_Value, char Delimiter)
+{
+    SIM70XX_Field_t Field;
+
+    if(SIM70XX_Parser_Next(p_Parser, &Field, Delimiter) == false)
+    {
+        return false;
+    }
+
+    p_Value->assign(Field.p_Data, Field.Length);
+
+    return true;
+}
+
+bool SIM70XX_Parser_GetInt(SIM70XX_Parser_t* p_Parser, int32_t* p_Value, char Delimiter)
+{
+    bool isNegative;
+    uint32_t Value;
+    SIM70XX_Field_t Field;
+
+    if(SIM70XX_Parser_Next(p_Parser, &Field, Delimiter) == false)
+    {
+        return false;
+    }
+
+    isNegative = false;
+    if((Field.Length > 0) && ((Field.p_Data[0] == '-') || (Field.p_Data[0] == '+')))
+    {
+        isNegative = (Field.p_Data[0] == '-');
+        Field.p_Data++;
+        Field.Length--;
+    }
+
+    if((SIM70XX_Parser_ToNumber(&Field, 10, &Value) == false) || (Value > ((uint32_t)INT32_MAX + isNegative)))
+    {
+        p_Parser->isError = true;
+
+        return false;
+    }
+
+    *p_Value = isNegative ? (int32_t)(0U - Value) : (int32_t)Value;
+
+    return true;
+}
+
+bool SIM70XX_Parser_GetUInt(SIM70XX_Parser_t* p_Parser, uint32_t* p_Value, char Delimiter)
+{
+    SIM70XX_Field_t Field;
+
+    if(SIM70XX_Parser_Next(p_Parser, &Field, Delimiter) == false)
+    {
+        return false;
+    }
+
+    if(SIM70XX_Parser_ToNumber(&Field, 10, p_Value) == false)
+    {
+        p_Parser->isError = true;
+
+        return false;
+    }
+
+    return true;
+}
+
+bool SIM70XX_Parser_GetHex(SIM70XX_Parser_t* p_Parser, uint32_t* p_Value, char Delimiter)
+{
+    SIM70XX_Field_t Field;
+
+    if(SIM70XX_Parser_Next(p_Parser, &Field, Delimiter) == false)
+    {
+        return false;
+    }
+
+    if((Field.Length > 2) && (Field.p_Data[0] == '0') && ((Field.p_Data[1] == 'x') || (Field.p_Data[1] == 'X')))
+    {
+        Field.p_Data += 2;
+        Field.Length -= 2;
+    }
+
+    if(SIM70XX_Parser_ToNumber(&Field, 16, p_Value) == false)
+    {
+        p_Parser->isError = true;
+
+        return false;
+    }
+
+    return true;
+}
+
+void SIM70XX_Parser_GetRemaining(SIM70XX_Parser_t* p_Parser, SIM70XX_Field_t* p_Field)
+{
+    if(p_Parser->p_Position == NULL)
+    {
+        p_Field->p_Data = p_Parser->p_End;
+        p_Field->Length = 0;
+    }
+    else
+    {
+        p_Field->p_Data = p_Parser->p_Position;
+        p_Field->Length = p_Parser->p_End - p_Parser->p_Position;
+    }
+
+    p_Parser->p_Position = NULL;
+}
+
+bool SIM70XX_Parser_isEqual(const SIM70XX_Field_t* p_Field, const char* p_String)
+{
+    return (strlen(p_String) == p_Field->Length) && (memcmp(p_Field->p_Data, p_String, p_Field->Length) == 0);
+}
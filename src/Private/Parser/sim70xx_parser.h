@@ -0,0 +1,138 @@
+ /*
+ * sim70xx_parser.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_PARSER_H_
+#define SIM70XX_PARSER_H_
+
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/** @brief SIM70XX response field object definition.
+ *                   NOTE: The field points into the parsed response. It is only valid as long as the response is not modified.
+ */
+typedef struct
+{
+    const char* p_Data;                             /**< Pointer to the first character of the field. */
+    size_t Length;                                  /**< Length of the field. */
+} SIM70XX_Field_t;
+
+/** @brief SIM70XX response parser object definition.
+ */
+typedef struct
+{
+    const char* p_Position;                         /**< Current position in the response.
+                                                         NOTE: Set to #NULL when all fields are read. */
+    const char* p_End;                              /**< End of the response. */
+    bool isError;                                   /**< Set to #true when a field was missing or invalid.
+                                                         NOTE: The flag is not cleared by the parser. So it can be checked once after all fields are parsed. */
+} SIM70XX_Parser_t;
+
+/** @brief           Initialize a parser with a response string.
+ *                   NOTE: The response is not copied. It must not be modified while the parser is used.
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Input   Response string
+ */
+void SIM70XX_Parser_Init(SIM70XX_Parser_t* p_Parser, const std::string& p_Input);
+
+/** @brief           Initialize a parser with a response buffer.
+ *                   NOTE: The response is not copied. It must not be modified while the parser is used.
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Data    Pointer to response buffer
+ *  @param Length    Length of the response
+ */
+void SIM70XX_Parser_Init(SIM70XX_Parser_t* p_Parser, const char* p_Data, size_t Length);
+
+/** @brief           Skip everything up to and including a prefix (i. e. "+CSQ: ").
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Prefix  Prefix string
+ *  @return          #true when the prefix was found
+ *                   NOTE: The position is not changed and the error flag is set when the prefix was not found.
+ */
+bool SIM70XX_Parser_SkipPrefix(SIM70XX_Parser_t* p_Parser, const char* p_Prefix);
+
+/** @brief           Get the next field of the response.
+ *                   Quoted fields are returned without the quotes and can contain the delimiter.
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Field   (Optional) Pointer to field object
+ *  @param Delimiter (Optional) Field delimiter
+ *  @return          #true when a field was found
+ */
+bool SIM70XX_Parser_Next(SIM70XX_Parser_t* p_Parser, SIM70XX_Field_t* p_Field = NULL, char Delimiter = ',');
+
+/** @brief           Get the next field as string.
+ *                   NOTE: The string is overwritten. So the capacity of the string is reused.
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Value   Pointer to string
+ *  @param Delimiter (Optional) Field delimiter
+ *  @return          #true when successful
+ */
+bool SIM70XX_Parser_GetString(SIM70XX_Parser_t* p_Parser, std::string* p_Value, char Delimiter = ',');
+
+/** @brief           Get the next field as signed decimal number.
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Value   Pointer to number
+ *  @param Delimiter (Optional) Field delimiter
+ *  @return          #true when successful
+ *                   NOTE: The number is not changed and the error flag is set when the field is no valid number.
+ */
+bool SIM70XX_Parser_GetInt(SIM70XX_Parser_t* p_Parser, int32_t* p_Value, char Delimiter = ',');
+
+/** @brief           Get the next field as unsigned decimal number.
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Value   Pointer to number
+ *  @param Delimiter (Optional) Field delimiter
+ *  @return          #true when successful
+ *                   NOTE: The number is not changed and the error flag is set when the field is no valid number.
+ */
+bool SIM70XX_Parser_GetUInt(SIM70XX_Parser_t* p_Parser, uint32_t* p_Value, char Delimiter = ',');
+
+/** @brief           Get the next field as hexadecimal number (i. e. "1A2B" or "0x1A2B").
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Value   Pointer to number
+ *  @param Delimiter (Optional) Field delimiter
+ *  @return          #true when successful
+ *                   NOTE: The number is not changed and the error flag is set when the field is no valid number.
+ */
+bool SIM70XX_Parser_GetHex(SIM70XX_Parser_t* p_Parser, uint32_t* p_Value, char Delimiter = ',');
+
+/** @brief           Get the remaining part of the response.
+ *  @param p_Parser  Pointer to parser object
+ *  @param p_Field   Pointer to field object
+ */
+void SIM70XX_Parser_GetRemaining(SIM70XX_Parser_t* p_Parser, SIM70XX_Field_t* p_Field);
+
+/** @brief           Check if the parser has reached the end of the response.
+ *  @param p_Parser  Pointer to parser object
+ *  @return          #true when the end is reached
+ */
+inline bool SIM70XX_Parser_isEnd(const SIM70XX_Parser_t* p_Parser)
+{
+    return p_Parser->p_Position == NULL;
+}
+
+/** @brief           Check if a field is equal to a string.
+ *  @param p_Field   Pointer to field object
+ *  @param p_String  String to compare with
+ *  @return          #true when the field is equal to the string
+ */
+bool SIM70XX_Parser_isEqual(const SIM70XX_Field_t* p_Field, const char* p_String);
+
+#endif /* SIM70XX_PARSER_H_ */
@@ -0,0 +1,135 @@
+ /*
+ * sim70xx_port.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_PORT_H_
+#define SIM70XX_PORT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "sim70xx_defs.h"
+#include "sim70xx_errors.h"
+
+/** @brief UART port event definitions.
+ */
+typedef enum
+{
+    SIM70XX_PORT_EVT_DATA           = 0,            /**< New data or a line end was received. */
+    SIM70XX_PORT_EVT_FIFO_OVF,                      /**< The receive FIFO of the interface has overflowed. */
+    SIM70XX_PORT_EVT_BUFFER_FULL,                   /**< The receive buffer of the interface is full. */
+    SIM70XX_PORT_EVT_OTHER,                         /**< Any other event. */
+} SIM70XX_Port_Event_t;
+
+/** @brief          Install the serial driver for an interface and create the event queue.
+ *                  NOTE: The interface lock is taken by the caller.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_Port_UART_Init(SIM70XX_UART_Conf_t& p_Config);
+
+/** @brief          Remove the serial driver of an interface and release the pins.
+ *                  NOTE: The interface lock is taken by the caller.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ */
+void SIM70XX_Port_UART_Deinit(SIM70XX_UART_Conf_t& p_Config);
+
+/** @brief          Change the baudrate of the serial driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param Baudrate New baudrate
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_Port_UART_SetBaudrate(SIM70XX_UART_Conf_t& p_Config, uint32_t Baudrate);
+
+/** @brief          Enable or disable the RTS/CTS hardware flow control of the serial driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param Enable   Enable / Disable
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_Port_UART_SetFlowControl(SIM70XX_UART_Conf_t& p_Config, bool Enable);
+
+/** @brief          Write data to the serial driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Data   Pointer to data
+ *  @param Size     Length of data in bytes
+ */
+void SIM70XX_Port_UART_Write(SIM70XX_UART_Conf_t& p_Config, const void* p_Data, size_t Size);
+
+/** @brief          Read data from the serial driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Buffer Pointer to data buffer
+ *  @param Size     Maximum number of bytes to read
+ *  @param Ticks    Number of ticks to wait for the data
+ *  @return         Number of bytes read or -1 when an error occurs
+ */
+int SIM70XX_Port_UART_Read(SIM70XX_UART_Conf_t& p_Config, void* p_Buffer, size_t Size, TickType_t Ticks);
+
+/** @brief          Get the number of bytes in the receive buffer of the serial driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @return         Number of bytes
+ */
+size_t SIM70XX_Port_UART_GetBuffered(SIM70XX_UART_Conf_t& p_Config);
+
+/** @brief          Discard all data in the receive buffer of the serial driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ */
+void SIM70XX_Port_UART_Flush(SIM70XX_UART_Conf_t& p_Config);
+
+/** @brief          Get the next event from the event queue of the interface without blocking.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Event  Pointer to event
+ *  @return         #true when an event was received
+ */
+bool SIM70XX_Port_UART_GetEvent(SIM70XX_UART_Conf_t& p_Config, SIM70XX_Port_Event_t* p_Event);
+
+/** @brief          Configure a GPIO.
+ *  @param Pin      Pin number
+ *  @param isOutput Set to #true to use the pin as output
+ *  @param PullUp   Enable the pull-up resistor
+ *  @param PullDown Enable the pull-down resistor
+ */
+void SIM70XX_Port_GPIO_Config(gpio_num_t Pin, bool isOutput, bool PullUp, bool PullDown);
+
+/** @brief          Set the level of an output.
+ *  @param Pin      Pin number
+ *  @param Level    Output level
+ */
+void SIM70XX_Port_GPIO_SetLevel(gpio_num_t Pin, bool Level);
+
+/** @brief  Get the milliseconds from the system timer.
+ *  @return Milliseconds since start
+ */
+unsigned long SIM70XX_Port_GetmsTimer(void);
+
+/** @brief  Get the microseconds from the system timer.
+ *  @return Microseconds since start
+ */
+uint64_t SIM70XX_Port_GetusTimer(void);
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+    /** @brief          Use an open file descriptor (i.e. a pseudo terminal or a socket pair) for an interface.
+     *                  NOTE: Must be called before the interface is initialized. The descriptor isn´t closed by the driver.
+     *  @param Interface Interface number
+     *  @param FD       File descriptor or -1 to use the device from the configuration
+     *  @return         SIM70XX_ERR_OK when successful
+     */
+    SIM70XX_Error_t SIM70XX_Port_POSIX_SetDevice(uart_port_t Interface, int FD);
+#endif
+
+#endif /* SIM70XX_PORT_H_ */
@@ -0,0 +1,234 @@
+ /*
+ * sim70xx_port_esp32.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <sdkconfig.h>
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+
+#include <esp_err.h>
+#include <esp_attr.h>
+#include <esp_timer.h>
+
+#include <driver/uart.h>
+#include <driver/gpio.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+#include "sim70xx_port.h"
+
+#ifndef CONFIG_SIM70XX_UART_BUFFER_SIZE
+    #define CONFIG_SIM70XX_UART_BUFFER_SIZE                 256
+#endif
+
+#ifndef CONFIG_SIM70XX_UART_RX_BUFFER_SIZE
+    #define CONFIG_SIM70XX_UART_RX_BUFFER_SIZE              (CONFIG_SIM70XX_UART_BUFFER_SIZE * 2)
+#endif
+
+#ifndef CONFIG_SIM70XX_UART_TX_BUFFER_SIZE
+    #define CONFIG_SIM70XX_UART_TX_BUFFER_SIZE              1024
+#endif
+
+#ifndef CONFIG_SIM70XX_UART_FLOW_THRESH
+    #define CONFIG_SIM70XX_UART_FLOW_THRESH                 100
+#endif
+
+#ifndef CONFIG_SIM70XX_QUEUE_LENGTH
+    #define CONFIG_SIM70XX_QUEUE_LENGTH                     16
+#endif
+
+static uart_config_t _SIM70XX_Port_UART_Config = {
+    .baud_rate              = 0,
+    .data_bits              = UART_DATA_8_BITS,
+    .parity                 = UART_PARITY_DISABLE,
+    .stop_bits              = UART_STOP_BITS_1,
+    .flow_ctrl              = UART_HW_FLOWCTRL_DISABLE,
+    .rx_flow_ctrl_thresh    = 0,
+#ifdef CONFIG_PM_ENABLE
+    .source_clk             = UART_SCLK_REF_TICK,
+#else
+    .source_clk             = UART_SCLK_APB,
+#endif
+};
+
+SIM70XX_Error_t SIM70XX_Port_UART_Init(SIM70XX_UART_Conf_t& p_Config)
+{
+    _SIM70XX_Port_UART_Config.baud_rate = p_Config.Baudrate;
+
+    // NOTE: The pattern detection is used to generate an event for each received line end.
+    // NOTE: The RTS and CTS pins are assigned here, but the flow control is enabled after the module is configured.
+    // NOTE: The transmit buffer allows the communication task to continue with the reception while the data are transmitted.
+    if((uart_driver_install(p_Config.Interface, CONFIG_SIM70XX_UART_RX_BUFFER_SIZE, CONFIG_SIM70XX_UART_TX_BUFFER_SIZE, CONFIG_SIM70XX_QUEUE_LENGTH, &p_Config.EventQueue, 0) ||
+        uart_param_config(p_Config.Interface, &_SIM70XX_Port_UART_Config) ||
+        uart_set_pin(p_Config.Interface, p_Config.Tx, p_Config.Rx, p_Config.isFlowControl ? p_Config.Rts : UART_PIN_NO_CHANGE, p_Config.isFlowControl ? p_Config.Cts : UART_PIN_NO_CHANGE) ||
+        uart_enable_pattern_det_baud_intr(p_Config.Interface, '\n', 1, 9, 0, 0) ||
+        uart_pattern_queue_reset(p_Config.Interface, CONFIG_SIM70XX_QUEUE_LENGTH) ||
+        uart_flush(p_Config.Interface)) != ESP_OK)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+void SIM70XX_Port_UART_Deinit(SIM70XX_UART_Conf_t& p_Config)
+{
+    if(uart_is_driver_installed(p_Config.Interface) == false)
+    {
+        return;
+    }
+
+    uart_disable_pattern_det_intr(p_Config.Interface);
+    uart_flush(p_Config.Interface);
+    uart_driver_delete(p_Config.Interface);
+    gpio_reset_pin(p_Config.Rx);
+    gpio_reset_pin(p_Config.Tx);
+
+    if(p_Config.isFlowControl)
+    {
+        gpio_reset_pin(p_Config.Rts);
+        gpio_reset_pin(p_Config.Cts);
+    }
+}
+
+SIM70XX_Error_t SIM70XX_Port_UART_SetBaudrate(SIM70XX_UART_Conf_t& p_Config, uint32_t Baudrate)
+{
+    if(uart_set_baudrate(p_Config.Interface, Baudrate) != ESP_OK)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM70XX_Port_UART_SetFlowControl(SIM70XX_UART_Conf_t& p_Config, bool Enable)
+{
+    if(uart_set_hw_flow_ctrl(p_Config.Interface, Enable ? UART_HW_FLOWCTRL_CTS_RTS : UART_HW_FLOWCTRL_DISABLE, CONFIG_SIM70XX_UART_FLOW_THRESH) != ESP_OK)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+void SIM70XX_Port_UART_Write(SIM70XX_UART_Conf_t& p_Config, const void* p_Data, size_t Size)
+{
+    uart_write_bytes(p_Config.Interface, p_Data, Size);
+}
+
+int SIM70XX_Port_UART_Read(SIM70XX_UART_Conf_t& p_Config, void* p_Buffer, size_t Size, TickType_t Ticks)
+{
+    return uart_read_bytes(p_Config.Interface, p_Buffer, Size, Ticks);
+}
+
+size_t SIM70XX_Port_UART_GetBuffered(SIM70XX_UART_Conf_t& p_Config)
+{
+    size_t Avail;
+
+    if(uart_get_buffered_data_len(p_Config.Interface, &Avail) != ESP_OK)
+    {
+        return 0;
+    }
+
+    return Avail;
+}
+
+void SIM70XX_Port_UART_Flush(SIM70XX_UART_Conf_t& p_Config)
+{
+    uart_flush(p_Config.Interface);
+}
+
+bool SIM70XX_Port_UART_GetEvent(SIM70XX_UART_Conf_t& p_Config, SIM70XX_Port_Event_t* p_Event)
+{
+    uart_event_t Event;
+
+    if(xQueueReceive(p_Config.EventQueue, &Event, 0) != pdPASS)
+    {
+        return false;
+    }
+
+    switch(Event.type)
+    {
+        case UART_DATA:
+        {
+            *p_Event = SIM70XX_PORT_EVT_DATA;
+
+            break;
+        }
+        case UART_PATTERN_DET:
+        {
+            // NOTE: The line ends are searched in the receive ring buffer of the UART module. So we only have to clear the position queue here.
+            while(uart_pattern_pop_pos(p_Config.Interface) != -1);
+
+            *p_Event = SIM70XX_PORT_EVT_DATA;
+
+            break;
+        }
+        case UART_FIFO_OVF:
+        {
+            *p_Event = SIM70XX_PORT_EVT_FIFO_OVF;
+
+            break;
+        }
+        case UART_BUFFER_FULL:
+        {
+            *p_Event = SIM70XX_PORT_EVT_BUFFER_FULL;
+
+            break;
+        }
+        default:
+        {
+            *p_Event = SIM70XX_PORT_EVT_OTHER;
+
+            break;
+        }
+    }
+
+    return true;
+}
+
+void SIM70XX_Port_GPIO_Config(gpio_num_t Pin, bool isOutput, bool PullUp, bool PullDown)
+{
+    gpio_config_t Config = {
+        .pin_bit_mask = (1ULL << Pin),
+        .mode = isOutput ? GPIO_MODE_OUTPUT : GPIO_MODE_INPUT,
+        .pull_up_en = PullUp ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+        .pull_down_en = PullDown ? GPIO_PULLDOWN_ENABLE : GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+
+    gpio_config(&Config);
+}
+
+void SIM70XX_Port_GPIO_SetLevel(gpio_num_t Pin, bool Level)
+{
+    gpio_set_level(Pin, Level);
+}
+
+unsigned long IRAM_ATTR SIM70XX_Port_GetmsTimer(void)
+{
+    return (unsigned long)(esp_timer_get_time() / 1000ULL);
+}
+
+uint64_t IRAM_ATTR SIM70XX_Port_GetusTimer(void)
+{
+    return (uint64_t)esp_timer_get_time();
+}
+
+#endif
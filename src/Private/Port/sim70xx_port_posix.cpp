@@ -0,0 +1,594 @@
+ /*
+ * sim70xx_port_posix.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <sdkconfig.h>
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+
+#include <esp_log.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+#include <time.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <string.h>
+#include <termios.h>
+
+#include <atomic>
+#include <algorithm>
+
+#include "sim70xx_port.h"
+
+#ifndef CONFIG_SIM70XX_UART_BUFFER_SIZE
+    #define CONFIG_SIM70XX_UART_BUFFER_SIZE                 256
+#endif
+
+#ifndef CONFIG_SIM70XX_UART_RX_BUFFER_SIZE
+    #define CONFIG_SIM70XX_UART_RX_BUFFER_SIZE              (CONFIG_SIM70XX_UART_BUFFER_SIZE * 2)
+#endif
+
+#ifndef CONFIG_SIM70XX_QUEUE_LENGTH
+    #define CONFIG_SIM70XX_QUEUE_LENGTH                     16
+#endif
+
+#ifndef CONFIG_SIM70XX_PORT_POSIX_DEVICE
+    #define CONFIG_SIM70XX_PORT_POSIX_DEVICE                "/dev/ttyUSB%d"
+#endif
+
+/** @brief POSIX serial interface object definition.
+ *         NOTE: A reader task moves the data from the file descriptor into the receive buffer and emulates the events of the UART driver.
+ *         NOTE: The receive buffer is a lock free single producer / single consumer ring. The reader task only writes the tail and
+ *               the communication task only writes the head. One byte of the buffer is always left free to detect a full buffer.
+ */
+typedef struct
+{
+    int FD;                                                 /**< File descriptor of the interface. */
+    bool isExternal;                                        /**< #true when the file descriptor was set with #SIM70XX_Port_POSIX_SetDevice. */
+    volatile bool isRunning;                                /**< #true while the reader task is running. */
+    TaskHandle_t Task;                                      /**< Handle of the reader task. */
+    QueueHandle_t EventQueue;                               /**< Event queue of the interface. */
+    SemaphoreHandle_t Ready;                                /**< Given by the reader task when new data are available. */
+    uint8_t Data[CONFIG_SIM70XX_UART_RX_BUFFER_SIZE];       /**< Receive buffer memory. */
+    std::atomic<size_t> Head;                               /**< Read position. Written by the consumer. */
+    std::atomic<size_t> Tail;                               /**< Write position. Written by the producer. */
+    size_t BytesPerTick;                                    /**< Number of bytes which can be transmitted or received during one tick.
+                                                                 NOTE: Only used for interfaces without a baudrate. 0 disables the limit. */
+} SIM70XX_Port_POSIX_t;
+
+static SIM70XX_Port_POSIX_t _SIM70XX_Port_POSIX[UART_NUM_MAX] = {
+    {.FD = -1},
+    {.FD = -1},
+    {.FD = -1},
+};
+
+static const char* TAG = "SIM70XX_Port";
+
+/** @brief          Convert a baudrate into a termios speed definition.
+ *  @param Baudrate Baudrate
+ *  @return         Speed definition or B0 when the baudrate isn´t supported
+ */
+static speed_t SIM70XX_Port_POSIX_Speed(uint32_t Baudrate)
+{
+    switch(Baudrate)
+    {
+        case 4800:
+        {
+            return B4800;
+        }
+        case 9600:
+        {
+            return B9600;
+        }
+        case 19200:
+        {
+            return B19200;
+        }
+        case 38400:
+        {
+            return B38400;
+        }
+        case 57600:
+        {
+            return B57600;
+        }
+        case 115200:
+        {
+            return B115200;
+        }
+        case 230400:
+        {
+            return B230400;
+        }
+        case 460800:
+        {
+            return B460800;
+        }
+        case 921600:
+        {
+            return B921600;
+        }
+        default:
+        {
+            return B0;
+        }
+    }
+}
+
+/** @brief      Check if a file descriptor belongs to a serial line with a baudrate.
+ *  @param FD   File descriptor
+ *  @return     #true when the file descriptor is a serial line
+ */
+static bool SIM70XX_Port_POSIX_isSerial(int FD)
+{
+    const char* Name;
+
+    if(isatty(FD) == false)
+    {
+        return false;
+    }
+
+    // Pseudo terminals accept a baudrate, but they are transferring the data without any delay.
+    Name = ttyname(FD);
+
+    return (Name != NULL) && (strncmp(Name, "/dev/pts/", 9) != 0);
+}
+
+/** @brief          Emit an event for the communication task.
+ *  @param p_Port   Pointer to POSIX serial interface object
+ *  @param Event    Event
+ */
+static void SIM70XX_Port_POSIX_PostEvent(SIM70XX_Port_POSIX_t* p_Port, SIM70XX_Port_Event_t Event)
+{
+    // NOTE: A full event queue already wakes up the communication task, so the event can be dropped.
+    xQueueSend(p_Port->EventQueue, &Event, 0);
+}
+
+/** @brief          Reader task for a POSIX serial interface.
+ *                  NOTE: The file descriptor is polled without blocking, because a blocking system call would block the FreeRTOS scheduler.
+ *  @param p_Arg    Pointer to POSIX serial interface object
+ */
+static void SIM70XX_Port_POSIX_Task(void* p_Arg)
+{
+    SIM70XX_Port_POSIX_t* Port;
+
+    Port = (SIM70XX_Port_POSIX_t*)p_Arg;
+
+    while(Port->isRunning)
+    {
+        int Read;
+        size_t Head;
+        size_t Tail;
+        size_t Length;
+        struct pollfd Poll;
+
+        Poll.fd = Port->FD;
+        Poll.events = POLLIN;
+        Poll.revents = 0;
+        if((poll(&Poll, 1, 0) <= 0) || ((Poll.revents & POLLIN) == 0))
+        {
+            vTaskDelay(1);
+
+            continue;
+        }
+
+        Head = Port->Head.load(std::memory_order_acquire);
+        Tail = Port->Tail.load(std::memory_order_relaxed);
+        if(((Tail + 1) % sizeof(Port->Data)) == Head)
+        {
+            SIM70XX_Port_POSIX_PostEvent(Port, SIM70XX_PORT_EVT_BUFFER_FULL);
+            vTaskDelay(1);
+
+            continue;
+        }
+
+        // Get the free contiguous block behind the write position.
+        if(Tail >= Head)
+        {
+            Length = sizeof(Port->Data) - Tail - ((Head == 0) ? 1 : 0);
+        }
+        else
+        {
+            Length = Head - Tail - 1;
+        }
+
+        if(Port->BytesPerTick > 0)
+        {
+            Length = std::min(Length, Port->BytesPerTick);
+        }
+
+        Read = read(Port->FD, &Port->Data[Tail], Length);
+        if(Read > 0)
+        {
+            Port->Tail.store((Tail + Read) % sizeof(Port->Data), std::memory_order_release);
+
+            xSemaphoreGive(Port->Ready);
+            SIM70XX_Port_POSIX_PostEvent(Port, SIM70XX_PORT_EVT_DATA);
+
+            if(Port->BytesPerTick > 0)
+            {
+                vTaskDelay(1);
+            }
+        }
+        else if((Read == 0) || ((errno != EAGAIN) && (errno != EINTR)))
+        {
+            // NOTE: The remote side has closed the connection.
+            vTaskDelay(10);
+        }
+    }
+
+    Port->Task = NULL;
+    vTaskDelete(NULL);
+}
+
+SIM70XX_Error_t SIM70XX_Port_POSIX_SetDevice(uart_port_t Interface, int FD)
+{
+    if((Interface < 0) || (Interface >= UART_NUM_MAX))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(_SIM70XX_Port_POSIX[Interface].isRunning)
+    {
+        return SIM70XX_ERR_INVALID_STATE;
+    }
+
+    _SIM70XX_Port_POSIX[Interface].FD = FD;
+    _SIM70XX_Port_POSIX[Interface].isExternal = (FD >= 0);
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM70XX_Port_UART_Init(SIM70XX_UART_Conf_t& p_Config)
+{
+    SIM70XX_Port_POSIX_t* Port;
+
+    if((p_Config.Interface < 0) || (p_Config.Interface >= UART_NUM_MAX))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    if(Port->isExternal == false)
+    {
+        char Device[64];
+
+        snprintf(Device, sizeof(Device), CONFIG_SIM70XX_PORT_POSIX_DEVICE, p_Config.Interface);
+
+        Port->FD = open(Device, O_RDWR | O_NOCTTY);
+        if(Port->FD < 0)
+        {
+            ESP_LOGE(TAG, "Can not open %s: %s", Device, strerror(errno));
+
+            return SIM70XX_ERR_NOT_INITIALIZED;
+        }
+    }
+
+    fcntl(Port->FD, F_SETFL, fcntl(Port->FD, F_GETFL) | O_NONBLOCK);
+
+    // Use the raw mode when the interface is a terminal.
+    if(isatty(Port->FD))
+    {
+        struct termios Settings;
+
+        tcgetattr(Port->FD, &Settings);
+        cfmakeraw(&Settings);
+        tcsetattr(Port->FD, TCSANOW, &Settings);
+    }
+
+    Port->Head.store(0);
+    Port->Tail.store(0);
+    Port->EventQueue = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(SIM70XX_Port_Event_t));
+    Port->Ready = xSemaphoreCreateBinary();
+    if((Port->EventQueue == NULL) || (Port->Ready == NULL))
+    {
+        SIM70XX_Port_UART_Deinit(p_Config);
+
+        return SIM70XX_ERR_NO_MEM;
+    }
+
+    if(SIM70XX_Port_UART_SetBaudrate(p_Config, p_Config.Baudrate) != SIM70XX_ERR_OK)
+    {
+        SIM70XX_Port_UART_Deinit(p_Config);
+
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    Port->isRunning = true;
+    if(xTaskCreate(SIM70XX_Port_POSIX_Task, "SIM70XX_Port", 4096, Port, tskIDLE_PRIORITY + 1, &Port->Task) != pdPASS)
+    {
+        Port->isRunning = false;
+        SIM70XX_Port_UART_Deinit(p_Config);
+
+        return SIM70XX_ERR_NO_MEM;
+    }
+
+    p_Config.EventQueue = Port->EventQueue;
+
+    return SIM70XX_ERR_OK;
+}
+
+void SIM70XX_Port_UART_Deinit(SIM70XX_UART_Conf_t& p_Config)
+{
+    SIM70XX_Port_POSIX_t* Port;
+
+    if((p_Config.Interface < 0) || (p_Config.Interface >= UART_NUM_MAX))
+    {
+        return;
+    }
+
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    // Wait until the reader task has stopped.
+    Port->isRunning = false;
+    while(Port->Task != NULL)
+    {
+        vTaskDelay(1);
+    }
+
+    if(Port->EventQueue != NULL)
+    {
+        vQueueDelete(Port->EventQueue);
+        Port->EventQueue = NULL;
+    }
+
+    if(Port->Ready != NULL)
+    {
+        vSemaphoreDelete(Port->Ready);
+        Port->Ready = NULL;
+    }
+
+    if((Port->isExternal == false) && (Port->FD >= 0))
+    {
+        close(Port->FD);
+        Port->FD = -1;
+    }
+}
+
+SIM70XX_Error_t SIM70XX_Port_UART_SetBaudrate(SIM70XX_UART_Conf_t& p_Config, uint32_t Baudrate)
+{
+    speed_t Speed;
+    struct termios Settings;
+    SIM70XX_Port_POSIX_t* Port;
+
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    // NOTE: Pseudo terminals, pipes and sockets don´t have a baudrate. So the transfer rate of the serial line is emulated to get a realistic timing on the host.
+    if(SIM70XX_Port_POSIX_isSerial(Port->FD) == false)
+    {
+        #ifdef CONFIG_SIM70XX_PORT_POSIX_EMULATE_BAUDRATE
+            // One start bit, eight data bits and one stop bit for each byte.
+            Port->BytesPerTick = std::max((size_t)1, (size_t)(Baudrate / (10 * configTICK_RATE_HZ)));
+        #else
+            Port->BytesPerTick = 0;
+        #endif
+
+        return SIM70XX_ERR_OK;
+    }
+
+    Port->BytesPerTick = 0;
+
+    Speed = SIM70XX_Port_POSIX_Speed(Baudrate);
+    if((Speed == B0) || (tcgetattr(Port->FD, &Settings) != 0))
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    cfsetispeed(&Settings, Speed);
+    cfsetospeed(&Settings, Speed);
+    if(tcsetattr(Port->FD, TCSADRAIN, &Settings) != 0)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM70XX_Port_UART_SetFlowControl(SIM70XX_UART_Conf_t& p_Config, bool Enable)
+{
+    struct termios Settings;
+    SIM70XX_Port_POSIX_t* Port;
+
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    if(isatty(Port->FD) == false)
+    {
+        return SIM70XX_ERR_OK;
+    }
+
+    if(tcgetattr(Port->FD, &Settings) != 0)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    if(Enable)
+    {
+        Settings.c_cflag |= CRTSCTS;
+    }
+    else
+    {
+        Settings.c_cflag &= ~CRTSCTS;
+    }
+
+    if(tcsetattr(Port->FD, TCSADRAIN, &Settings) != 0)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+void SIM70XX_Port_UART_Write(SIM70XX_UART_Conf_t& p_Config, const void* p_Data, size_t Size)
+{
+    const uint8_t* p_Buffer;
+    SIM70XX_Port_POSIX_t* Port;
+
+    p_Buffer = (const uint8_t*)p_Data;
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    while(Size > 0)
+    {
+        ssize_t Written;
+
+        Written = write(Port->FD, p_Buffer, (Port->BytesPerTick > 0) ? std::min(Size, Port->BytesPerTick) : Size);
+        if(Written > 0)
+        {
+            p_Buffer += Written;
+            Size -= Written;
+
+            if(Port->BytesPerTick > 0)
+            {
+                vTaskDelay(1);
+            }
+        }
+        else if((Written < 0) && ((errno == EAGAIN) || (errno == EINTR)))
+        {
+            vTaskDelay(1);
+        }
+        else
+        {
+            ESP_LOGE(TAG, "Write error: %s", strerror(errno));
+
+            return;
+        }
+    }
+}
+
+int SIM70XX_Port_UART_Read(SIM70XX_UART_Conf_t& p_Config, void* p_Buffer, size_t Size, TickType_t Ticks)
+{
+    size_t Read;
+    size_t Head;
+    size_t Tail;
+    TickType_t Start;
+    SIM70XX_Port_POSIX_t* Port;
+
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    if(Port->Ready == NULL)
+    {
+        return -1;
+    }
+
+    // NOTE: A pending signal from older data can end the wait early. Wait again until new data are available or the time is over.
+    Head = Port->Head.load(std::memory_order_relaxed);
+    Start = xTaskGetTickCount();
+    while(Port->Tail.load(std::memory_order_acquire) == Head)
+    {
+        TickType_t Elapsed;
+
+        Elapsed = xTaskGetTickCount() - Start;
+        if((Ticks != portMAX_DELAY) && (Elapsed >= Ticks))
+        {
+            break;
+        }
+
+        xSemaphoreTake(Port->Ready, (Ticks == portMAX_DELAY) ? portMAX_DELAY : (Ticks - Elapsed));
+    }
+
+    Read = 0;
+    Tail = Port->Tail.load(std::memory_order_acquire);
+    while((Read < Size) && (Head != Tail))
+    {
+        size_t Block;
+
+        Block = std::min(Size - Read, ((Tail > Head) ? Tail : sizeof(Port->Data)) - Head);
+        memcpy(&((uint8_t*)p_Buffer)[Read], &Port->Data[Head], Block);
+
+        Head = (Head + Block) % sizeof(Port->Data);
+        Read += Block;
+    }
+    Port->Head.store(Head, std::memory_order_release);
+
+    return Read;
+}
+
+size_t SIM70XX_Port_UART_GetBuffered(SIM70XX_UART_Conf_t& p_Config)
+{
+    size_t Head;
+    size_t Tail;
+    SIM70XX_Port_POSIX_t* Port;
+
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    Head = Port->Head.load(std::memory_order_relaxed);
+    Tail = Port->Tail.load(std::memory_order_acquire);
+
+    return (Tail + sizeof(Port->Data) - Head) % sizeof(Port->Data);
+}
+
+void SIM70XX_Port_UART_Flush(SIM70XX_UART_Conf_t& p_Config)
+{
+    SIM70XX_Port_POSIX_t* Port;
+
+    Port = &_SIM70XX_Port_POSIX[p_Config.Interface];
+
+    if(Port->Ready == NULL)
+    {
+        return;
+    }
+
+    if(isatty(Port->FD))
+    {
+        tcflush(Port->FD, TCIFLUSH);
+    }
+
+    // NOTE: Only the consumer is allowed to move the read position.
+    Port->Head.store(Port->Tail.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+bool SIM70XX_Port_UART_GetEvent(SIM70XX_UART_Conf_t& p_Config, SIM70XX_Port_Event_t* p_Event)
+{
+    return xQueueReceive(p_Config.EventQueue, p_Event, 0) == pdPASS;
+}
+
+void SIM70XX_Port_GPIO_Config(gpio_num_t Pin, bool isOutput, bool PullUp, bool PullDown)
+{
+    ESP_LOGD(TAG, "Configure GPIO %d as %s", Pin, isOutput ? "output" : "input");
+}
+
+void SIM70XX_Port_GPIO_SetLevel(gpio_num_t Pin, bool Level)
+{
+    ESP_LOGD(TAG, "Set GPIO %d: %u", Pin, Level);
+}
+
+unsigned long SIM70XX_Port_GetmsTimer(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return (unsigned long)((Now.tv_sec * 1000ULL) + (Now.tv_nsec / 1000000ULL));
+}
+
+uint64_t SIM70XX_Port_GetusTimer(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return (Now.tv_sec * 1000000ULL) + (Now.tv_nsec / 1000ULL);
+}
+
+#endif
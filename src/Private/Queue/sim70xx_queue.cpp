@@ -22,163 +22,558 @@
 #include "sim70xx_queue.h"
 #include "sim70xx_tools.h"
 
+/** @brief Command pool object definition.
+ */
+typedef struct
+{
+    SemaphoreHandle_t Done;                         /**< Completion handle of the command object. */
+    StaticSemaphore_t DoneBuffer;                   /**< Memory for the completion handle. */
+    size_t Capacity;                                /**< Total capacity of the command buffers after the last release. */
+    unsigned long Start;                            /**< Time when the command was pushed into the transmit queue. */
+    bool isUsed;                                    /**< #true when the command object is in use. */
+} SIM70XX_Queue_Slot_t;
+
+static SIM70XX_TxCmd_t _SIM70XX_Queue_Commands[CONFIG_SIM70XX_CMD_POOL_SIZE];
+static SIM70XX_Queue_Slot_t _SIM70XX_Queue_Pool[CONFIG_SIM70XX_CMD_POOL_SIZE];
+static SIM70XX_Statistics_t _SIM70XX_Queue_Stats;
+static bool _SIM70XX_Queue_isInitialized = false;
+static portMUX_TYPE _SIM70XX_Queue_Lock = portMUX_INITIALIZER_UNLOCKED;
+
 static const char* TAG = "SIM70XX_Queue";
 
-SIM70XX_Error_t SIM70XX_Queue_PopItem(QueueHandle_t Queue, std::string* p_Response, std::string* p_Status)
+/** @brief              Get the pool object for a command object.
+ *  @param p_Command    Pointer to command object
+ *  @return             Pointer to pool object
+ */
+static inline SIM70XX_Queue_Slot_t* SIM70XX_Queue_GetSlot(SIM70XX_TxCmd_t* p_Command)
 {
-    uint32_t MessagesInQueue;
-    SIM70XX_CmdResp_t* Rx;
-    SIM70XX_Error_t Error = SIM70XX_ERR_OK;
+    return &_SIM70XX_Queue_Pool[p_Command - _SIM70XX_Queue_Commands];
+}
+
+/** @brief              Get the total capacity of the buffers of a command object.
+ *  @param p_Command    Pointer to command object
+ *  @return             Buffer capacity
+ */
+static inline size_t SIM70XX_Queue_GetCapacity(SIM70XX_TxCmd_t* p_Command)
+{
+    return p_Command->Command.capacity() + p_Command->Result.Response.capacity() + p_Command->Result.Status.capacity();
+}
+
+void SIM70XX_Queue_Init(void)
+{
+    if(_SIM70XX_Queue_isInitialized)
+    {
+        return;
+    }
+
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_CMD_POOL_SIZE; i++)
+    {
+        SIM70XX_Queue_Slot_t* Slot = &_SIM70XX_Queue_Pool[i];
+        SIM70XX_TxCmd_t* Command = &_SIM70XX_Queue_Commands[i];
+
+        Command->Command.reserve(CONFIG_SIM70XX_CMD_COMMAND_LENGTH);
+        Command->Result.Response.reserve(CONFIG_SIM70XX_CMD_RESPONSE_LENGTH);
+        Command->Result.Status.reserve(32);
+        Slot->Done = xSemaphoreCreateBinaryStatic(&Slot->DoneBuffer);
+        Slot->Capacity = SIM70XX_Queue_GetCapacity(Command);
+        Slot->isUsed = false;
+    }
+
+    _SIM70XX_Queue_isInitialized = true;
+}
+
+/** @brief              Return a command object to the command pool.
+ *  @param p_Command    Pointer to command object
+ */
+static void SIM70XX_Queue_Release(SIM70XX_TxCmd_t* p_Command)
+{
+    size_t Capacity;
+    SIM70XX_Queue_Slot_t* Slot = SIM70XX_Queue_GetSlot(p_Command);
+
+    // NOTE: The strings will keep their capacity. So we only need to allocate new memory when a buffer has to grow.
+    p_Command->Command.clear();
+    p_Command->Result.Response.clear();
+    p_Command->Result.Status.clear();
+    Capacity = SIM70XX_Queue_GetCapacity(p_Command);
+
+    // Drop a pending notification from an abandoned command.
+    xSemaphoreTake(Slot->Done, 0);
+
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    if(Capacity != Slot->Capacity)
+    {
+        _SIM70XX_Queue_Stats.Allocations++;
+        Slot->Capacity = Capacity;
+    }
+    Slot->isUsed = false;
+    _SIM70XX_Queue_Stats.Used--;
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
+}
+
+SIM70XX_TxCmd_t* SIM70XX_Queue_Acquire(void)
+{
+    SIM70XX_TxCmd_t* Command = NULL;
+
+    if(_SIM70XX_Queue_isInitialized == false)
+    {
+        return NULL;
+    }
+
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_CMD_POOL_SIZE; i++)
+    {
+        if(_SIM70XX_Queue_Pool[i].isUsed == false)
+        {
+            _SIM70XX_Queue_Pool[i].isUsed = true;
+            Command = &_SIM70XX_Queue_Commands[i];
+
+            _SIM70XX_Queue_Stats.Used++;
+            if(_SIM70XX_Queue_Stats.Used > _SIM70XX_Queue_Stats.Peak)
+            {
+                _SIM70XX_Queue_Stats.Peak = _SIM70XX_Queue_Stats.Used;
+            }
+
+            break;
+        }
+    }
+
+    if(Command == NULL)
+    {
+        _SIM70XX_Queue_Stats.Exhausted++;
+    }
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
+
+    if(Command == NULL)
+    {
+        ESP_LOGE(TAG, "Command pool exhausted!");
+    }
+
+    return Command;
+}
+
+void SIM70XX_Queue_WakeAll(void)
+{
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_CMD_POOL_SIZE; i++)
+    {
+        // NOTE: The waiting task checks the state of the command after the wake up. A pending notification is removed when the command is released.
+        if(_SIM70XX_Queue_Pool[i].isUsed)
+        {
+            xSemaphoreGive(_SIM70XX_Queue_Pool[i].Done);
+        }
+    }
+}
+
+void SIM70XX_Queue_GetStatistics(SIM70XX_Statistics_t* p_Stats)
+{
+    if(p_Stats == NULL)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    *p_Stats = _SIM70XX_Queue_Stats;
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
+}
+
+SIM70XX_Error_t SIM70XX_Queue_Create(SIM70XX_TxQueue_t* p_Queue)
+{
+    if(p_Queue == NULL)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    p_Queue->Lanes[SIM70XX_LANE_CONTROL] = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(SIM70XX_TxCmd_t*));
+    p_Queue->Lanes[SIM70XX_LANE_BULK] = xQueueCreate(CONFIG_SIM70XX_QUEUE_BULK_LENGTH, sizeof(SIM70XX_TxCmd_t*));
+    if((p_Queue->Lanes[SIM70XX_LANE_CONTROL] == NULL) || (p_Queue->Lanes[SIM70XX_LANE_BULK] == NULL))
+    {
+        SIM70XX_Queue_Delete(p_Queue);
+
+        return SIM70XX_ERR_NO_MEM;
+    }
+
+    return SIM70XX_ERR_OK;
+}
 
-    if(Queue == NULL)
+void SIM70XX_Queue_Delete(SIM70XX_TxQueue_t* p_Queue)
+{
+    if(p_Queue == NULL)
+    {
+        return;
+    }
+
+    for(uint32_t i = 0; i < SIM70XX_LANE_COUNT; i++)
+    {
+        if(p_Queue->Lanes[i] != NULL)
+        {
+            vQueueDelete(p_Queue->Lanes[i]);
+            p_Queue->Lanes[i] = NULL;
+        }
+    }
+}
+
+SIM70XX_Error_t SIM70XX_Queue_Push(SIM70XX_TxQueue_t& Queue, SIM70XX_TxCmd_t* p_Command, TickType_t Ticks)
+{
+    QueueHandle_t Lane;
+
+    if(p_Command == NULL)
     {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    Lane = Queue.Lanes[p_Command->Lane];
+    if(Lane == NULL)
+    {
+        SIM70XX_Queue_Release(p_Command);
+
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    // Check if the queue is empty.
-    MessagesInQueue = uxQueueMessagesWaiting(Queue);
-    if(MessagesInQueue == 0)
+    // NOTE: The flags are set here, because the command object is overwritten by the command definition.
+    p_Command->isDone = false;
+    p_Command->isAbandoned = false;
+    SIM70XX_Queue_GetSlot(p_Command)->Start = SIM70XX_Tools_GetmsTimer();
+
+    // Limit the time in the transmit queue. The response timeout starts when the command is transmitted.
+    if((p_Command->Deadline == 0) && (p_Command->Timeout != 0))
+    {
+        p_Command->Deadline = SIM70XX_Queue_GetSlot(p_Command)->Start + CONFIG_SIM70XX_CMD_QUEUE_TIMEOUT;
+        p_Command->isQueueDeadline = true;
+    }
+
+    if(xQueueSend(Lane, &p_Command, Ticks) != pdPASS)
     {
-        return SIM70XX_ERR_QUEUE_EMPTY;
+        SIM70XX_Queue_Release(p_Command);
+
+        return SIM70XX_ERR_QUEUE_FULL;
     }
 
-    ESP_LOGD(TAG, "Items in queue before: %u", MessagesInQueue);
+    return SIM70XX_ERR_OK;
+}
 
-    Rx = new SIM70XX_CmdResp_t();
+SIM70XX_TxCmd_t* SIM70XX_Queue_Next(SIM70XX_TxQueue_t& Queue)
+{
+    SIM70XX_TxCmd_t* Command;
 
-    // Get the next item from the queue.
-    if(xQueueReceive(Queue, &Rx, portMAX_DELAY) != pdPASS)
+    // NOTE: Strict priority. The lanes are checked in the order of their priority.
+    for(uint32_t i = 0; i < SIM70XX_LANE_COUNT; i++)
     {
-        ESP_LOGE(TAG, "     Can not fetch item!");
+        if(xQueueReceive(Queue.Lanes[i], &Command, 0) == pdPASS)
+        {
+            return Command;
+        }
+    }
+
+    return NULL;
+}
 
-        Error = SIM70XX_ERR_QUEUE_ERR;
-        goto SIM7020_Wait_Exit;
+uint32_t SIM70XX_Queue_Pending(SIM70XX_TxQueue_t& Queue)
+{
+    uint32_t Pending;
+
+    Pending = 0;
+    for(uint32_t i = 0; i < SIM70XX_LANE_COUNT; i++)
+    {
+        Pending += uxQueueMessagesWaiting(Queue.Lanes[i]);
     }
 
-    MessagesInQueue = uxQueueMessagesWaiting(Queue);
-    ESP_LOGD(TAG, "Items in queue after: %u", MessagesInQueue);
+    return Pending;
+}
+
+SIM70XX_Error_t SIM70XX_Queue_PopItem(SIM70XX_TxCmd_t* p_Command, std::string* p_Response, std::string* p_Status)
+{
+    SIM70XX_Error_t Error = SIM70XX_ERR_OK;
 
-    if(Rx->isError)
+    if(p_Command == NULL)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    if(p_Command->Result.isError)
     {
         ESP_LOGE(TAG, "     Message error!");
 
         Error = SIM70XX_ERR_FAIL;
-        goto SIM7020_Wait_Exit;
     }
-    else if(Rx->isTimeout)
+    else if(p_Command->Result.isTimeout)
     {
         ESP_LOGE(TAG, "     Message timeout!");
 
         Error = SIM70XX_ERR_TIMEOUT;
-        goto SIM7020_Wait_Exit;
     }
 
-SIM7020_Wait_Exit:
     if(p_Response != NULL)
     {
-        *p_Response = Rx->Response.c_str();
+        *p_Response = p_Command->Result.Response;
     }
 
     if(p_Status != NULL)
     {
-        *p_Status = Rx->Status.c_str();
+        *p_Status = p_Command->Result.Status;
     }
 
-    // Release the allocated memory from the comTask.
-    delete Rx;
+    SIM70XX_Queue_Release(p_Command);
 
     return Error;
 }
 
-uint32_t SIM70XX_Queue_GetItems(QueueHandle_t Queue)
+/** @brief              Check if the caller can stop waiting for a command.
+ *  @param p_Command    Pointer to command object
+ *  @param Now          Start time of the wait
+ *  @param Timeout      Minimum wait timeout in seconds
+ *  @return             #true when the timeout and the deadline of the command have expired
+ */
+static bool SIM70XX_Queue_isWaitExpired(SIM70XX_TxCmd_t* p_Command, uint32_t Now, uint32_t Timeout)
 {
-    if(Queue == NULL)
+    if((Timeout == 0) || ((SIM70XX_Tools_GetmsTimer() - Now) < (Timeout * 1000UL)))
     {
-        return SIM70XX_ERR_NOT_INITIALIZED;
+        return false;
     }
 
-    return uxQueueMessagesWaiting(Queue);
+    return (p_Command->Deadline == 0) || SIM70XX_Queue_isExpired(p_Command);
 }
 
-bool SIM70XX_Queue_Wait(QueueHandle_t Queue, bool* p_Active, uint32_t Timeout)
+bool SIM70XX_Queue_Wait(SIM70XX_TxCmd_t* p_Command, bool* p_Active, uint32_t Timeout)
 {
+    bool isDone;
     uint32_t Now;
-    uint32_t ItemsInQueue;
-    uint32_t Timeout_Temp;
 
-    if((Queue == NULL) || (p_Active == NULL))
+    if((p_Command == NULL) || (p_Active == NULL))
     {
         return false;
     }
 
-    Timeout_Temp = Timeout * 1000UL;
-
+    isDone = false;
     Now = SIM70XX_Tools_GetmsTimer();
     do
     {
-        ItemsInQueue = uxQueueMessagesWaiting(Queue);
-        ESP_LOGD(TAG, "Items in queue: %u", ItemsInQueue);
+        TickType_t Ticks;
+        uint32_t Elapsed;
 
-        if(((Timeout != 0) && ((SIM70XX_Tools_GetmsTimer() - Now) > Timeout_Temp)) || (*p_Active == false))
+        // Block until the command is completed or until the timeout has expired.
+        // NOTE: #SIM70XX_Queue_WakeAll ends the wait early when the device is powered down. A running raw data transfer is checked every 100 ms.
+        Elapsed = SIM70XX_Tools_GetmsTimer() - Now;
+        if((*p_Active == false) || ((Timeout != 0) && (Elapsed >= (Timeout * 1000UL))))
+        {
+            // NOTE: The command may still wait in the transmit queue or for the response. The deadline is checked every 100 ms.
+            Ticks = 100 / portTICK_PERIOD_MS;
+        }
+        else if(Timeout == 0)
+        {
+            Ticks = portMAX_DELAY;
+        }
+        else
         {
-            ESP_LOGE(TAG, "Qeueue timeout");
+            Ticks = ((Timeout * 1000UL) - Elapsed) / portTICK_PERIOD_MS;
+        }
 
-            // Something has gone wrong. Clear the queue.
-            xQueueReset(Queue);
+        if((xSemaphoreTake(SIM70XX_Queue_GetSlot(p_Command)->Done, Ticks) == pdTRUE) && p_Command->isDone)
+        {
+            return true;
+        }
 
-            return false;
+        // Stop waiting for the command when the timeout and the deadline have expired. The command is released by the communication task when it is still in progress.
+        // NOTE: The communication task may use the raw data buffer of the caller. So we have to wait until the transfer is finished.
+        if(SIM70XX_Queue_isWaitExpired(p_Command, Now, Timeout) || (*p_Active == false))
+        {
+            portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+            isDone = p_Command->isDone;
+            if(p_Command->isRawActive == false)
+            {
+                p_Command->isAbandoned = true;
+            }
+            portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
         }
+    } while(p_Command->isAbandoned == false);
 
-        vTaskDelay(10 / portTICK_PERIOD_MS);
-    } while(ItemsInQueue == 0);
+    ESP_LOGE(TAG, "Command timeout");
 
-    return true;
+    if(isDone)
+    {
+        SIM70XX_Queue_Release(p_Command);
+    }
+
+    return false;
 }
 
-void SIM70XX_Queue_Reset(QueueHandle_t Queue)
+void SIM70XX_Queue_SetDeadline(SIM70XX_TxCmd_t* p_Command, unsigned long Deadline)
 {
-    if(Queue == NULL)
+    if(p_Command == NULL)
     {
         return;
     }
 
-    xQueueReset(Queue);
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    p_Command->Deadline = Deadline;
+    p_Command->isQueueDeadline = false;
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
 }
 
-bool SIM70XX_Queue_isEvent(QueueHandle_t Queue, std::string Filter, std::string* p_Event) 
+void SIM70XX_Queue_BeginTransmit(SIM70XX_TxCmd_t* p_Command)
 {
-    uint32_t ItemsInQueue;
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    if(p_Command->isQueueDeadline)
+    {
+        p_Command->Deadline = SIM70XX_Tools_GetmsTimer() + (p_Command->Timeout * 1000UL);
+        p_Command->isQueueDeadline = false;
+    }
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
+}
+
+bool SIM70XX_Queue_isExpired(SIM70XX_TxCmd_t* p_Command)
+{
+    bool isAbandoned;
+    unsigned long Deadline;
+
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    isAbandoned = p_Command->isAbandoned;
+    Deadline = p_Command->Deadline;
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
 
-    if(Queue == NULL)
+    // NOTE: The signed difference handles the overflow of the timer.
+    return isAbandoned || ((Deadline != 0) && ((long)(SIM70XX_Tools_GetmsTimer() - Deadline) >= 0));
+}
+
+void SIM70XX_Queue_Cancel(SIM70XX_TxCmd_t* p_Command)
+{
+    bool isActive;
+
+    if(p_Command == NULL)
     {
-        return false;
+        return;
     }
 
-    p_Event->clear();
+    SIM70XX_Queue_SetDeadline(p_Command, SIM70XX_Tools_GetmsTimer());
 
-    ItemsInQueue = uxQueueMessagesWaiting(Queue);
-    for(uint32_t i = 0; i < ItemsInQueue; i++)
+    // Stop waiting for the command. The command object is released by the communication task when the command is still in progress.
+    // NOTE: A running raw data transfer is finished first, because the module expects the announced number of bytes.
+    isActive = false;
+    if(SIM70XX_Queue_Wait(p_Command, &isActive, 0))
     {
-        std::string* Message;
+        SIM70XX_Queue_PopItem(p_Command);
+    }
+}
 
-        // Get a new item from the queue to check if the searched event has occured.
-        if(xQueuePeek(Queue, &Message, portMAX_DELAY) == pdTRUE)
-        {
-            // Check if the filter match the item.
-            if(Message->find(Filter) != std::string::npos)
-            {
-                *p_Event = *Message;
+SIM70XX_Error_t SIM70XX_Queue_WaitAll(SIM70XX_TxCmd_t** p_Commands, uint32_t Count, bool* p_Active)
+{
+    SIM70XX_Error_t Error = SIM70XX_ERR_OK;
 
-                // Remove the item from the queue.
-                xQueueReceive(Queue, &Message, 0);
+    if((p_Commands == NULL) || (p_Active == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
 
-                // Delete the item.
-                delete Message;
+    // NOTE: All commands must be processed to release the command objects.
+    for(uint32_t i = 0; i < Count; i++)
+    {
+        SIM70XX_Error_t Result;
 
-                return true;
-            }
+        if(SIM70XX_Queue_Wait(p_Commands[i], p_Active, p_Commands[i]->Timeout) == false)
+        {
+            Result = SIM70XX_ERR_FAIL;
+        }
+        else
+        {
+            Result = SIM70XX_Queue_PopItem(p_Commands[i]);
+        }
+
+        if(Error == SIM70XX_ERR_OK)
+        {
+            Error = Result;
         }
     }
 
-    return false;
+    return Error;
+}
+
+void SIM70XX_Queue_SetPayload(SIM70XX_TxCmd_t* p_Command, const void* p_Payload, size_t Length, SIM70XX_Encoding_t Encoding, const char* p_Suffix)
+{
+    p_Command->p_Payload = p_Payload;
+    p_Command->PayloadLength = Length;
+    p_Command->Encoding = Encoding;
+    p_Command->p_Suffix = p_Suffix;
+    p_Command->Lane = SIM70XX_LANE_BULK;
+}
+
+void SIM70XX_Queue_SetTxData(SIM70XX_TxCmd_t* p_Command, const char* p_Prompt, const void* p_Data, size_t Length)
+{
+    p_Command->p_Prompt = p_Prompt;
+    p_Command->p_TxData = p_Data;
+    p_Command->p_RxData = NULL;
+    p_Command->RawLength = Length;
+    p_Command->Lane = SIM70XX_LANE_BULK;
+}
+
+void SIM70XX_Queue_SetRxData(SIM70XX_TxCmd_t* p_Command, const char* p_Prompt, void* p_Buffer, size_t Length)
+{
+    p_Command->p_Prompt = p_Prompt;
+    p_Command->p_TxData = NULL;
+    p_Command->p_RxData = p_Buffer;
+    p_Command->RawLength = Length;
+    p_Command->Lane = SIM70XX_LANE_BULK;
+}
+
+bool SIM70XX_Queue_BeginRaw(SIM70XX_TxCmd_t* p_Command)
+{
+    bool isAbandoned;
+
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    isAbandoned = p_Command->isAbandoned;
+    if(isAbandoned == false)
+    {
+        p_Command->isRawActive = true;
+    }
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
+
+    return !isAbandoned;
+}
+
+void SIM70XX_Queue_EndRaw(SIM70XX_TxCmd_t* p_Command)
+{
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    p_Command->isRawActive = false;
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
+}
+
+void SIM70XX_Queue_Complete(SIM70XX_TxCmd_t* p_Command)
+{
+    bool isAbandoned;
+    uint32_t Bucket;
+    uint32_t Elapsed;
+
+    Elapsed = SIM70XX_Tools_GetmsTimer() - SIM70XX_Queue_GetSlot(p_Command)->Start;
+
+    // Get the histogram bucket from the number of significant bits.
+    Bucket = 0;
+    while((Bucket < (SIM70XX_STATS_LATENCY_BUCKETS - 1)) && ((Elapsed >> Bucket) != 0))
+    {
+        Bucket++;
+    }
+
+    portENTER_CRITICAL(&_SIM70XX_Queue_Lock);
+    p_Command->isDone = true;
+    isAbandoned = p_Command->isAbandoned;
+
+    _SIM70XX_Queue_Stats.Commands++;
+    _SIM70XX_Queue_Stats.LatencySum += Elapsed;
+    _SIM70XX_Queue_Stats.Latency[Bucket]++;
+    if(Elapsed > _SIM70XX_Queue_Stats.LatencyMax)
+    {
+        _SIM70XX_Queue_Stats.LatencyMax = Elapsed;
+    }
+
+    if(p_Command->Result.isTimeout)
+    {
+        _SIM70XX_Queue_Stats.Timeouts++;
+    }
+    portEXIT_CRITICAL(&_SIM70XX_Queue_Lock);
+
+    // Nobody is waiting for the command anymore. Release it.
+    if(isAbandoned)
+    {
+        SIM70XX_Queue_Release(p_Command);
+    }
+    else
+    {
+        xSemaphoreGive(SIM70XX_Queue_GetSlot(p_Command)->Done);
+    }
 }
\ No newline at end of file
@@ -28,37 +28,53 @@
 #include <freertos/task.h>
 #include <freertos/event_groups.h>
 #include <freertos/queue.h>
+#include <freertos/semphr.h>
 
 #include <sdkconfig.h>
 
+#include "sim70xx_defs.h"
 #include "sim70xx_errors.h"
 
+#include "../Commands/sim70xx_builder.h"
+
 #ifndef CONFIG_SIM70XX_QUEUE_LENGTH
     #define CONFIG_SIM70XX_QUEUE_LENGTH                         16
 #endif
 
-/** @brief  Push a item to the message queue.
- *          The item will be deleted and an error is generated when the message queue is full.
+#ifndef CONFIG_SIM70XX_QUEUE_BULK_LENGTH
+    #define CONFIG_SIM70XX_QUEUE_BULK_LENGTH                    4
+#endif
+
+#ifndef CONFIG_SIM70XX_CMD_POOL_SIZE
+    #define CONFIG_SIM70XX_CMD_POOL_SIZE                        16
+#endif
+
+#ifndef CONFIG_SIM70XX_CMD_COMMAND_LENGTH
+    #define CONFIG_SIM70XX_CMD_COMMAND_LENGTH                   128
+#endif
+
+#ifndef CONFIG_SIM70XX_CMD_RESPONSE_LENGTH
+    #define CONFIG_SIM70XX_CMD_RESPONSE_LENGTH                  256
+#endif
+
+#ifndef CONFIG_SIM70XX_CMD_QUEUE_TIMEOUT
+    #define CONFIG_SIM70XX_CMD_QUEUE_TIMEOUT                    10000
+#endif
+
+/** @brief  Push a command to the transmit queue.
+ *          The command will be deleted and an error is generated when the command can not be queued.
  */
 #define SIM70XX_PUSH_QUEUE(Queue, Command)                      do                                                              \
                                                                 {                                                               \
-                                                                    if(xQueueSend(Queue, &Command, portMAX_DELAY) != pdPASS)    \
+                                                                    SIM70XX_Error_t Error_Push;                                 \
+                                                                                                                                \
+                                                                    Error_Push = SIM70XX_Queue_Push(Queue, Command);            \
+                                                                    if(Error_Push != SIM70XX_ERR_OK)                            \
                                                                     {                                                           \
-                                                                        delete Command;                                         \
-                                                                        return SIM70XX_ERR_QUEUE_FULL;                          \
+                                                                        return Error_Push;                                      \
                                                                     }                                                           \
                                                                 } while(0);
 
-/** @brief SIM70XX Tx command (ESP32 -> Module) object definition.
- */
-typedef struct
-{
-    std::string Command;                            /**< AT command string. */
-    bool recData;                                   /**< Set to #true to receive data from the command. */
-    uint32_t Timeout;                               /**< Response timeout in seconds. */
-    uint16_t Lines;                                 /**< Number of response lines. */
-} SIM70XX_TxCmd_t;
-
 /** @brief  Command response object for the communication task
  *          NOTE: The object is completly handled by the driver.
  */
@@ -68,56 +84,254 @@ typedef struct
     std::string Status;                             /**< Command status. */
     bool isError;                                   /**< Set to #true when the module has reported an error. */
     bool isTimeout;                                 /**< Set to #true when the module has not send an answer before a timeout. */
+} SIM70XX_CmdResp_t;
+
+/** @brief SIM70XX Tx command (ESP32 -> Module) object definition.
+ *         The command object is also the completion handle for the command. It is owned by the caller until the caller
+ *         has stopped waiting for the command.
+ */
+typedef struct SIM70XX_TxCmd_t
+{
+    std::string Command;                            /**< AT command string. */
     bool recData;                                   /**< Set to #true to receive data from the command. */
-    uint8_t Lines;                                  /**< Number of response lines to receive (if a response was requested). */
-    uint32_t Length;                                /**< Length of the command in bytes. */
     uint32_t Timeout;                               /**< Response timeout in seconds. */
-} SIM70XX_CmdResp_t;
+    uint16_t Lines;                                 /**< Number of response lines. */
+    SIM70XX_CmdResp_t Result;                       /**< Result of the command.
+                                                         NOTE: Managed by the communication task. */
+    bool isDone;                                    /**< #true when the command was processed by the communication task.
+                                                         NOTE: Managed by the device driver. */
+    bool isAbandoned;                               /**< #true when the caller has stopped waiting for the command. The command is deleted by the communication task.
+                                                         NOTE: Managed by the device driver. */
+    const char* p_Prompt;                           /**< Prompt which starts a raw data transfer (e.g. "> " or "DOWNLOAD").
+                                                         NOTE: #NULL for commands without raw data. */
+    const void* p_TxData;                           /**< Raw data which are transmitted after the prompt.
+                                                         NOTE: The data are not copied. */
+    void* p_RxData;                                 /**< Buffer for the raw data which are received after the prompt.
+                                                         NOTE: The data are written directly into the buffer. */
+    size_t RawLength;                               /**< Number of raw bytes to transmit or the size of the receive buffer.
+                                                         NOTE: Set to the number of received bytes by the communication task. */
+    bool isRawActive;                               /**< #true while the communication task is using the raw data buffer or the payload.
+                                                         NOTE: Managed by the device driver. */
+    const void* p_Payload;                          /**< Payload which is transmitted as part of the command line, directly after the command string.
+                                                         NOTE: The data are not copied. */
+    size_t PayloadLength;                           /**< Length of the payload in bytes. */
+    SIM70XX_Encoding_t Encoding;                    /**< Encoding of the payload. */
+    const char* p_Suffix;                           /**< String which is transmitted after the payload (e.g. a closing quote).
+                                                         NOTE: The string is not copied. */
+    SIM70XX_Lane_t Lane;                            /**< Transmit queue lane of the command.
+                                                         NOTE: Commands with a payload or raw data are using the bulk lane. */
+    unsigned long Deadline;                         /**< Absolute time in milliseconds when the command expires.
+                                                         NOTE: Set to the push time plus #CONFIG_SIM70XX_CMD_QUEUE_TIMEOUT when no deadline is given and
+                                                               restarted with the timeout when the command is transmitted. Zero disables the deadline. */
+    bool isQueueDeadline;                           /**< #true while the deadline is the queue timeout from #SIM70XX_Queue_Push.
+                                                         NOTE: Managed by the device driver. */
+
+    /** @brief              Write a command definition into the command object.
+     *                      NOTE: The command string is written into the existing command buffer. So no memory is allocated
+     *                            as long as the command fits into the buffer.
+     *  @param p_Definition Command definition object
+     *  @return             Command object
+     */
+    template<bool HasData, uint32_t TimeOut, uint16_t Number, typename Formatter>
+    SIM70XX_TxCmd_t& operator=(const SIM70XX_CmdDef_t<HasData, TimeOut, Number, Formatter>& p_Definition)
+    {
+        SIM70XX_Builder_Sink_t Sink = {&Command, NULL, 0, 0, false};
+
+        Command.clear();
+        p_Definition.Format(&Sink);
+        recData = p_Definition.recData;
+        Timeout = p_Definition.Timeout;
+        Lines = p_Definition.Lines;
+        Result.Response.clear();
+        Result.Status.clear();
+        Result.isError = false;
+        Result.isTimeout = false;
+        p_Prompt = NULL;
+        p_TxData = NULL;
+        p_RxData = NULL;
+        RawLength = 0;
+        isRawActive = false;
+        p_Payload = NULL;
+        PayloadLength = 0;
+        Encoding = SIM70XX_ENC_RAW;
+        p_Suffix = NULL;
+        Lane = SIM70XX_LANE_CONTROL;
+        Deadline = 0;
+        isQueueDeadline = false;
+
+        return *this;
+    }
+} SIM70XX_TxCmd_t;
+
+/** @brief  Initialize the command pool.
+ *          NOTE: The buffers of the command pool are reserved once and reused for each command. A buffer only grows when a command
+ *                or a response doesn´t fit into it. This is counted in the driver statistics.
+ */
+void SIM70XX_Queue_Init(void);
+
+/** @brief  Get a command object from the command pool.
+ *          NOTE: The command object is returned to the pool by #SIM70XX_Queue_PopItem, #SIM70XX_Queue_Wait or #SIM70XX_Queue_Push.
+ *  @return Pointer to command object or #NULL when the pool is exhausted
+ */
+SIM70XX_TxCmd_t* SIM70XX_Queue_Acquire(void);
+
+/** @brief          Get the usage statistics of the command pool.
+ *  @param p_Stats  Pointer to statistics object
+ */
+void SIM70XX_Queue_GetStatistics(SIM70XX_Statistics_t* p_Stats);
+
+/** @brief          Create the lanes of a transmit queue.
+ *  @param p_Queue  Pointer to transmit queue
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_Queue_Create(SIM70XX_TxQueue_t* p_Queue);
+
+/** @brief          Delete the lanes of a transmit queue.
+ *  @param p_Queue  Pointer to transmit queue
+ */
+void SIM70XX_Queue_Delete(SIM70XX_TxQueue_t* p_Queue);
 
-/** @brief              Process the receive queue and get the next item from the queue.
- *                      NOTE: This function is used to get the immediate response and the status message from the device after transmitting a command.
- *                            This function must be called after transmitting a command to clear the receive queue.
- *                            This function will handle the allocated memory from the receive task.
- *  @param Queue        Message queue
+/** @brief              Push a command into the lane of the transmit queue.
+ *                      NOTE: The command is returned to the pool when it can not be queued.
+ *  @param Queue        Transmit queue
+ *  @param p_Command    Pointer to command object
+ *  @param Ticks        (Optional) Number of ticks to wait for a free entry in the lane
+ *                      NOTE: Set to zero to return immediately when the lane is full
+ *  @return             SIM70XX_ERR_OK when successful
+ *                      SIM70XX_ERR_QUEUE_FULL when the command can not be queued
+ */
+SIM70XX_Error_t SIM70XX_Queue_Push(SIM70XX_TxQueue_t& Queue, SIM70XX_TxCmd_t* p_Command, TickType_t Ticks = portMAX_DELAY);
+
+/** @brief          Get the next command from the transmit queue. The control lane is always served before the bulk lane.
+ *                  NOTE: This function is used by the communication task only.
+ *  @param Queue    Transmit queue
+ *  @return         Pointer to command object or #NULL when no command is pending
+ */
+SIM70XX_TxCmd_t* SIM70XX_Queue_Next(SIM70XX_TxQueue_t& Queue);
+
+/** @brief          Get the number of pending commands in all lanes of the transmit queue.
+ *  @param Queue    Transmit queue
+ *  @return         Number of pending commands
+ */
+uint32_t SIM70XX_Queue_Pending(SIM70XX_TxQueue_t& Queue);
+
+/** @brief              Get the result of a processed command and release the command object.
+ *                      NOTE: This function must be called after a successful call of #SIM70XX_Queue_Wait.
+ *  @param p_Command    Pointer to command object
  *  @param p_Response   (Optional) Pointer to command response string
  *  @param p_Status     (Optional) Pointer to response status string
  *  @return             SIM70XX_ERR_OK when successful
  *                      SIM70XX_ERR_INVALID_ARG when an invalid argument is passed into the function
- *                      SIM70XX_ERR_QUEUE_EMPTY when the receive queue is empty
- *                      SIM70XX_ERR_QUEUE_ERR when the item can not be popped from the queue
  *                      SIM70XX_ERR_FAIL when the device has reported an error
  *                      SIM70XX_ERR_TIMEOUT when a communication timeout has occured
  */
-SIM70XX_Error_t SIM70XX_Queue_PopItem(QueueHandle_t Queue, std::string* p_Response = NULL, std::string* p_Status = NULL);
+SIM70XX_Error_t SIM70XX_Queue_PopItem(SIM70XX_TxCmd_t* p_Command, std::string* p_Response = NULL, std::string* p_Status = NULL);
+
+/** @brief              Wait until a command was processed by the communication task.
+ *                      NOTE: The command object is released by the driver when the function returns #false.
+ *  @param p_Command    Pointer to command object
+ *  @param p_Active     Pointer to active state of the device
+ *  @param Timeout      (Optional) Minimum wait timeout in seconds. The wait is extended until the deadline of the command has expired,
+ *                      because the response timeout starts when the command is transmitted.
+ *                      NOTE: Set to zero to disable the timeout
+ *  @return             #true when the command was processed
+ */
+bool SIM70XX_Queue_Wait(SIM70XX_TxCmd_t* p_Command, bool* p_Active, uint32_t Timeout = 1);
+
+/** @brief              Set an absolute deadline for a command. The communication task doesn´t transmit the command after the deadline
+ *                      and stops to wait for the response when the deadline has expired.
+ *                      NOTE: Must be called before the command is pushed into the transmit queue.
+ *  @param p_Command    Pointer to command object
+ *  @param Deadline     Absolute time in milliseconds (see #SIM70XX_Tools_GetmsTimer)
+ */
+void SIM70XX_Queue_SetDeadline(SIM70XX_TxCmd_t* p_Command, unsigned long Deadline);
+
+/** @brief              Check if the deadline of a command has expired or if the caller has stopped waiting for the command.
+ *  @param p_Command    Pointer to command object
+ *  @return             #true when the command has expired
+ */
+bool SIM70XX_Queue_isExpired(SIM70XX_TxCmd_t* p_Command);
+
+/** @brief              Cancel a queued command and release the command object. A pending command is not transmitted anymore
+ *                      and a late response of a running command is discarded by the communication task.
+ *                      NOTE: This function is used instead of #SIM70XX_Queue_Wait by the task which has queued the command.
+ *  @param p_Command    Pointer to command object
+ */
+void SIM70XX_Queue_Cancel(SIM70XX_TxCmd_t* p_Command);
+
+/** @brief  Wake up all tasks which are waiting for a command.
+ *          NOTE: Used when the device is powered down, so no task waits until the command timeout.
+ */
+void SIM70XX_Queue_WakeAll(void);
+
+/** @brief              Wait for a list of queued commands and release all command objects.
+ *                      NOTE: This function can be used to process multiple independent commands without waiting for each response.
+ *                      NOTE: The commands are not pipelined. The communication task transmits a command after the response of the previous
+ *                            command was received. Only the wake up of the calling task between the commands is saved.
+ *  @param p_Commands   Pointer to list with command objects
+ *  @param Count        Number of commands in the list
+ *  @param p_Active     Pointer to active state of the device
+ *  @return             SIM70XX_ERR_OK when all commands were successful or the error of the first failed command
+ */
+SIM70XX_Error_t SIM70XX_Queue_WaitAll(SIM70XX_TxCmd_t** p_Commands, uint32_t Count, bool* p_Active);
+
+/** @brief              Attach a payload to the command line of a command. The command line is transmitted with the layout
+ *                          <Command><Payload><Suffix><CR><LF>
+ *                      NOTE: The payload and the suffix must stay valid until #SIM70XX_Queue_Wait has returned. #SIM70XX_Queue_Wait does not
+ *                            return while the payload is transmitted and the payload isn´t used after a failed wait.
+ *  @param p_Command    Pointer to command object
+ *  @param p_Payload    Pointer to payload
+ *  @param Length       Length of the payload in bytes
+ *  @param Encoding     Encoding of the payload. The payload is encoded during the transmission.
+ *  @param p_Suffix     (Optional) String after the payload
+ */
+void SIM70XX_Queue_SetPayload(SIM70XX_TxCmd_t* p_Command, const void* p_Payload, size_t Length, SIM70XX_Encoding_t Encoding, const char* p_Suffix = NULL);
+
+/** @brief              Attach raw data to a command. The data are transmitted by the communication task after the module has sent the prompt.
+ *                      NOTE: The data must stay valid until the command is completed. #SIM70XX_Queue_Wait does not return
+ *                            while the data are transmitted.
+ *  @param p_Command    Pointer to command object
+ *  @param p_Prompt     Prompt of the module (e.g. "> " or "DOWNLOAD")
+ *  @param p_Data       Pointer to data
+ *  @param Length       Number of bytes to transmit
+ */
+void SIM70XX_Queue_SetTxData(SIM70XX_TxCmd_t* p_Command, const char* p_Prompt, const void* p_Data, size_t Length);
+
+/** @brief              Attach a receive buffer to a command. After the prompt the module sends the data length, followed
+ *                      by ',' or a line end and the raw data. The data are written into the buffer by the communication task.
+ *                      NOTE: The buffer must stay valid until the command is completed. #SIM70XX_Queue_Wait does not return
+ *                            while the data are received.
+ *  @param p_Command    Pointer to command object
+ *  @param p_Prompt     Prompt of the module (e.g. "+CARECV: ")
+ *  @param p_Buffer     Pointer to receive buffer
+ *  @param Length       Size of the receive buffer
+ */
+void SIM70XX_Queue_SetRxData(SIM70XX_TxCmd_t* p_Command, const char* p_Prompt, void* p_Buffer, size_t Length);
 
-/** @brief          Get the items in the recieve queue.
- *  @param Queue    Message queue
- *  @return         Item count in the receive queue
+/** @brief              Start the response timeout of a command. A deadline from #SIM70XX_Queue_Push is replaced by the transmit time
+ *                      plus the timeout of the command, so the time in the transmit queue doesn´t count.
+ *                      NOTE: This function is used by the communication task only.
+ *  @param p_Command    Pointer to command object
  */
-uint32_t SIM70XX_Queue_GetItems(QueueHandle_t Queue);
+void SIM70XX_Queue_BeginTransmit(SIM70XX_TxCmd_t* p_Command);
 
-/** @brief          Wait for items to receive.
- *  @param Queue    Message queue
- *  @param p_Active Pointer to active state of the device
- *  @param Timeout  (Optional) Wait timeout in seconds
- *                  NOTE: Set to zero to disable the timeout
- *  @return         #true when the items are placed in the queue
+/** @brief              Start to use the raw data buffer or the payload of a command.
+ *                      NOTE: This function is used by the communication task only.
+ *  @param p_Command    Pointer to command object
+ *  @return             #false when the caller has stopped waiting for the command
  */
-bool SIM70XX_Queue_Wait(QueueHandle_t Queue, bool* p_Active, uint32_t Timeout = 1);
+bool SIM70XX_Queue_BeginRaw(SIM70XX_TxCmd_t* p_Command);
 
-/** @brief          Reset the recieve queue and discard all items.
- *  @param Queue    Message queue
+/** @brief              Stop to use the raw data buffer or the payload of a command.
+ *                      NOTE: This function is used by the communication task only.
+ *  @param p_Command    Pointer to command object
  */
-void SIM70XX_Queue_Reset(QueueHandle_t Queue);
+void SIM70XX_Queue_EndRaw(SIM70XX_TxCmd_t* p_Command);
 
-/** @brief          Wait and receive the data after for an asynchronous message string.
- *                  NOTE: This function can be used when the module will send the response some time after the status code.
- *                        This function will handle the memory allocation from the asynchronous event loop.
- *  @param Queue    Event message queue
- *  @param Filter   Filter string to wait for
- *  @param p_Event  Pointer to event message
- *  @return         #true when a event was received
+/** @brief              Mark a command as processed and notify the waiting task.
+ *                      NOTE: This function is used by the communication task only.
+ *  @param p_Command    Pointer to command object
  */
-bool SIM70XX_Queue_isEvent(QueueHandle_t Queue, std::string Filter, std::string* p_Event);
+void SIM70XX_Queue_Complete(SIM70XX_TxCmd_t* p_Command);
 
 #endif /* SIM70XX_QUEUE_H_ */
\ No newline at end of file
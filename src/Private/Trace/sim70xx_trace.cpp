@@ -0,0 +1,92 @@
+ /*
+ * sim70xx_trace.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <freertos/FreeRTOS.h>
+
+#include <string.h>
+#include <algorithm>
+
+#include "sim70xx_trace.h"
+#include "../Port/sim70xx_port.h"
+
+#ifdef CONFIG_SIM70XX_TRACE
+
+static SIM70XX_Trace_Entry_t _SIM70XX_Trace_Entries[CONFIG_SIM70XX_TRACE_DEPTH];
+static uint32_t _SIM70XX_Trace_Count = 0;
+static portMUX_TYPE _SIM70XX_Trace_Lock = portMUX_INITIALIZER_UNLOCKED;
+
+void SIM70XX_Trace_Record(SIM70XX_Trace_Type_t Type, const std::string& Name, uint32_t Length, SIM70XX_Trace_Status_t Status, uint16_t Sequence)
+{
+    size_t Start;
+    size_t End;
+    SIM70XX_Trace_Entry_t Entry;
+
+    Entry.Timestamp = (uint32_t)SIM70XX_Port_GetusTimer();
+    Entry.Length = Length;
+    Entry.Sequence = Sequence;
+    Entry.Type = Type;
+    Entry.Status = Status;
+
+    // Get the name of the command or the event. The name ends with the first parameter (i.e. "AT+CGATT?" -> "+CGATT" or "+CEREG: 1" -> "+CEREG").
+    Start = (Name.compare(0, 2, "AT") == 0) ? 2 : 0;
+    End = std::min(Name.find_first_of(":=?, ", Start), Name.size());
+    memset(Entry.Tag, 0, sizeof(Entry.Tag));
+    Name.copy(Entry.Tag, std::min(End - Start, sizeof(Entry.Tag)), Start);
+
+    portENTER_CRITICAL(&_SIM70XX_Trace_Lock);
+    _SIM70XX_Trace_Entries[_SIM70XX_Trace_Count % CONFIG_SIM70XX_TRACE_DEPTH] = Entry;
+    _SIM70XX_Trace_Count++;
+    portEXIT_CRITICAL(&_SIM70XX_Trace_Lock);
+}
+
+size_t SIM70XX_Trace_Read(size_t Offset, SIM70XX_Trace_Entry_t* p_Entries, size_t Count)
+{
+    size_t Copied;
+    uint32_t First;
+
+    if(p_Entries == NULL)
+    {
+        return 0;
+    }
+
+    Copied = 0;
+
+    portENTER_CRITICAL(&_SIM70XX_Trace_Lock);
+    First = (_SIM70XX_Trace_Count > CONFIG_SIM70XX_TRACE_DEPTH) ? (_SIM70XX_Trace_Count - CONFIG_SIM70XX_TRACE_DEPTH) : 0;
+    for(uint32_t i = First + Offset; (i < _SIM70XX_Trace_Count) && (Copied < Count); i++)
+    {
+        p_Entries[Copied++] = _SIM70XX_Trace_Entries[i % CONFIG_SIM70XX_TRACE_DEPTH];
+    }
+    portEXIT_CRITICAL(&_SIM70XX_Trace_Lock);
+
+    return Copied;
+}
+
+#else
+
+void SIM70XX_Trace_Record(SIM70XX_Trace_Type_t Type, const std::string& Name, uint32_t Length, SIM70XX_Trace_Status_t Status, uint16_t Sequence)
+{
+}
+
+size_t SIM70XX_Trace_Read(size_t Offset, SIM70XX_Trace_Entry_t* p_Entries, size_t Count)
+{
+    return 0;
+}
+
+#endif
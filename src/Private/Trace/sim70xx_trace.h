@@ -0,0 +1,63 @@
+ /*
+ * sim70xx_trace.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_TRACE_H_
+#define SIM70XX_TRACE_H_
+
+#include <string>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <sdkconfig.h>
+
+#include "sim70xx_defs.h"
+
+#ifndef CONFIG_SIM70XX_TRACE_DEPTH
+    #define CONFIG_SIM70XX_TRACE_DEPTH              256
+#endif
+
+/** @brief  Record a trace entry.
+ *          NOTE: The arguments are not evaluated when the trace is disabled.
+ */
+#ifdef CONFIG_SIM70XX_TRACE
+    #define SIM70XX_TRACE(Type, Name, Length, Status, Sequence)     SIM70XX_Trace_Record(Type, Name, Length, Status, Sequence)
+#else
+    #define SIM70XX_TRACE(Type, Name, Length, Status, Sequence)     do {} while(0)
+#endif
+
+/** @brief          Record a trace entry in the trace buffer. The oldest entry is overwritten when the buffer is full.
+ *                  NOTE: Use #SIM70XX_TRACE instead, so the call is removed when the trace is disabled.
+ *  @param Type     Entry type
+ *  @param Name     Command or event (i.e. "AT+CGATT?" or "+CEREG: 1"). Only the name is stored (i.e. "+CGATT").
+ *  @param Length   Number of transmitted or received bytes
+ *  @param Status   Entry status
+ *  @param Sequence Command number
+ */
+void SIM70XX_Trace_Record(SIM70XX_Trace_Type_t Type, const std::string& Name, uint32_t Length, SIM70XX_Trace_Status_t Status, uint16_t Sequence);
+
+/** @brief              Copy entries from the trace buffer. The entries are sorted from the oldest to the newest entry.
+ *                      NOTE: New entries are recorded while the buffer is read. So the entries can be shifted between two calls.
+ *  @param Offset       Index of the first entry, counted from the oldest entry
+ *  @param p_Entries    Pointer to entry buffer
+ *  @param Count        Size of the entry buffer
+ *  @return             Number of copied entries
+ */
+size_t SIM70XX_Trace_Read(size_t Offset, SIM70XX_Trace_Entry_t* p_Entries, size_t Count);
+
+#endif /* SIM70XX_TRACE_H_ */
@@ -0,0 +1,270 @@
+ /*
+ * sim70xx_baud.cpp
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#include <esp_log.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "sim70xx_baud.h"
+#include "sim70xx_uart.h"
+#include "sim70xx_tools.h"
+#include "../Queue/sim70xx_queue.h"
+#include "../Commands/sim70xx_commands.h"
+
+#if(CONFIG_SIMXX_DEV == 7020)
+    #include "sim7020.h"
+#elif(CONFIG_SIMXX_DEV == 7080)
+    #include "sim7080.h"
+#endif
+
+/** @brief Baudrates which are used to find the current baudrate of the module.
+ *         NOTE: The default baudrate of the modules is checked first.
+ */
+static const SIM70XX_Baud_t _SIM70XX_Baud_Candidates[] = {
+    SIM_BAUD_115200,
+    SIM_BAUD_921600,
+    SIM_BAUD_460800,
+    SIM_BAUD_230400,
+    SIM_BAUD_9600,
+    SIM_BAUD_4800,
+};
+
+/** @brief Baudrates which are tested for the data transfer, beginning with the highest baudrate.
+ */
+static const SIM70XX_Baud_t _SIM70XX_Baud_Rates[] = {
+    SIM_BAUD_921600,
+    SIM_BAUD_460800,
+    SIM_BAUD_230400,
+    SIM_BAUD_115200,
+};
+
+static const char* TAG = "SIM70XX_Baud";
+
+/** @brief              Transmit a command to the module and wait for the result.
+ *  @param p_Device     Pointer to device object
+ *  @param Definition   Command definition
+ *  @param p_Response   (Optional) Pointer to response string
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+template<typename Definition_t>
+static SIM70XX_Error_t SIM70XX_Baud_Execute(void* p_Device, const Definition_t& Definition, std::string* p_Response = NULL)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    SIM70XX_TxCmd_t* Command;
+
+    SIM70XX_CREATE_CMD(Command);
+    *Command = Definition;
+    SIM70XX_PUSH_QUEUE(Device->Internal.TxQueue, Command);
+    if(SIM70XX_Queue_Wait(Command, &Device->Internal.isActive, Command->Timeout) == false)
+    {
+        return SIM70XX_ERR_TIMEOUT;
+    }
+
+    return SIM70XX_Queue_PopItem(Command, p_Response);
+}
+
+/** @brief              Check if the module responds with the given baudrate.
+ *  @param p_Device     Pointer to device object
+ *  @param Baudrate     Baudrate
+ *  @return             #true when the module responds
+ */
+static bool SIM70XX_Baud_Probe(void* p_Device, SIM70XX_Baud_t Baudrate)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    ESP_LOGD(TAG, "Probe baudrate %u...", Baudrate);
+
+    if(SIM70XX_UART_SetBaudrate(Device->UART, Baudrate) != SIM70XX_ERR_OK)
+    {
+        return false;
+    }
+
+    // NOTE: The first command can get lost when the module uses the automatic baudrate detection.
+    for(uint8_t i = 0; i < 2; i++)
+    {
+        if(SIM70XX_Baud_Execute(Device, SIM70XX_AT) == SIM70XX_ERR_OK)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** @brief              Find the current baudrate of the module.
+ *  @param p_Device     Pointer to device object
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+static SIM70XX_Error_t SIM70XX_Baud_Discover(void* p_Device)
+{
+    for(uint8_t i = 0; i < (sizeof(_SIM70XX_Baud_Candidates) / sizeof(_SIM70XX_Baud_Candidates[0])); i++)
+    {
+        if(SIM70XX_Baud_Probe(p_Device, _SIM70XX_Baud_Candidates[i]))
+        {
+            ESP_LOGI(TAG, "Module responds with %u baud", _SIM70XX_Baud_Candidates[i]);
+
+            return SIM70XX_ERR_OK;
+        }
+    }
+
+    ESP_LOGE(TAG, "Module does not respond!");
+
+    return SIM70XX_ERR_NOT_READY;
+}
+
+/** @brief              Change the baudrate of the module and of the interface.
+ *  @param p_Device     Pointer to device object
+ *  @param Baudrate     New baudrate
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+static SIM70XX_Error_t SIM70XX_Baud_Switch(void* p_Device, SIM70XX_Baud_t Baudrate)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    // NOTE: The module sends the status with the old baudrate and switches to the new baudrate afterwards.
+    SIM70XX_ERROR_CHECK(SIM70XX_Baud_Execute(Device, SIM70XX_AT_IPR_W(Baudrate)));
+    SIM70XX_ERROR_CHECK(SIM70XX_UART_SetBaudrate(Device->UART, Baudrate));
+
+    vTaskDelay(100 / portTICK_PERIOD_MS);
+
+    return SIM70XX_ERR_OK;
+}
+
+/** @brief              Run the integrity and throughput test with the current baudrate.
+ *                      The test reads the firmware revision and compares it with the reference.
+ *  @param p_Device     Pointer to device object
+ *  @param Reference    Reference response
+ *  @param p_Time       Pointer to test duration in milliseconds
+ *  @return             #true when all test cycles were successful
+ */
+static bool SIM70XX_Baud_Test(void* p_Device, const std::string& Reference, uint32_t* p_Time)
+{
+    uint32_t Now;
+    std::string Response;
+
+    Now = SIM70XX_Tools_GetmsTimer();
+    for(uint32_t i = 0; i < CONFIG_SIM70XX_AUTOBAUD_CYCLES; i++)
+    {
+        if((SIM70XX_Baud_Execute(p_Device, SIM70XX_AT_CGMR, &Response) != SIM70XX_ERR_OK) || (Response != Reference))
+        {
+            return false;
+        }
+    }
+
+    *p_Time = SIM70XX_Tools_GetmsTimer() - Now;
+
+    return true;
+}
+
+SIM70XX_Error_t SIM70XX_Baud_Auto(void* p_Device, SIM70XX_Baud_t* p_Baudrate)
+{
+    #if(CONFIG_SIMXX_DEV == 7020)
+        SIM7020_t* Device = (SIM7020_t*)p_Device;
+    #elif(CONFIG_SIMXX_DEV == 7080)
+        SIM7080_t* Device = (SIM7080_t*)p_Device;
+    #endif
+
+    uint32_t Time;
+    uint32_t Reference_Time;
+    std::string Reference;
+    SIM70XX_Baud_t Current;
+
+    if(p_Device == NULL)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    SIM70XX_ERROR_CHECK(SIM70XX_Baud_Discover(Device));
+    Current = Device->UART.Baudrate;
+
+    // Get the reference values with the current baudrate.
+    SIM70XX_ERROR_CHECK(SIM70XX_Baud_Execute(Device, SIM70XX_AT_CGMR, &Reference));
+    if(SIM70XX_Baud_Test(Device, Reference, &Reference_Time) == false)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    ESP_LOGI(TAG, "Reference: %u baud, %u ms", Current, Reference_Time);
+
+    // Step up to the highest baudrate which passes the test.
+    for(uint8_t i = 0; i < (sizeof(_SIM70XX_Baud_Rates) / sizeof(_SIM70XX_Baud_Rates[0])); i++)
+    {
+        SIM70XX_Baud_t Baudrate = _SIM70XX_Baud_Rates[i];
+
+        if((Baudrate <= Current) || (Baudrate > CONFIG_SIM70XX_AUTOBAUD_MAX))
+        {
+            continue;
+        }
+
+        if(SIM70XX_Baud_Switch(Device, Baudrate) != SIM70XX_ERR_OK)
+        {
+            // The module may have switched to the new baudrate without a valid status message.
+            SIM70XX_ERROR_CHECK(SIM70XX_Baud_Discover(Device));
+            Current = Device->UART.Baudrate;
+
+            continue;
+        }
+
+        // The baudrate is only used when the data are transmitted without errors and when the transfer is not slower
+        // than with the reference baudrate (e.g. because of retransmissions).
+        if(SIM70XX_Baud_Test(Device, Reference, &Time) && (Time <= Reference_Time))
+        {
+            ESP_LOGI(TAG, "Test passed: %u baud, %u ms", Baudrate, Time);
+
+            Current = Baudrate;
+
+            break;
+        }
+
+        ESP_LOGW(TAG, "Test failed: %u baud", Baudrate);
+
+        // Switch back to the reference baudrate.
+        if(SIM70XX_Baud_Switch(Device, Current) != SIM70XX_ERR_OK)
+        {
+            SIM70XX_ERROR_CHECK(SIM70XX_Baud_Discover(Device));
+            Current = Device->UART.Baudrate;
+        }
+    }
+
+    // Store the baudrate in the module.
+    SIM70XX_ERROR_CHECK(SIM70XX_Baud_Execute(Device, SIM70XX_AT_ATW));
+
+    ESP_LOGI(TAG, "Using %u baud", Device->UART.Baudrate);
+
+    if(p_Baudrate != NULL)
+    {
+        *p_Baudrate = Device->UART.Baudrate;
+    }
+
+    return SIM70XX_ERR_OK;
+}
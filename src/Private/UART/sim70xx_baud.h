@@ -0,0 +1,48 @@
+ /*
+ * sim70xx_baud.h
+ *
+ *  Copyright (C) Daniel Kampert, 2022
+ *	Website: www.kampis-elektroecke.de
+ *  File info: SIM70XX driver for ESP32.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, 
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
+ */
+
+#ifndef SIM70XX_BAUD_H_
+#define SIM70XX_BAUD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <sdkconfig.h>
+
+#include "sim70xx_defs.h"
+#include "sim70xx_errors.h"
+
+#ifndef CONFIG_SIM70XX_AUTOBAUD_MAX
+    #define CONFIG_SIM70XX_AUTOBAUD_MAX                 921600
+#endif
+
+#ifndef CONFIG_SIM70XX_AUTOBAUD_CYCLES
+    #define CONFIG_SIM70XX_AUTOBAUD_CYCLES              10
+#endif
+
+/** @brief              Find the current baudrate of the module, switch to the highest baudrate which passes the integrity
+ *                      and throughput test and store the baudrate in the module.
+ *                      NOTE: The communication task must be running.
+ *  @param p_Device     Pointer to device object
+ *  @param p_Baudrate   (Optional) Pointer to selected baudrate
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_Baud_Auto(void* p_Device, SIM70XX_Baud_t* p_Baudrate = NULL);
+
+#endif /* SIM70XX_BAUD_H_ */
@@ -17,19 +17,20 @@
  * Errors and commissions should be reported to DanielKampert@kampis-elektroecke.de.
  */
 
-#include <esp_err.h>
 #include <esp_log.h>
 
-#include <driver/uart.h>
-#include <driver/gpio.h>
-
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/queue.h>
 #include <freertos/semphr.h>
 
+#include <string.h>
+
+#include <algorithm>
+
 #include "sim70xx_uart.h"
 #include "sim70xx_tools.h"
+#include "../Port/sim70xx_port.h"
 
 #include <sdkconfig.h>
 
@@ -37,90 +38,218 @@
     #define CONFIG_SIM70XX_UART_BUFFER_SIZE                 256
 #endif
 
-static uart_config_t _SIM70XX_UART_Config = {
-    .baud_rate              = 0,
-    .data_bits              = UART_DATA_8_BITS,
-    .parity                 = UART_PARITY_DISABLE,
-    .stop_bits              = UART_STOP_BITS_1,
-    .flow_ctrl              = UART_HW_FLOWCTRL_DISABLE,
-    .rx_flow_ctrl_thresh    = 0,
-#ifdef CONFIG_PM_ENABLE
-    .source_clk             = UART_SCLK_REF_TICK,
-#else
-    .source_clk             = UART_SCLK_APB,
+#ifndef CONFIG_SIM70XX_UART_LINE_SIZE
+    #define CONFIG_SIM70XX_UART_LINE_SIZE                   4096
 #endif
-};
+
+/** @brief Receive ring buffer object definition.
+ *         NOTE: The ring buffer is filled with bulk reads from the UART driver and all line scans are running over this buffer.
+ */
+typedef struct
+{
+    uint8_t Data[CONFIG_SIM70XX_UART_BUFFER_SIZE];  /**< Buffer memory. */
+    size_t Head;                                    /**< Read position. */
+    size_t Count;                                   /**< Number of bytes stored in the buffer. */
+    std::string Line;                               /**< Beginning of a line which is longer than the buffer. */
+    bool isDiscard;                                 /**< #true when the remaining bytes of an overlong line are discarded. */
+} SIM70XX_UART_Ring_t;
+
+static SIM70XX_UART_Ring_t _SIM70XX_UART_Ring[UART_NUM_MAX];
 
 static const char* TAG = "SIM70XX_UART";
 
-/** @brief          Get a character from the UART FIFO.
+/** @brief          Reset the receive ring buffer of an interface.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ */
+static void SIM70XX_UART_RingReset(SIM70XX_UART_Conf_t& p_Config)
+{
+    _SIM70XX_UART_Ring[p_Config.Interface].Head = 0;
+    _SIM70XX_UART_Ring[p_Config.Interface].Count = 0;
+    _SIM70XX_UART_Ring[p_Config.Interface].Line.clear();
+    _SIM70XX_UART_Ring[p_Config.Interface].isDiscard = false;
+}
+
+/** @brief          Fill the receive ring buffer with all bytes from the UART driver.
+ *                  NOTE: The receive path is used by the communication task only. So no lock is needed and a running transmission doesn´t block the reception.
  *  @param p_Config Pointer to SIM70XX UART configuration object
- *  @return         Received character
+ *  @param Ticks    Number of ticks to wait for the first byte when the driver buffer is empty
+ *  @return         Number of bytes copied into the ring buffer
  */
-static uint8_t SIM7020_UART_Get(SIM70XX_UART_Conf_t& p_Config)
+static size_t SIM70XX_UART_RingFill(SIM70XX_UART_Conf_t& p_Config, TickType_t Ticks)
 {
-    uint8_t c;
+    size_t Avail;
+    size_t Total;
+    SIM70XX_UART_Ring_t* Ring;
+
+    Total = 0;
+    Ring = &_SIM70XX_UART_Ring[p_Config.Interface];
 
-    xSemaphoreTake(p_Config.Lock, portMAX_DELAY);
-    if(uart_read_bytes(p_Config.Interface, &c, sizeof(uint8_t), 20 / portTICK_RATE_MS) == 0)
+    if(Ring->Count >= sizeof(Ring->Data))
     {
-        c = 0;
+        return 0;
     }
-    xSemaphoreGive(p_Config.Lock);
 
-    return c;
+    Avail = SIM70XX_Port_UART_GetBuffered(p_Config);
+    p_Config.RxCalls++;
+
+    // Wait for at least one byte when the driver buffer is empty.
+    if(Avail == 0)
+    {
+        Avail = 1;
+    }
+    else
+    {
+        Ticks = 0;
+    }
+
+    // Copy the data in up to two contiguous blocks into the ring buffer.
+    while((Avail > 0) && (Ring->Count < sizeof(Ring->Data)))
+    {
+        int Read;
+        size_t Tail;
+        size_t Length;
+
+        Tail = (Ring->Head + Ring->Count) % sizeof(Ring->Data);
+        if(Tail >= Ring->Head)
+        {
+            Length = sizeof(Ring->Data) - Tail;
+        }
+        else
+        {
+            Length = Ring->Head - Tail;
+        }
+
+        Length = std::min(Length, Avail);
+
+        Read = SIM70XX_Port_UART_Read(p_Config, &Ring->Data[Tail], Length, Ticks);
+        p_Config.RxCalls++;
+        if(Read <= 0)
+        {
+            break;
+        }
+
+        Ring->Count += Read;
+        Total += Read;
+        Avail -= Read;
+        Ticks = 0;
+    }
+
+    p_Config.RxBytes += Total;
+
+    return Total;
 }
 
-/** @brief          Wait for a character and read it.
+/** @brief          Move bytes from the receive ring buffer into a string.
  *  @param p_Config Pointer to SIM70XX UART configuration object
- *  @param Timeout  (Optional) Read timeout in milliseconds
- *  @return         Received character or -1 when no character received
+ *  @param Length   Number of bytes to move
+ *  @param p_String Pointer to target string
  */
-static int SIM7020_UART_TimedRead(SIM70XX_UART_Conf_t& p_Config, uint32_t Timeout = 1000)
+static void SIM70XX_UART_RingMove(SIM70XX_UART_Conf_t& p_Config, size_t Length, std::string* p_String)
 {
-    int c;
-    unsigned long Now;
+    SIM70XX_UART_Ring_t* Ring;
 
-    Now = SIM70XX_Tools_GetmsTimer();
-    do
+    Ring = &_SIM70XX_UART_Ring[p_Config.Interface];
+
+    while(Length > 0)
     {
-        c = SIM70XX_UART_Read(p_Config);
-        if(c >= 0)
+        size_t Block;
+
+        Block = std::min(Length, sizeof(Ring->Data) - Ring->Head);
+        if(p_String != NULL)
         {
-            return c;
+            p_String->append((const char*)&Ring->Data[Ring->Head], Block);
         }
-    } while((SIM70XX_Tools_GetmsTimer() - Now) < Timeout);
 
-    return -1;
+        Ring->Head = (Ring->Head + Block) % sizeof(Ring->Data);
+        Ring->Count -= Block;
+        Length -= Block;
+    }
+}
+
+/** @brief              Search a character in the receive ring buffer.
+ *  @param p_Config     Pointer to SIM70XX UART configuration object
+ *  @param Character    Character to search for
+ *  @param p_Index      Pointer to offset of the character from the read position
+ *  @return             #true when the character was found
+ */
+static bool SIM70XX_UART_RingFind(SIM70XX_UART_Conf_t& p_Config, char Character, size_t* p_Index)
+{
+    size_t Block;
+    const uint8_t* p_Found;
+    SIM70XX_UART_Ring_t* Ring;
+
+    Ring = &_SIM70XX_UART_Ring[p_Config.Interface];
+
+    // Search in the first contiguous block.
+    Block = std::min(Ring->Count, sizeof(Ring->Data) - Ring->Head);
+    p_Found = (const uint8_t*)memchr(&Ring->Data[Ring->Head], Character, Block);
+    if(p_Found != NULL)
+    {
+        *p_Index = p_Found - &Ring->Data[Ring->Head];
+
+        return true;
+    }
+
+    // Search in the wrapped block.
+    p_Found = (const uint8_t*)memchr(&Ring->Data[0], Character, Ring->Count - Block);
+    if(p_Found != NULL)
+    {
+        *p_Index = Block + (p_Found - &Ring->Data[0]);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool SIM70XX_UART_isConsumer(SIM70XX_UART_Conf_t& p_Config)
+{
+    if((p_Config.Consumer != NULL) && (p_Config.Consumer != xTaskGetCurrentTaskHandle()))
+    {
+        ESP_LOGE(TAG, "Receive path is used by another task!");
+
+        return false;
+    }
+
+    return true;
 }
 
 SIM70XX_Error_t SIM70XX_UART_Init(SIM70XX_UART_Conf_t& p_Config)
 {
-    if(p_Config.isInitialized)
+    // The interface can not be initialized again while the communication task reads from it.
+    if(p_Config.isInitialized && (SIM70XX_UART_isConsumer(p_Config) == false))
+    {
+        return SIM70XX_ERR_INVALID_STATE;
+    }
+    else if(p_Config.isInitialized)
     {
         SIM70XX_ERROR_CHECK(SIM70XX_UART_Deinit(p_Config));
     }
 
     p_Config.isInitialized = false;
-
-    _SIM70XX_UART_Config.baud_rate = p_Config.Baudrate;
-
-    p_Config.Lock = xSemaphoreCreateMutex();
-    if(p_Config.Lock == NULL)
+    p_Config.FIFOOverflow = 0;
+    p_Config.BufferFull = 0;
+    p_Config.LineOverflow = 0;
+    p_Config.TxBytes = 0;
+    p_Config.RxBytes = 0;
+    p_Config.RxCalls = 0;
+    p_Config.Consumer = NULL;
+
+    p_Config.TxLock = xSemaphoreCreateMutex();
+    if(p_Config.TxLock == NULL)
     {
         return SIM70XX_ERR_NO_MEM;
     }
 
-    xSemaphoreTake(p_Config.Lock, portMAX_DELAY);
-    if((uart_driver_install(p_Config.Interface, CONFIG_SIM70XX_UART_BUFFER_SIZE * 2, 0, 0, NULL, 0) ||
-        uart_param_config(p_Config.Interface, &_SIM70XX_UART_Config) ||
-        uart_set_pin(p_Config.Interface, p_Config.Tx, p_Config.Rx, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE) ||
-        uart_flush(p_Config.Interface)) != ESP_OK)
+    xSemaphoreTake(p_Config.TxLock, portMAX_DELAY);
+    if(SIM70XX_Port_UART_Init(p_Config) != SIM70XX_ERR_OK)
     {
-        xSemaphoreGive(p_Config.Lock);
+        xSemaphoreGive(p_Config.TxLock);
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
-    xSemaphoreGive(p_Config.Lock);
+    xSemaphoreGive(p_Config.TxLock);
+
+    SIM70XX_UART_RingReset(p_Config);
 
     ESP_LOGI(TAG, "UART initialized...");
 
@@ -136,17 +265,15 @@ SIM70XX_Error_t SIM70XX_UART_Deinit(SIM70XX_UART_Conf_t& p_Config)
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    xSemaphoreTake(p_Config.Lock, portMAX_DELAY);
-    if(uart_is_driver_installed(p_Config.Interface))
-    {
-        uart_flush(p_Config.Interface);
-        uart_driver_delete(p_Config.Interface);
-        gpio_reset_pin(p_Config.Rx);
-        gpio_reset_pin(p_Config.Tx);
-    }
-    xSemaphoreGive(p_Config.Lock);
+    xSemaphoreTake(p_Config.TxLock, portMAX_DELAY);
+    SIM70XX_Port_UART_Deinit(p_Config);
+    xSemaphoreGive(p_Config.TxLock);
+
+    vSemaphoreDelete(p_Config.TxLock);
+    p_Config.TxLock = NULL;
+    p_Config.EventQueue = NULL;
 
-    vSemaphoreDelete(p_Config.Lock);
+    SIM70XX_UART_RingReset(p_Config);
 
     ESP_LOGI(TAG, "UART deinitialized...");
 
@@ -155,6 +282,108 @@ SIM70XX_Error_t SIM70XX_UART_Deinit(SIM70XX_UART_Conf_t& p_Config)
     return SIM70XX_ERR_OK;
 }
 
+SIM70XX_Error_t SIM70XX_UART_SetBaudrate(SIM70XX_UART_Conf_t& p_Config, SIM70XX_Baud_t Baudrate)
+{
+    SIM70XX_Error_t Error;
+
+    if(Baudrate == SIM_BAUD_AUTO)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Config.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    xSemaphoreTake(p_Config.TxLock, portMAX_DELAY);
+    Error = SIM70XX_Port_UART_SetBaudrate(p_Config, Baudrate);
+    xSemaphoreGive(p_Config.TxLock);
+
+    if(Error != SIM70XX_ERR_OK)
+    {
+        return Error;
+    }
+
+    p_Config.Baudrate = Baudrate;
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM70XX_UART_SetFlowControl(SIM70XX_UART_Conf_t& p_Config, bool Enable)
+{
+    SIM70XX_Error_t Error;
+
+    if(p_Config.isFlowControl == false)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Config.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    xSemaphoreTake(p_Config.TxLock, portMAX_DELAY);
+    Error = SIM70XX_Port_UART_SetFlowControl(p_Config, Enable);
+    xSemaphoreGive(p_Config.TxLock);
+
+    return Error;
+}
+
+void SIM70XX_UART_GetStatistics(SIM70XX_UART_Conf_t& p_Config, SIM70XX_Statistics_t* p_Stats)
+{
+    if(p_Stats == NULL)
+    {
+        return;
+    }
+
+    p_Stats->FIFOOverflow = p_Config.FIFOOverflow;
+    p_Stats->BufferFull = p_Config.BufferFull;
+    p_Stats->LineOverflow = p_Config.LineOverflow;
+    p_Stats->TxBytes = p_Config.TxBytes;
+    p_Stats->RxBytes = p_Config.RxBytes;
+    p_Stats->RxCalls = p_Config.RxCalls;
+}
+
+bool SIM70XX_UART_ProcessEvent(SIM70XX_UART_Conf_t& p_Config)
+{
+    SIM70XX_Port_Event_t Event;
+
+    if((p_Config.isInitialized == false) || (SIM70XX_Port_UART_GetEvent(p_Config, &Event) == false))
+    {
+        return false;
+    }
+
+    switch(Event)
+    {
+        case SIM70XX_PORT_EVT_DATA:
+        {
+            return true;
+        }
+        case SIM70XX_PORT_EVT_FIFO_OVF:
+        case SIM70XX_PORT_EVT_BUFFER_FULL:
+        {
+            if(Event == SIM70XX_PORT_EVT_FIFO_OVF)
+            {
+                p_Config.FIFOOverflow++;
+            }
+            else
+            {
+                p_Config.BufferFull++;
+            }
+
+            ESP_LOGW(TAG, "UART overflow! Flush the receive buffer...");
+
+            SIM70XX_UART_Flush(p_Config);
+
+            return false;
+        }
+        default:
+        {
+            return false;
+        }
+    }
+}
+
 SIM70XX_Error_t SIM70XX_UART_Send(SIM70XX_UART_Conf_t& p_Config, const void* p_Data, size_t Size)
 {
     if(p_Data == NULL)
@@ -166,107 +395,383 @@ SIM70XX_Error_t SIM70XX_UART_Send(SIM70XX_UART_Conf_t& p_Config, const void* p_D
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    xSemaphoreTake(p_Config.Lock, portMAX_DELAY);
-    uart_write_bytes(p_Config.Interface, p_Data, Size);
-    xSemaphoreGive(p_Config.Lock);
+    xSemaphoreTake(p_Config.TxLock, portMAX_DELAY);
+    SIM70XX_Port_UART_Write(p_Config, p_Data, Size);
+    p_Config.TxBytes += Size;
+    xSemaphoreGive(p_Config.TxLock);
 
     return SIM70XX_ERR_OK;
 }
 
-SIM70XX_Error_t SIM70XX_UART_SendLine(SIM70XX_UART_Conf_t& p_Config, std::string Data)
+SIM70XX_Error_t SIM70XX_UART_SendFragments(SIM70XX_UART_Conf_t& p_Config, const SIM70XX_UART_Fragment_t* p_Fragments, size_t Count)
 {
-    if(p_Config.isInitialized == false)
+    if((p_Fragments == NULL) && (Count > 0))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Config.isInitialized == false)
     {
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    xSemaphoreTake(p_Config.Lock, portMAX_DELAY);
-    uart_write_bytes(p_Config.Interface, Data.c_str(), Data.size());
-    uart_write_bytes(p_Config.Interface, "\r\n", 2);
-    xSemaphoreGive(p_Config.Lock);
+    xSemaphoreTake(p_Config.TxLock, portMAX_DELAY);
+    for(size_t i = 0; i < Count; i++)
+    {
+        const uint8_t* p_Data = (const uint8_t*)p_Fragments[i].p_Data;
+
+        if((p_Data == NULL) || (p_Fragments[i].Length == 0))
+        {
+            continue;
+        }
+
+        if(p_Fragments[i].Encoding == SIM70XX_ENC_RAW)
+        {
+            SIM70XX_Port_UART_Write(p_Config, p_Data, p_Fragments[i].Length);
+            p_Config.TxBytes += p_Fragments[i].Length;
+        }
+        // Convert the data in small blocks on the stack to avoid a copy of the whole encoded string.
+        else if(p_Fragments[i].Encoding == SIM70XX_ENC_HEX)
+        {
+            for(size_t Offset = 0; Offset < p_Fragments[i].Length; )
+            {
+                char Hex[128];
+                size_t Length;
+
+                Length = std::min(sizeof(Hex) / 2, p_Fragments[i].Length - Offset);
+                SIM70XX_Tools_HexEncode(&p_Data[Offset], Length, Hex);
+
+                SIM70XX_Port_UART_Write(p_Config, Hex, 2 * Length);
+                p_Config.TxBytes += 2 * Length;
+                Offset += Length;
+            }
+        }
+        else if(p_Fragments[i].Encoding == SIM70XX_ENC_BASE64)
+        {
+            char Base64[128];
+            size_t Written;
+            SIM70XX_Base64_t Context;
+
+            SIM70XX_Tools_Base64Init(&Context);
+            for(size_t Offset = 0; Offset < p_Fragments[i].Length; )
+            {
+                size_t Length;
+
+                Length = std::min((sizeof(Base64) / 4) * 3, p_Fragments[i].Length - Offset);
+                Written = SIM70XX_Tools_Base64Update(&Context, &p_Data[Offset], Length, Base64);
+
+                SIM70XX_Port_UART_Write(p_Config, Base64, Written);
+                p_Config.TxBytes += Written;
+                Offset += Length;
+            }
+
+            // NOTE: Each fragment is a complete Base64 string with padding.
+            Written = SIM70XX_Tools_Base64Final(&Context, Base64);
+            SIM70XX_Port_UART_Write(p_Config, Base64, Written);
+            p_Config.TxBytes += Written;
+        }
+    }
+    xSemaphoreGive(p_Config.TxLock);
 
     return SIM70XX_ERR_OK;
 }
 
-int SIM70XX_UART_Read(SIM70XX_UART_Conf_t& p_Config)
+SIM70XX_Error_t SIM70XX_UART_SendLine(SIM70XX_UART_Conf_t& p_Config, const std::string& Data)
 {
-    size_t Avail;
+    SIM70XX_UART_Fragment_t Fragments[] = {
+        {Data.c_str(), Data.size(), SIM70XX_ENC_RAW},
+        {"\r\n", 2, SIM70XX_ENC_RAW},
+    };
 
-    Avail = SIM70XX_UART_Available(p_Config);
-    if(Avail != 0)
+    return SIM70XX_UART_SendFragments(p_Config, Fragments, 2);
+}
+
+size_t SIM70XX_UART_Read(SIM70XX_UART_Conf_t& p_Config, uint8_t* p_Buffer, size_t Size)
+{
+    size_t Read;
+    SIM70XX_UART_Ring_t* Ring;
+
+    if((p_Buffer == NULL) || (p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
     {
-        return SIM7020_UART_Get(p_Config);
+        return 0;
     }
 
-    return -1;
+    Read = 0;
+    Ring = &_SIM70XX_UART_Ring[p_Config.Interface];
+
+    // Serve the request from the ring buffer first.
+    while((Read < Size) && (Ring->Count > 0))
+    {
+        size_t Block;
+
+        Block = std::min(Size - Read, std::min(Ring->Count, sizeof(Ring->Data) - Ring->Head));
+        memcpy(&p_Buffer[Read], &Ring->Data[Ring->Head], Block);
+
+        Ring->Head = (Ring->Head + Block) % sizeof(Ring->Data);
+        Ring->Count -= Block;
+        Read += Block;
+    }
+
+    // Read the remaining bytes directly from the UART driver.
+    if(Read < Size)
+    {
+        int Length;
+
+        Length = SIM70XX_Port_UART_Read(p_Config, &p_Buffer[Read], Size - Read, 0);
+        p_Config.RxCalls++;
+        if(Length > 0)
+        {
+            p_Config.RxBytes += Length;
+            Read += Length;
+        }
+    }
+
+    return Read;
 }
 
-std::string SIM70XX_UART_ReadStringUntil(SIM70XX_UART_Conf_t& p_Config, char Terminator, uint32_t Timeout)
+size_t SIM70XX_UART_ReadBytes(SIM70XX_UART_Conf_t& p_Config, uint8_t* p_Buffer, size_t Size, uint32_t Timeout)
+{
+    size_t Read;
+    uint32_t Now;
+
+    if((p_Buffer == NULL) || (p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
+    {
+        return 0;
+    }
+
+    Read = SIM70XX_UART_Read(p_Config, p_Buffer, Size);
+
+    Now = SIM70XX_Tools_GetmsTimer();
+    while((Read < Size) && ((SIM70XX_Tools_GetmsTimer() - Now) < Timeout))
+    {
+        int Length;
+
+        Length = SIM70XX_Port_UART_Read(p_Config, &p_Buffer[Read], Size - Read, 10 / portTICK_PERIOD_MS);
+        p_Config.RxCalls++;
+        if(Length > 0)
+        {
+            p_Config.RxBytes += Length;
+            Read += Length;
+            Now = SIM70XX_Tools_GetmsTimer();
+        }
+    }
+
+    return Read;
+}
+
+int SIM70XX_UART_Read(SIM70XX_UART_Conf_t& p_Config, uint32_t Timeout)
 {
     int c;
-    std::string Return;
+    SIM70XX_UART_Ring_t* Ring;
 
-    if(p_Config.isInitialized == false)
+    if((p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
     {
-        return std::string();
+        return -1;
     }
 
-    c = SIM7020_UART_TimedRead(p_Config, Timeout);
-    while((c >= 0) && (c != Terminator))
+    Ring = &_SIM70XX_UART_Ring[p_Config.Interface];
+
+    if((Ring->Count == 0) && (SIM70XX_UART_RingFill(p_Config, Timeout / portTICK_PERIOD_MS) == 0))
     {
-        Return += (char)c;
-        c = SIM7020_UART_TimedRead(p_Config, Timeout);
+        return -1;
     }
 
+    c = Ring->Data[Ring->Head];
+    Ring->Head = (Ring->Head + 1) % sizeof(Ring->Data);
+    Ring->Count--;
+
+    return c;
+}
+
+std::string SIM70XX_UART_ReadStringUntil(SIM70XX_UART_Conf_t& p_Config, char Terminator, uint32_t Timeout)
+{
+    std::string Return;
+
+    SIM70XX_UART_ReadStringUntil(p_Config, &Return, Terminator, Timeout);
+
     return Return;
 }
 
+void SIM70XX_UART_ReadStringUntil(SIM70XX_UART_Conf_t& p_Config, std::string* p_String, char Terminator, uint32_t Timeout)
+{
+    size_t Index;
+    uint32_t Now;
+
+    if(p_String == NULL)
+    {
+        return;
+    }
+
+    p_String->clear();
+
+    if((p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
+    {
+        return;
+    }
+
+    // Continue a long line, which was started by SIM70XX_UART_ReadLine.
+    p_String->append(_SIM70XX_UART_Ring[p_Config.Interface].Line);
+    _SIM70XX_UART_Ring[p_Config.Interface].Line.clear();
+    _SIM70XX_UART_Ring[p_Config.Interface].isDiscard = false;
+
+    Now = SIM70XX_Tools_GetmsTimer();
+    do
+    {
+        // Terminator found. Move the line into the string and remove the terminator from the buffer.
+        if(SIM70XX_UART_RingFind(p_Config, Terminator, &Index))
+        {
+            SIM70XX_UART_RingMove(p_Config, Index, p_String);
+            SIM70XX_UART_RingMove(p_Config, 1, NULL);
+
+            return;
+        }
+
+        // No terminator found. Move the buffered data and wait for new data.
+        SIM70XX_UART_RingMove(p_Config, _SIM70XX_UART_Ring[p_Config.Interface].Count, p_String);
+        if(SIM70XX_UART_RingFill(p_Config, 10 / portTICK_PERIOD_MS) > 0)
+        {
+            Now = SIM70XX_Tools_GetmsTimer();
+        }
+    } while((SIM70XX_Tools_GetmsTimer() - Now) < Timeout);
+}
+
+bool SIM70XX_UART_ReadLine(SIM70XX_UART_Conf_t& p_Config, std::string* p_Line)
+{
+    size_t Index;
+    SIM70XX_UART_Ring_t* Ring;
+
+    if((p_Line == NULL) || (p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
+    {
+        return false;
+    }
+
+    Ring = &_SIM70XX_UART_Ring[p_Config.Interface];
+
+    SIM70XX_UART_RingFill(p_Config, 0);
+    while(true)
+    {
+        bool isFound;
+        size_t Length;
+
+        isFound = SIM70XX_UART_RingFind(p_Config, '\n', &Index);
+
+        // Wait for the rest of the line when the buffer isn´t full.
+        if((isFound == false) && (Ring->Count < sizeof(Ring->Data)))
+        {
+            return false;
+        }
+
+        Length = isFound ? Index : Ring->Count;
+        if((Ring->isDiscard == false) && ((Ring->Line.size() + Length) > CONFIG_SIM70XX_UART_LINE_SIZE))
+        {
+            ESP_LOGE(TAG, "Line exceeds %u bytes! Discard the line...", CONFIG_SIM70XX_UART_LINE_SIZE);
+
+            p_Config.LineOverflow++;
+            Ring->Line.clear();
+            Ring->isDiscard = true;
+        }
+
+        if(isFound)
+        {
+            break;
+        }
+
+        // The buffer is full without a line end. Move the beginning of the line out of the buffer, so the reception doesn´t stall.
+        SIM70XX_UART_RingMove(p_Config, Ring->Count, Ring->isDiscard ? NULL : &Ring->Line);
+        if(SIM70XX_UART_RingFill(p_Config, 0) == 0)
+        {
+            return false;
+        }
+    }
+
+    // Remove the end of a discarded line and continue with the next line.
+    if(Ring->isDiscard)
+    {
+        SIM70XX_UART_RingMove(p_Config, Index + 1, NULL);
+        Ring->isDiscard = false;
+
+        return SIM70XX_UART_ReadLine(p_Config, p_Line);
+    }
+
+    // NOTE: The beginning of a long line is copied, so both strings keep their capacity.
+    p_Line->assign(Ring->Line);
+    Ring->Line.clear();
+    SIM70XX_UART_RingMove(p_Config, Index, p_Line);
+    SIM70XX_UART_RingMove(p_Config, 1, NULL);
+
+    return true;
+}
+
+bool SIM70XX_UART_WaitLine(SIM70XX_UART_Conf_t& p_Config, std::string* p_Line, uint32_t Timeout)
+{
+    uint32_t Now;
+    uint32_t Elapsed;
+
+    Now = SIM70XX_Tools_GetmsTimer();
+    while(SIM70XX_UART_ReadLine(p_Config, p_Line) == false)
+    {
+        // NOTE: The read function rejects invalid arguments and other tasks. So the wait is only done by the consumer.
+        if((p_Line == NULL) || (p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
+        {
+            return false;
+        }
+
+        Elapsed = SIM70XX_Tools_GetmsTimer() - Now;
+        if(Elapsed >= Timeout)
+        {
+            return false;
+        }
+
+        // Block until the UART driver has received new data.
+        SIM70XX_UART_RingFill(p_Config, std::max((TickType_t)1, (TickType_t)((Timeout - Elapsed) / portTICK_PERIOD_MS)));
+    }
+
+    return true;
+}
+
 std::string SIM70XX_UART_ReadString(SIM70XX_UART_Conf_t& p_Config)
 {
-    int c;
+    uint32_t Now;
     std::string Return;
 
-    if(p_Config.isInitialized == false)
+    if((p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
     {
         return std::string();
     }
 
-    c = SIM7020_UART_TimedRead(p_Config);
-    while(c >= 0)
+    // Read all data until no new data are received for one second.
+    Now = SIM70XX_Tools_GetmsTimer();
+    do
     {
-        Return += (char)c;
-        c = SIM7020_UART_TimedRead(p_Config);
-    }
+        SIM70XX_UART_RingMove(p_Config, _SIM70XX_UART_Ring[p_Config.Interface].Count, &Return);
+        if(SIM70XX_UART_RingFill(p_Config, 10 / portTICK_PERIOD_MS) > 0)
+        {
+            Now = SIM70XX_Tools_GetmsTimer();
+        }
+    } while((SIM70XX_Tools_GetmsTimer() - Now) < 1000);
 
     return Return;
 }
 
 void SIM70XX_UART_Flush(SIM70XX_UART_Conf_t& p_Config)
 {
-    if(p_Config.isInitialized == false)
+    if((p_Config.isInitialized == false) || (SIM70XX_UART_isConsumer(p_Config) == false))
     {
         return;
     }
 
-    xSemaphoreTake(p_Config.Lock, portMAX_DELAY);
-    uart_flush(p_Config.Interface);
-    xSemaphoreGive(p_Config.Lock);
+    SIM70XX_Port_UART_Flush(p_Config);
+
+    SIM70XX_UART_RingReset(p_Config);
 }
 
 size_t SIM70XX_UART_Available(SIM70XX_UART_Conf_t& p_Config)
 {
-    size_t Avail;
-
-    if((p_Config.Lock == NULL) || (p_Config.isInitialized == false))
+    if(p_Config.isInitialized == false)
     {
         return 0;
     }
 
-    xSemaphoreTake(p_Config.Lock, portMAX_DELAY);
-    uart_get_buffered_data_len(p_Config.Interface, &Avail);
-    xSemaphoreGive(p_Config.Lock);
-
-    // TODO: Can return 0?
+    p_Config.RxCalls++;
 
-    return Avail;
+    return SIM70XX_Port_UART_GetBuffered(p_Config) + _SIM70XX_UART_Ring[p_Config.Interface].Count;
 }
\ No newline at end of file
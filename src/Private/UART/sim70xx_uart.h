@@ -26,6 +26,24 @@
 #include "sim70xx_defs.h"
 #include "sim70xx_errors.h"
 
+/** @brief UART transmit fragment definition.
+ */
+typedef struct
+{
+    const void* p_Data;                             /**< Pointer to fragment data. */
+    size_t Length;                                  /**< Length of the fragment data in bytes. */
+    SIM70XX_Encoding_t Encoding;                    /**< Encoding of the fragment data. The data are encoded during the transmission. */
+} SIM70XX_UART_Fragment_t;
+
+/** @brief          Check if the calling task may use the receive path of the interface.
+ *                  NOTE: The receive buffer has a single consumer and no lock. When the communication task is running, only this task
+ *                        may read from the interface or flush it. All other tasks must use the command queue. The read and flush
+ *                        functions of this module fail when they are called from another task.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @return         #true when no communication task is running or when the calling task is the communication task
+ */
+bool SIM70XX_UART_isConsumer(SIM70XX_UART_Conf_t& p_Config);
+
 /** @brief          Initialize the UART interface.
  *  @param p_Config Pointer to SIM70XX UART configuration object
  *  @return         SIM70XX_ERR_OK when successful
@@ -38,6 +56,34 @@ SIM70XX_Error_t SIM70XX_UART_Init(SIM70XX_UART_Conf_t& p_Config);
  */
 SIM70XX_Error_t SIM70XX_UART_Deinit(SIM70XX_UART_Conf_t& p_Config);
 
+/** @brief          Change the baudrate of an initialized UART interface without reinstalling the driver.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param Baudrate New baudrate
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_UART_SetBaudrate(SIM70XX_UART_Conf_t& p_Config, SIM70XX_Baud_t Baudrate);
+
+/** @brief          Enable or disable the RTS/CTS hardware flow control of the interface.
+ *                  NOTE: The RTS and CTS pins are assigned during initialization when the flow control is enabled in the configuration.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param Enable   Enable / Disable flow control
+ *  @return         SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_UART_SetFlowControl(SIM70XX_UART_Conf_t& p_Config, bool Enable);
+
+/** @brief          Get the receive overflow counters of the interface.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Stats  Pointer to statistics object
+ */
+void SIM70XX_UART_GetStatistics(SIM70XX_UART_Conf_t& p_Config, SIM70XX_Statistics_t* p_Stats);
+
+/** @brief          Get and process the next event from the UART driver event queue.
+ *                  NOTE: Receive buffer overflows are handled by this function.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @return         #true when new data were received
+ */
+bool SIM70XX_UART_ProcessEvent(SIM70XX_UART_Conf_t& p_Config);
+
 /** @brief          Send a command data the UART interface.
  *  @param p_Config Pointer to SIM70XX UART configuration object
  *  @param p_Data   Pointer to data
@@ -46,12 +92,21 @@ SIM70XX_Error_t SIM70XX_UART_Deinit(SIM70XX_UART_Conf_t& p_Config);
  */
 SIM70XX_Error_t SIM70XX_UART_Send(SIM70XX_UART_Conf_t& p_Config, const void* p_Data, size_t Size);
 
+/** @brief              Send a list of fragments over the UART interface in one transmission.
+ *                      NOTE: The fragments are written directly to the UART driver without creating a concatenated copy.
+ *  @param p_Config     Pointer to SIM70XX UART configuration object
+ *  @param p_Fragments  Pointer to fragment list
+ *  @param Count        Number of fragments
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+SIM70XX_Error_t SIM70XX_UART_SendFragments(SIM70XX_UART_Conf_t& p_Config, const SIM70XX_UART_Fragment_t* p_Fragments, size_t Count);
+
 /** @brief          Send a command over the UART interface.
  *  @param p_Config Pointer to SIM70XX UART configuration object
  *  @param Command  Command string
  *  @return         SIM70XX_ERR_OK when successful
  */
-SIM70XX_Error_t SIM70XX_UART_SendLine(SIM70XX_UART_Conf_t& p_Config, std::string Command);
+SIM70XX_Error_t SIM70XX_UART_SendLine(SIM70XX_UART_Conf_t& p_Config, const std::string& Command);
 
 /** @brief          Read a number of bytes from the UART interface.
  *  @param p_Config Pointer to SIM70XX UART configuration object
@@ -61,11 +116,22 @@ SIM70XX_Error_t SIM70XX_UART_SendLine(SIM70XX_UART_Conf_t& p_Config, std::string
  */
 size_t SIM70XX_UART_Read(SIM70XX_UART_Conf_t& p_Config, uint8_t* p_Buffer, size_t Size);
 
+/** @brief          Read an exact number of bytes from the UART interface.
+ *                  NOTE: The data are copied directly from the UART driver into the buffer when the receive buffer is empty.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Buffer Pointer to data buffer
+ *  @param Size     Number of bytes to read
+ *  @param Timeout  Timeout in milliseconds. The timeout is restarted with each received block.
+ *  @return         Number of bytes read
+ */
+size_t SIM70XX_UART_ReadBytes(SIM70XX_UART_Conf_t& p_Config, uint8_t* p_Buffer, size_t Size, uint32_t Timeout);
+
 /** @brief          Read a character from the serial interface.
  *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param Timeout  (Optional) Time in milliseconds to wait for a character
  *  @return         Received character or -1 when no bytes available
  */
-int SIM70XX_UART_Read(SIM70XX_UART_Conf_t& p_Config);
+int SIM70XX_UART_Read(SIM70XX_UART_Conf_t& p_Config, uint32_t Timeout = 0);
 
 /** @brief              Receive a string from the UART interface until a termination character is received.
  *  @param p_Config     Pointer to SIM70XX UART configuration object
@@ -75,6 +141,36 @@ int SIM70XX_UART_Read(SIM70XX_UART_Conf_t& p_Config);
  */
 std::string SIM70XX_UART_ReadStringUntil(SIM70XX_UART_Conf_t& p_Config, char Terminator = '\n', uint32_t Timeout = 1000U);
 
+/** @brief              Receive a string from the UART interface until a termination character is received.
+ *                      NOTE: The string is reused. So no heap allocation is needed when the capacity of the string is large enough.
+ *  @param p_Config     Pointer to SIM70XX UART configuration object
+ *  @param p_String     Pointer to received string
+ *  @param Terminator   (Optional) Termination character
+ *  @param Timeout      (Optional) Timeout in milliseconds
+ */
+void SIM70XX_UART_ReadStringUntil(SIM70XX_UART_Conf_t& p_Config, std::string* p_String, char Terminator = '\n', uint32_t Timeout = 1000U);
+
+/** @brief          Get a complete line from the receive buffer without waiting.
+ *                  NOTE: Lines longer than the receive buffer are collected outside of the buffer. Lines longer than
+ *                  #CONFIG_SIM70XX_UART_LINE_SIZE are discarded and counted as line overflow.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Line   Pointer to line
+ *                  NOTE: The trailing \n is removed from the line.
+ *  @return         #true when a complete line was received
+ */
+bool SIM70XX_UART_ReadLine(SIM70XX_UART_Conf_t& p_Config, std::string* p_Line);
+
+/** @brief          Wait for a complete line from the receive buffer.
+ *                  NOTE: The calling task is blocked by the UART driver until new data are received. An incomplete line is kept in
+ *                  the receive buffer when the timeout expires.
+ *  @param p_Config Pointer to SIM70XX UART configuration object
+ *  @param p_Line   Pointer to line
+ *                  NOTE: The trailing \n is removed from the line.
+ *  @param Timeout  Timeout in milliseconds
+ *  @return         #true when a complete line was received
+ */
+bool SIM70XX_UART_WaitLine(SIM70XX_UART_Conf_t& p_Config, std::string* p_Line, uint32_t Timeout);
+
 /** @brief          Receive a string from the UART interface.
  *  @param p_Config Pointer to SIM70XX UART configuration object
  *  @return         Received string
@@ -25,75 +25,33 @@
 
 #include "sim7020.h"
 #include "sim7020_evt.h"
+#include "../../Private/Events/sim70xx_urc.h"
+#include "../../Private/Events/sim70xx_mailbox.h"
+#include "../../Private/Queue/sim70xx_queue.h"
 
 static const char* TAG = "SIM7020_Evt";
 
-void SIM70XX_Evt_MessageFilter(void* p_Device, std::string* p_Message)
+void SIM7020_Evt_on_PowerDown(void* p_Device, std::string* p_Message)
 {
-	bool Found;
 	SIM7020_t* Device = (SIM7020_t*)p_Device;
 
-	Found = false;
-
-	// Shutdown message was received.
-	if(p_Message->find("NORMAL POWER DOWN") != std::string::npos)
-	{
-		Device->Internal.isActive = false;
-
-		// TODO: Event?
-
-		delete p_Message;
-
-		ESP_LOGI(TAG, "Power down event!");
-	}
-
-	// TODO: New Event filter logic (see SIM7080)
-
-	if(p_Message->find("EXIT PSM") != std::string::npos)
-	{
-		SIM7020_Evt_on_PSM_Event(Device, p_Message, false);
-	}
-
-	if(p_Message->find("ENTER PSM") != std::string::npos)
-	{
-		SIM7020_Evt_on_PSM_Event(Device, p_Message, true);
-	}
-
-	#ifdef CONFIG_SIM70XX_DRIVER_WITH_TCPIP
-		if(p_Message->find("+CSOERR") != std::string::npos)
-		{
-			SIM7020_Evt_on_TCP_Disconnect(Device, p_Message);
-		}
-	#endif
+	Device->Internal.isActive = false;
 
-	#ifdef CONFIG_SIM70XX_DRIVER_WITH_MQTT
-		if(p_Message->find("+CMQPUB") != std::string::npos)
-		{
-			SIM7020_Evt_on_MQTT_Pub(Device, p_Message);
-		}
+	// Wake up all waiting tasks. The tasks are checking the active state of the device.
+	SIM70XX_Queue_WakeAll();
+	SIM70XX_Mailbox_WakeAll();
 
-		// Handle MQTT(S) socket disconnect events.
-		if(p_Message->find("+CMQDISCON") != std::string::npos)
-		{
-			SIM7020_Evt_on_MQTT_Disconnect(Device, p_Message);
-		}
-	#endif
+	// TODO: Event?
 
-	#ifdef CONFIG_SIM70XX_DRIVER_WITH_HTTP
-		if(p_Message->find("+CHTTPERR") != std::string::npos)
-		{
-			SIM7020_Evt_on_HTTP_Event(Device, p_Message);
-		}
-	#endif
+	ESP_LOGI(TAG, "Power down event!");
+}
 
-	// Handle all other messages by putting them into the event queue.
-	if(Found == false)
-	{
-		xQueueSend(Device->Internal.EventQueue, &p_Message, 0);
-	}
-	else
+void SIM70XX_Evt_MessageFilter(void* p_Device, std::string* p_Message)
+{
+	// NOTE: Events which are waited for are registered as URC and moved into the event mailboxes by the dispatcher.
+	if(SIM70XX_URC_Dispatch(p_Device, p_Message) == false)
 	{
-		delete p_Message;
+		ESP_LOGD(TAG, "Unhandled event: %%s", p_Message->c_str());
 	}
 }
 
@@ -38,13 +38,13 @@
      *  @param p_Device     Pointer to device
      *  @param p_Message    Pointer to message string
      */
-    void SIM7020_Evt_on_MQTT_Pub(SIM7020_t* const p_Device, std::string* p_Message);
+    void SIM7020_Evt_on_MQTT_Pub(void* p_Device, std::string* p_Message);
 
     /** @brief              MQTT disconnect event handler.
      *  @param p_Device     Pointer to device
      *  @param p_Message    Pointer to message string
      */
-    void SIM7020_Evt_on_MQTT_Disconnect(SIM7020_t* const p_Device, std::string* p_Message);
+    void SIM7020_Evt_on_MQTT_Disconnect(void* p_Device, std::string* p_Message);
 #endif
 
 #ifdef CONFIG_SIM70XX_DRIVER_WITH_HTTP
@@ -52,7 +52,7 @@
      *  @param p_Device     Pointer to device
      *  @param p_Message    Pointer to message string
      */
-    void SIM7020_Evt_on_HTTP_Event(SIM7020_t* const p_Device, std::string* p_Message);
+    void SIM7020_Evt_on_HTTP_Event(void* p_Device, std::string* p_Message);
 #endif
 
 /** @brief              Power management event handler.
@@ -62,12 +62,30 @@
  */
 void SIM7020_Evt_on_PSM_Event(SIM7020_t* const p_Device, std::string* p_Message, bool isPSM);
 
+/** @brief              "ENTER PSM" event handler.
+ *  @param p_Device     Pointer to device
+ *  @param p_Message    Pointer to message string
+ */
+void SIM7020_Evt_on_PSM_Enter(void* p_Device, std::string* p_Message);
+
+/** @brief              "EXIT PSM" event handler.
+ *  @param p_Device     Pointer to device
+ *  @param p_Message    Pointer to message string
+ */
+void SIM7020_Evt_on_PSM_Exit(void* p_Device, std::string* p_Message);
+
+/** @brief              Power down event handler.
+ *  @param p_Device     Pointer to device
+ *  @param p_Message    Pointer to message string
+ */
+void SIM7020_Evt_on_PowerDown(void* p_Device, std::string* p_Message);
+
 #ifdef CONFIG_SIM70XX_DRIVER_WITH_TCPIP
     /** @brief              TCP/IP disconnect event handler.
      *  @param p_Device     Pointer to device
      *  @param p_Message    Pointer to message string
      */
-    void SIM7020_Evt_on_TCP_Disconnect(SIM7020_t* const p_Device, std::string* p_Message);
+    void SIM7020_Evt_on_TCP_Disconnect(void* p_Device, std::string* p_Message);
 #endif
 
 #endif /* SIM7020_EVT_H_ */
\ No newline at end of file
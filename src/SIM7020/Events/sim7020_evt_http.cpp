@@ -30,11 +30,12 @@
 
 static const char* TAG = "SIM7020_Evt_HTTP";
 
-void SIM7020_Evt_on_HTTP_Event(SIM7020_t* const p_Device, std::string* p_Message)
+void SIM7020_Evt_on_HTTP_Event(void* p_Device, std::string* p_Message)
 {
     int Index;
     uint8_t ID;
     SIM7020_HTTP_Error_t HTTP_Error;
+    SIM7020_t* Device = (SIM7020_t*)p_Device;
 
     ESP_LOGI(TAG, "HTTP disconnect event!");
 
@@ -51,11 +52,12 @@ void SIM7020_Evt_on_HTTP_Event(SIM7020_t* const p_Device, std::string* p_Message
     HTTP_Error = (SIM7020_HTTP_Error_t)std::stoi(p_Message->substr(Index + 1));
 
     // Iterate through the list of active sockets and close the socket with the given ID.
-    for(std::vector<SIM7020_HTTP_Socket_t*>::iterator it = p_Device->HTTP.Sockets.begin(); it != p_Device->HTTP.Sockets.end(); ++it)
+    for(std::vector<SIM7020_HTTP_Socket_t*>::iterator it = Device->HTTP.Sockets.begin(); it != Device->HTTP.Sockets.end(); ++it)
     {
         if((*it)->ID == ID)
         {
             (*it)->isConnected = false;
+            (*it)->Error = HTTP_Error;
 
             ESP_LOGI(TAG, "Disconnect socket %u", ID);
             ESP_LOGI(TAG, "Error: %i", HTTP_Error);
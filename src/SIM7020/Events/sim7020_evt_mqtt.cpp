@@ -26,62 +26,61 @@
 #include "sim7020.h"
 #include "sim7020_evt.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Parser/sim70xx_parser.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7020_Evt_MQTT";
 
-void SIM7020_Evt_on_MQTT_Pub(SIM7020_t* const p_Device, std::string* p_Message)
+void SIM7020_Evt_on_MQTT_Pub(void* p_Device, std::string* p_Message)
 {
-    size_t Index;
+    uint32_t Value;
     SIM7020_Pub_t* Packet;
+    SIM70XX_Parser_t Parser;
+    SIM7020_t* Device = (SIM7020_t*)p_Device;
 
     ESP_LOGI(TAG, "MQTT subscribe event!");
 
-    Index = p_Message->find("+CMQPUB");
-    if(Index == std::string::npos)
+    // The message has the layout
+    //  +CMQPUB: <ID>,"<Topic>",<QoS>,<Retained>,<Dup>,<Length>,"<Payload>"
+    SIM70XX_Parser_Init(&Parser, *p_Message);
+    if(SIM70XX_Parser_SkipPrefix(&Parser, "+CMQPUB: ") == false)
     {
         return;
     }
 
     Packet = new SIM7020_Pub_t();
 
-    SIMXX_TOOLS_REMOVE_LINEEND((*p_Message));
-
-    p_Message->replace(p_Message->find("+CMQPUB: "), std::string("+CMQPUB: ").size(), "");
-
-    // Get the socket ID.
-    Packet->ID = std::stoi(SIM70XX_Tools_SubstringSplitErase(p_Message));
-
-    // Get the message topic.
-    Packet->Topic = SIM70XX_Tools_SubstringSplitErase(p_Message);
-
-    // Get the quality of service.
-    Packet->QoS = (SIM7020_MQTT_QoS_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(p_Message));
+    SIM70XX_Parser_GetUInt(&Parser, &Value);
+    Packet->ID = Value;
+    SIM70XX_Parser_GetString(&Parser, &Packet->Topic);
+    SIM70XX_Parser_GetUInt(&Parser, &Value);
+    Packet->QoS = (SIM7020_MQTT_QoS_t)Value;
+    SIM70XX_Parser_GetUInt(&Parser, &Value);
+    Packet->Retained = (bool)Value;
+    SIM70XX_Parser_GetUInt(&Parser, &Value);
+    Packet->Dup = (bool)Value;
 
-    // Get the retained flag.
-    Packet->Retained = (bool)std::stoi(SIM70XX_Tools_SubstringSplitErase(p_Message));
+    // Skip the length.
+    SIM70XX_Parser_Next(&Parser);
 
-    // Get the duplicate flag.
-    Packet->Dup = (bool)std::stoi(SIM70XX_Tools_SubstringSplitErase(p_Message));
+    SIM70XX_Parser_GetString(&Parser, &Packet->Payload, '\r');
 
-    // Skip the length.
-    Index = p_Message->find(",");
-    p_Message->substr(0, Index);
-    p_Message->erase(0, Index + 1);
+    if(Parser.isError)
+    {
+        ESP_LOGE(TAG, "Invalid publish message!");
 
-    // Get the message payload.
-    Packet->Payload = p_Message->substr(0);
+        delete Packet;
 
-    Packet->Topic.replace(Packet->Topic.find("\""), std::string("\"").size(), "");
-    Packet->Payload.replace(Packet->Payload.find("\""), std::string("\"").size(), "");
+        return;
+    }
 
-    if((p_Device->MQTT.SubQueue == NULL) || (xQueueSend(p_Device->MQTT.SubQueue, &Packet, 0) != pdPASS))
+    if((Device->MQTT.SubQueue == NULL) || (xQueueSend(Device->MQTT.SubQueue, &Packet, 0) != pdPASS))
     {
         delete Packet;
     }
 }
 
-void SIM7020_Evt_on_MQTT_Disconnect(SIM7020_t* const p_Device, std::string* p_Message)
+void SIM7020_Evt_on_MQTT_Disconnect(void* p_Device, std::string* p_Message)
 {
     int Index;
 
@@ -28,10 +28,20 @@
 #include "../../Private/Queue/sim70xx_queue.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
-static const char* TAG = "SIM7020_Evt_TCP";
+static const char* TAG = "SIM7020_Evt_PSM";
 
 void SIM7020_Evt_on_PSM_Event(SIM7020_t* const p_Device, std::string* p_Message, bool isPSM)
 {
 }
 
+void SIM7020_Evt_on_PSM_Enter(void* p_Device, std::string* p_Message)
+{
+    SIM7020_Evt_on_PSM_Event((SIM7020_t*)p_Device, p_Message, true);
+}
+
+void SIM7020_Evt_on_PSM_Exit(void* p_Device, std::string* p_Message)
+{
+    SIM7020_Evt_on_PSM_Event((SIM7020_t*)p_Device, p_Message, false);
+}
+
 #endif
\ No newline at end of file
@@ -30,11 +30,12 @@
 
 static const char* TAG = "SIM7020_Evt_TCP";
 
-void SIM7020_Evt_on_TCP_Disconnect(SIM7020_t* const p_Device, std::string* p_Message)
+void SIM7020_Evt_on_TCP_Disconnect(void* p_Device, std::string* p_Message)
 {
     size_t Index;
     uint8_t ID;
     SIM7020_TCP_Error_t TCP_Error;
+    SIM7020_t* Device = (SIM7020_t*)p_Device;
 
     ESP_LOGI(TAG, "TCP disconnect event!");
 
@@ -51,7 +52,7 @@ void SIM7020_Evt_on_TCP_Disconnect(SIM7020_t* const p_Device, std::string* p_Mes
     TCP_Error = (SIM7020_TCP_Error_t)std::stoi(p_Message->substr(Index));
 
     // Iterate through the list of active sockets and close the socket with the given ID.
-    for(std::vector<SIM7020_TCP_Socket_t*>::iterator it = p_Device->TCP.Sockets.begin(); it != p_Device->TCP.Sockets.end(); ++it)
+    for(std::vector<SIM7020_TCP_Socket_t*>::iterator it = Device->TCP.Sockets.begin(); it != Device->TCP.Sockets.end(); ++it)
     {
         if((*it)->ID == ID)
         {
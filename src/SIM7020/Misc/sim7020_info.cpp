@@ -25,6 +25,7 @@
 
 #include "sim7020.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Parser/sim70xx_parser.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7020_Info";
@@ -76,9 +77,9 @@ SIM70XX_Error_t SIM7020_Info_GetManufacturer(SIM7020_t& p_Device, std::string* c
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGMI;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_Manufacturer);
+        return SIM70XX_Queue_PopItem(Command, p_Manufacturer);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -100,9 +101,9 @@ SIM70XX_Error_t SIM7020_Info_GetModel(SIM7020_t& p_Device, std::string* const p_
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGMM;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_Model);
+        return SIM70XX_Queue_PopItem(Command, p_Model);
     }
 
     return SIM70XX_ERR_FAIL;  
@@ -124,9 +125,9 @@ SIM70XX_Error_t SIM7020_Info_GetFW(SIM7020_t& p_Device, std::string* const p_Fir
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGMR;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_Firmware);
+        return SIM70XX_Queue_PopItem(Command, p_Firmware);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -148,9 +149,9 @@ SIM70XX_Error_t SIM7020_Info_GetIMEI(SIM7020_t& p_Device, std::string* const p_I
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGSN;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_IMEI);
+        return SIM70XX_Queue_PopItem(Command, p_IMEI);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -172,9 +173,9 @@ SIM70XX_Error_t SIM7020_Info_GetICCID(SIM7020_t& p_Device, std::string* const p_
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CCID;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_ICCID);
+        return SIM70XX_Queue_PopItem(Command, p_ICCID);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -182,7 +183,9 @@ SIM70XX_Error_t SIM7020_Info_GetICCID(SIM7020_t& p_Device, std::string* const p_
 
 SIM70XX_Error_t SIM7020_Info_GetNetworkRegistrationStatus(SIM7020_t& p_Device)
 {
+    uint32_t Status;
     std::string Response;
+    SIM70XX_Parser_t Parser;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -193,23 +196,31 @@ SIM70XX_Error_t SIM7020_Info_GetNetworkRegistrationStatus(SIM7020_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGREG;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
-    p_Device.Connection.Status = (SIM7020_NetRegistration_t)std::stoi(Response.substr(Response.find(",") + 1));
+    // Skip the URC configuration.
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_Next(&Parser);
+    if(SIM70XX_Parser_GetUInt(&Parser, &Status) == false)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    p_Device.Connection.Status = (SIM7020_NetRegistration_t)Status;
 
     return SIM70XX_ERR_OK;
 }
 
 SIM70XX_Error_t SIM7020_Info_GetQuality(SIM7020_t& p_Device, SIM70XX_Qual_t* p_Report)
 {
-    int8_t RSSI;
-    uint8_t RXQual;
-    size_t Index;
+    uint32_t RSSI;
+    uint32_t RXQual;
     std::string Response;
+    SIM70XX_Parser_t Parser;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -224,15 +235,19 @@ SIM70XX_Error_t SIM7020_Info_GetQuality(SIM7020_t& p_Device, SIM70XX_Qual_t* p_R
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CSQ;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
-    Index = Response.find(",");
-    RSSI = std::stoi(Response.substr(0, Index));
-    RXQual = std::stoi(Response.substr(Response.find_last_of(",") + 1));
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_GetUInt(&Parser, &RSSI);
+    SIM70XX_Parser_GetUInt(&Parser, &RXQual);
+    if(Parser.isError)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
 
     if(RSSI == 0)
     {
@@ -268,8 +283,10 @@ SIM70XX_Error_t SIM7020_Info_GetQuality(SIM7020_t& p_Device, SIM70XX_Qual_t* p_R
 
 SIM70XX_Error_t SIM7020_Info_GetNetworkStatus(SIM7020_t& p_Device, SIM7020_NetState_t* const p_Status)
 {
-    size_t Index;
+    int32_t Value;
+    uint32_t Unsigned;
     std::string Response;
+    SIM70XX_Parser_t Parser;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Status == NULL)
@@ -284,32 +301,44 @@ SIM70XX_Error_t SIM7020_Info_GetNetworkStatus(SIM7020_t& p_Device, SIM7020_NetSt
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CENG_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
+
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_GetUInt(&Parser, &p_Status->sc_earfcn);
+    SIM70XX_Parser_GetInt(&Parser, &Value);
+    p_Status->sc_earfcn_offset = Value;
+    SIM70XX_Parser_GetUInt(&Parser, &Unsigned);
+    p_Status->sc_pci = Unsigned;
+    SIM70XX_Parser_GetString(&Parser, &p_Status->sc_cellid);
+    SIM70XX_Parser_GetInt(&Parser, &Value);
+    p_Status->sc_rsrp = Value;
+    SIM70XX_Parser_GetInt(&Parser, &Value);
+    p_Status->sc_rsrq = Value;
+    SIM70XX_Parser_GetInt(&Parser, &Value);
+    p_Status->sc_rssi = Value;
+    SIM70XX_Parser_GetInt(&Parser, &Value);
+    p_Status->sc_snr = Value;
+    SIM70XX_Parser_GetUInt(&Parser, &Unsigned);
+    p_Status->sc_band = Unsigned;
+    SIM70XX_Parser_GetString(&Parser, &p_Status->sc_tac);
+    SIM70XX_Parser_GetUInt(&Parser, &Unsigned);
+    p_Status->sc_ecl = Unsigned;
+    SIM70XX_Parser_GetInt(&Parser, &Value);
+    p_Status->sc_tx_pwr = Value;
+    SIM70XX_Parser_GetInt(&Parser, &Value);
+    p_Status->sc_re_rsrp = Value;
+
+    if(Parser.isError)
+    {
+        ESP_LOGE(TAG, "Invalid response!");
 
-    Index = Response.find(",");
-    if(Index == std::string::npos)
-    {
         return SIM70XX_ERR_FAIL;
     }
 
-    p_Status->sc_earfcn = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_earfcn_offset = (int8_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_pci = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_cellid = SIM70XX_Tools_SubstringSplitErase(&Response);
-    p_Status->sc_rsrp = (int16_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_rsrq = (int16_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_rssi = (int16_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_snr = (int16_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_band = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_tac = SIM70XX_Tools_SubstringSplitErase(&Response);
-    p_Status->sc_ecl = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_tx_pwr = (int16_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-    p_Status->sc_re_rsrp = (int16_t)std::stoi(Response);
-
     ESP_LOGI(TAG, "sc_earfcn: %u", p_Status->sc_earfcn);
     ESP_LOGI(TAG, "sc_earfcn_offset: %i", p_Status->sc_earfcn_offset);
     ESP_LOGI(TAG, "sc_pci: %i", p_Status->sc_pci);
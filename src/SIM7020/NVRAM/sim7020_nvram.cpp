@@ -30,31 +30,23 @@
 
 static const char* TAG = "SIM7020_NVRAM";
 
-SIM70XX_Error_t SIM7020_NVRAM_Write(SIM7020_t& p_Device, std::string Key, const std::string Data, SIM7020_NVRAM_Error_t* p_Error)
+/** @brief              Transmit a NVRAM write command and get the NVRAM error code.
+ *  @param p_Device     SIM7020 device object
+ *  @param p_Command    Pointer to command object
+ *  @param p_Error      (Optional) Pointer to NVRAM error code
+ *  @return             SIM70XX_ERR_OK when successful
+ */
+static SIM70XX_Error_t SIM7020_NVRAM_Transmit(SIM7020_t& p_Device, SIM70XX_TxCmd_t* p_Command, SIM7020_NVRAM_Error_t* p_Error)
 {
     std::string Response;
-    SIM70XX_TxCmd_t* Command;
     SIM7020_NVRAM_Error_t Error;
 
-    if((Key.size() < 1) || (Key.size() > 20) || (Data.size() < 1) || (Data.size() > 1024))
-    {
-        return SIM70XX_ERR_INVALID_ARG;
-    }
-    else if(p_Device.Internal.isInitialized == false)
-    {
-        return SIM70XX_ERR_NOT_INITIALIZED;
-    }
-
-    ESP_LOGD(TAG, "Writing to NVRAM...");
-
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CNVMW(Key, Data, Data.size());
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, p_Command);
+    if(SIM70XX_Queue_Wait(p_Command, &p_Device.Internal.isActive, p_Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Command, &Response));
 
     Error = (SIM7020_NVRAM_Error_t)std::stoi(Response);
 
@@ -71,13 +63,52 @@ SIM70XX_Error_t SIM7020_NVRAM_Write(SIM7020_t& p_Device, std::string Key, const
     return SIM70XX_ERR_OK;
 }
 
+SIM70XX_Error_t SIM7020_NVRAM_Write(SIM7020_t& p_Device, std::string Key, const std::string Data, SIM7020_NVRAM_Error_t* p_Error)
+{
+    SIM70XX_TxCmd_t* Command;
+
+    if((Key.size() < 1) || (Key.size() > 20) || (Data.size() < 1) || (Data.size() > 1024))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    ESP_LOGD(TAG, "Writing to NVRAM...");
+
+    SIM70XX_CREATE_CMD(Command);
+    *Command = SIM7020_AT_CNVMW(Key, Data, Data.size());
+
+    return SIM7020_NVRAM_Transmit(p_Device, Command, p_Error);
+}
+
 SIM70XX_Error_t SIM7020_NVRAM_Write(SIM7020_t& p_Device, std::string Key, const uint8_t* p_Buffer, uint16_t Length, SIM7020_NVRAM_Error_t* p_Error)
 {
-    std::string HexString;
+    std::string Suffix;
+    SIM70XX_TxCmd_t* Command;
 
-    SIM70XX_Tools_ASCII2Hex(p_Buffer, Length, &HexString);
+    if((p_Buffer == NULL) || (Key.size() < 1) || (Key.size() > 20) || (Length < 1) || ((Length * 2) > 1024))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    ESP_LOGD(TAG, "Writing to NVRAM...");
+
+    // The data are converted into a hex string during the transmission. The command has the layout
+    //  AT+CNVMW="<Key>","<Hex data>",<Hex length>
+    Suffix = "\"," + std::to_string(Length * 2);
+
+    SIM70XX_CREATE_CMD(Command);
+    *Command = SIM7020_AT_CNVMW_HEX(Key);
+    SIM70XX_Queue_SetPayload(Command, p_Buffer, Length, SIM70XX_ENC_HEX, Suffix.c_str());
 
-    return SIM7020_NVRAM_Write(p_Device, Key, HexString, p_Error);
+    return SIM7020_NVRAM_Transmit(p_Device, Command, p_Error);
 }
 
 SIM70XX_Error_t SIM7020_NVRAM_Read(SIM7020_t& p_Device, std::string Key, std::string* p_Payload, SIM7020_NVRAM_Error_t* p_Error)
@@ -100,11 +131,11 @@ SIM70XX_Error_t SIM7020_NVRAM_Read(SIM7020_t& p_Device, std::string Key, std::st
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CNVMR(Key);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     // Filter out the error code.
     Error = (SIM7020_NVRAM_Error_t)std::stoi(Response.substr(0, Response.find(",")));
@@ -157,11 +188,11 @@ SIM70XX_Error_t SIM7020_NVRAM_Erase(SIM7020_t& p_Device, std::string Key, SIM702
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CNVMIVD(Key);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     // Filter out the error code.
     Error = (SIM7020_NVRAM_Error_t)std::stoi(Response.substr(0, Response.find(",")));
@@ -199,11 +230,11 @@ SIM70XX_Error_t SIM7020_NVRAM_GetKeys(SIM7020_t& p_Device, std::vector<std::stri
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CNVMGET;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     // Split the response into the different keys.
     do
@@ -48,12 +48,12 @@ SIM70XX_Error_t SIM7020_PDP_GetContext(SIM7020_t& p_Device, SIM7020_PDP_Context_
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGDCONT_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     // TODO: Get the informations from the input
 
@@ -76,12 +76,12 @@ SIM70XX_Error_t SIM7020_PDP_Switch(SIM7020_t& p_Device, bool Enable, uint8_t Con
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGACT_W(Context, Enable);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7020_PDP_GetStatus(SIM7020_t& p_Device, std::vector<SIM7020_PDP_Status_t>* p_Status)
@@ -101,11 +101,11 @@ SIM70XX_Error_t SIM7020_PDP_GetStatus(SIM7020_t& p_Device, std::vector<SIM7020_P
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGACT_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     do
     {
@@ -146,11 +146,11 @@ SIM70XX_Error_t SIM7020_PDP_ReadDynamicParameters(SIM7020_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CGCONTRDP;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     // TODO: Wait for the Response event.
 
@@ -172,19 +172,19 @@ SIM70XX_Error_t SIM7020_PDP_ReadDynamicParameters(SIM7020_t& p_Device)
     // Filter out the IP address.
     for(uint8_t i = 0; i < (Parts - 1); i++)
     {
-        Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy);
+        Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy, ".");
         p_Device.PDP.IP += Octett + ".";
     }
-    Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy);
+    Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy, ".");
     p_Device.PDP.IP += Octett;
 
     // Filter the subnet mask.
     for(uint8_t i = 0; i < (Parts - 1); i++)
     {
-        Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy);
+        Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy, ".");
         p_Device.PDP.Subnet += Octett + ".";
     }
-    Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy);
+    Octett = SIM70XX_Tools_SubstringSplitErase(&Dummy, ".");
     p_Device.PDP.Subnet += Octett;
 
     // Get the operator.
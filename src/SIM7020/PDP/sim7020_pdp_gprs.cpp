@@ -45,11 +45,11 @@ bool SIM7020_PGP_GPRS_isAttached(SIM7020_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CGATT_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return false;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     return (bool)std::stoi(Response);
 }
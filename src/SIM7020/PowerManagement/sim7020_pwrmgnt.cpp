@@ -52,22 +52,22 @@ SIM70XX_Error_t SIM7020_PSM_Enable(SIM7020_t& p_Device, uint8_t Base_T, uint8_t
     // TODO: FIX ME
     //*Command = SIM7020_AT_CPSMS_EN(std::to_string(std::bitset<8>(TAU)), std::to_string(std::bitset<8>(Value)));
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_RETENTION(UseRetention);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7020_PSM_Disable(SIM7020_t& p_Device, SIM7020_PSM_Enable_t Mode)
@@ -86,12 +86,12 @@ SIM70XX_Error_t SIM7020_PSM_Disable(SIM7020_t& p_Device, SIM7020_PSM_Enable_t Mo
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CPSMS_DIS(Mode);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7020_PSM_GetMode(SIM7020_t& p_Device, SIM7020_PSM_Enable_t* p_Mode)
@@ -125,12 +125,12 @@ SIM70XX_Error_t SIM7020_PSM_GetEventStatus(SIM7020_t& p_Device, bool* p_Enable)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CPSMSTATUS_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     *p_Enable = (bool)std::stoi(Response);
 
@@ -153,12 +153,12 @@ SIM70XX_Error_t SIM7020_PSM_SetEventStatus(SIM7020_t& p_Device, bool Enable)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CPSMSTATUS_W(Enable);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 #endif
\ No newline at end of file
@@ -47,7 +47,6 @@ SIM70XX_Error_t SIM7020_CoAP_Create(SIM7020_t& p_Device, std::string Server, uin
 SIM70XX_Error_t SIM7020_CoAP_Create(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t* p_Socket)
 {
     std::string Response;
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if((p_Socket == NULL) || (p_Socket->CID > 10))
@@ -63,15 +62,14 @@ SIM70XX_Error_t SIM7020_CoAP_Create(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t*
         return SIM70XX_ERR_NOT_CONNECTED;
     }
 
-    CommandStr = "AT+CCOAPNEW=\"" + p_Socket->Server + "\"," + std::to_string(p_Socket->Port) + "," + std::to_string(p_Socket->CID);
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CCOAPNEW(CommandStr);
+    *Command = SIM7020_AT_CCOAPNEW(p_Socket->Server, p_Socket->Port, p_Socket->CID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Socket->ID = (uint8_t)std::stoi(Response);
 
@@ -86,8 +84,6 @@ SIM70XX_Error_t SIM7020_CoAP_Create(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t*
 
 SIM70XX_Error_t SIM7020_CoAP_Transmit(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t* p_Socket, const void* p_Buffer, uint16_t Length)
 {
-    std::string Buffer_Hex;
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if((p_Socket == NULL) || (p_Buffer == NULL) || (Length < 4) || (Length > 512))
@@ -103,23 +99,21 @@ SIM70XX_Error_t SIM7020_CoAP_Transmit(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t
         return SIM70XX_ERR_NOT_CONNECTED;
     }
 
-    SIM70XX_Tools_ASCII2Hex(p_Buffer, Length, &Buffer_Hex);
-
-    CommandStr = "AT+CCOAPCSEND=" + std::to_string(p_Socket->ID) + "," + std::to_string(Length) + ",\"" + Buffer_Hex + "\"";
+    // NOTE: The data are converted into a hex string during the transmission.
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CCOAPCSEND(CommandStr);
+    *Command = SIM7020_AT_CCOAPCSEND_DATA(p_Socket->ID, Length);
+    SIM70XX_Queue_SetPayload(Command, p_Buffer, Length, SIM70XX_ENC_HEX, "\"");
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);   
+    return SIM70XX_Queue_PopItem(Command);   
 }
 
 SIM70XX_Error_t SIM7020_CoAP_Transmit(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t* p_Socket, SIM7020_CoAP_Type_t Type, uint8_t FunctionCode)
 {
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
     uint8_t FunctionCode_H;
     uint8_t FunctionCode_L;
@@ -136,16 +130,15 @@ SIM70XX_Error_t SIM7020_CoAP_Transmit(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    CommandStr = "AT+CCOAPCSEND=" + std::to_string(p_Socket->ID) + ",1," + std::to_string(Type) + "," + std::to_string(FunctionCode_H) + "," + std::to_string(FunctionCode_L);
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CCOAPCSEND(CommandStr);
+    *Command = SIM7020_AT_CCOAPCSEND(p_Socket->ID, Type, FunctionCode_H, FunctionCode_L);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);    
+    return SIM70XX_Queue_PopItem(Command);    
 }
 
 SIM70XX_Error_t SIM7020_CoAP_Destroy(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t* p_Socket)
@@ -168,11 +161,11 @@ SIM70XX_Error_t SIM7020_CoAP_Destroy(SIM7020_t& p_Device, SIM7020_CoAP_Socket_t*
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CCOAPDEL(p_Socket->ID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     p_Socket->isConnected = false;
 
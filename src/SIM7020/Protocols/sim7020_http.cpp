@@ -23,11 +23,23 @@
 
 #include <esp_log.h>
 
+#include <string.h>
+#include <new>
+#include <algorithm>
+
 #include "sim7020.h"
 #include "sim7020_http.h"
+#include "../Events/sim7020_evt.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Events/sim70xx_urc.h"
+#include "../../Private/Events/sim70xx_mailbox.h"
+#include "../../Private/Parser/sim70xx_parser.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
+/** @brief Maximum number of payload bytes in each data packet of a request.
+ */
+#define SIM7020_HTTP_CHUNK_SIZE                     (SIM7020_CMD_BUFFER / 4)
+
 static const char* TAG = "SIM7020_HTTP";
 
 SIM70XX_Error_t SIM7020_HTTP_Create(SIM7020_t& p_Device, std::string Host, SIM7020_HTTP_Socket_t* p_Socket)
@@ -57,6 +69,11 @@ SIM70XX_Error_t SIM7020_HTTP_Create(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t*
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
+    // Register the URC handlers of the module.
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("+CHTTPERR", SIM7020_Evt_on_HTTP_Event));
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Register("+CHTTPNMIH", true));
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Register("+CHTTPNMIC", true));
+
     // Check if the URL is valid.
     std::for_each(p_Socket->Host.begin(), p_Socket->Host.end(), [](char& c)
     {
@@ -70,11 +87,11 @@ SIM70XX_Error_t SIM7020_HTTP_Create(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t*
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CHTTPCREATE(p_Socket->Host);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Socket->isConnected = false;
     p_Socket->isCreated = true;
@@ -110,16 +127,20 @@ SIM70XX_Error_t SIM7020_HTTP_Connect(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t*
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CHTTCON(p_Socket->ID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response, &Status));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response, &Status));
 
     // Everything okay. The socket is active now.
     ESP_LOGI(TAG, "Socket %u opened...", p_Socket->ID);
 
-    p_Device.HTTP.Sockets.push_back(p_Socket);
+    // NOTE: A reconnected socket is already in the list with active sockets.
+    if(std::find(p_Device.HTTP.Sockets.begin(), p_Device.HTTP.Sockets.end(), p_Socket) == p_Device.HTTP.Sockets.end())
+    {
+        p_Device.HTTP.Sockets.push_back(p_Socket);
+    }
     p_Socket->isConnected = true;
 
     return SIM70XX_ERR_OK;
@@ -130,43 +151,59 @@ SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_
     return SIM7020_HTTP_POST(p_Device, p_Socket, Path, ContentType, Header, Payload.c_str(), Payload.size(), p_ResponseCode);
 }
 
-SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, const void* p_Buffer, uint32_t Length, uint16_t* p_ResponseCode)
+/** @brief                  Transmit a HTTP(S) post request. The payload is taken from a buffer or from a reader.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param ContentType      Content type
+ *  @param Header           Request header
+ *  @param p_Buffer         Pointer to data buffer
+ *                          NOTE: Only used when no reader is given.
+ *  @param Reader           Payload reader or #NULL
+ *  @param p_Arg            User argument for the reader
+ *  @param p_Chunks         Pointer to two chunk buffers with #SIM7020_HTTP_CHUNK_SIZE bytes for the reader
+ *  @param Length           Payload length
+ *  @param p_ResponseCode   Pointer to response code
+ *  @param Writer           Content writer for the response body or #NULL
+ *                          NOTE: The body is kept in the mailbox for #SIM7020_HTTP_ReadResponse when no writer is given.
+ *  @param p_WriterArg      User argument for the writer
+ *  @param p_ResponseLength Pointer to content length of the response body
+ *  @return                 SIM70XX_ERR_OK when successful
+ */
+static SIM70XX_Error_t SIM7020_HTTP_Transmit(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string& Path, std::string& ContentType, std::string& Header, const void* p_Buffer,
+                                             SIM7020_HTTP_Reader_t Reader, void* p_Arg, uint8_t* p_Chunks, uint32_t Length, uint16_t* p_ResponseCode,
+                                             SIM7020_HTTP_Writer_t Writer, void* p_WriterArg, uint32_t* p_ResponseLength)
 {
-    std::string CommandStr;
-    std::string Buffer_Hex;
     std::string Packet;
+    std::string Suffix;
     uint16_t ResponseCode;
-    uint32_t Now;
+    uint32_t Value;
+    uint32_t PacketLength;
     uint32_t PayloadLength_Length;
     uint32_t TotalLength;
     uint32_t Length_Temp = Length;
     SIM70XX_TxCmd_t* Command;
+    SIM70XX_TxCmd_t* Previous;
+    SIM70XX_Parser_t Parser;
+    SIM70XX_Error_t Error;
     bool isFirstPacket;
-    char* Buffer_Temp = (char*)p_Buffer;
+    uint32_t Packets;
+    const uint8_t* Buffer_Temp = (const uint8_t*)p_Buffer;
 
-    if(p_Socket == NULL)
-    {
-        return SIM70XX_ERR_INVALID_ARG;
-    }
-    else if(p_Device.Internal.isInitialized == false)
-    {
-        return SIM70XX_ERR_NOT_INITIALIZED;
-    }
-    else if(p_Socket->isConnected == false)
-    {
-        return SIM70XX_ERR_NOT_CONNECTED;
-    }
+    // Remove the responses of previous requests. The mailbox for the response body is assigned now, so no part of the body is lost.
+    SIM70XX_Mailbox_Flush("+CHTTPNMIH", p_Socket->ID);
+    SIM70XX_Mailbox_Flush("+CHTTPNMIC", p_Socket->ID, true);
 
-    // Prepare the header packet.
-    SIM70XX_Tools_ASCII2Hex(Header.c_str(), Header.size(), &Buffer_Hex);
+    // Prepare the header packet. The header is converted into a hex string during the transmission.
+    //  <ID>,<Method>,<Path length>,"<Path>",<Header length>,<Header>,<Content type length>,"<Content type>",
     Packet = std::to_string(p_Socket->ID) + "," +
              std::to_string(SIM7020_HTTP_REQ_POST) + "," +
              std::to_string(Path.size()) + "," +
              "\"" + Path + "\"" + "," +
-             std::to_string(Buffer_Hex.size()) + "," +
-             Buffer_Hex + "," +
-             std::to_string(ContentType.size()) + "," +
+             std::to_string(Header.size() * 2) + ",";
+    Suffix = "," + std::to_string(ContentType.size()) + "," +
              "\"" + ContentType + "\",";
+    PacketLength = Packet.size() + (Header.size() * 2) + Suffix.size();
 
     // The length of the payload length and the trailing comma.
     PayloadLength_Length = std::to_string(Length_Temp * 2).size() + 1;
@@ -176,27 +213,33 @@ SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_
     //  - The length of the payload (multiplied by 2, because ASCII)    +
     //  - The length of the payload length                              +
     //  - 1 (for the comma)
-    TotalLength = Packet.size() + (Length_Temp * 2) + PayloadLength_Length;
+    TotalLength = PacketLength + (Length_Temp * 2) + PayloadLength_Length;
 
     // Transmit the header.
-    CommandStr = "AT+CHTTPSENDEXT=" + std::to_string(1) + "," +
-                                      std::to_string(TotalLength) + "," +
-                                      std::to_string(Packet.size()) + "," +
-                                      Packet;
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CHTTPSENDEXT(CommandStr);
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+    SIM70XX_CREATE_CMD(Previous);
+    *Previous = SIM7020_AT_CHTTPSENDEXT(1, TotalLength, PacketLength, Packet);
+    SIM70XX_Queue_SetPayload(Previous, Header.c_str(), Header.size(), SIM70XX_ENC_HEX, Suffix.c_str());
+    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Previous);
 
     // Transmit the data packets.
+    // NOTE: The next packet is queued before waiting for the result of the previous packet. So the communication task can transmit
+    //       the next packet without waiting for the application task. The payload is converted into a hex string during the transmission.
+    // NOTE: The packets are not pipelined. The communication task transmits a packet after the module has answered the previous packet,
+    //       so only one packet is sent to the module at a time. Only reading the next chunk overlaps with the transmission.
+    // NOTE: The header, the suffix and the chunk buffers are used by the communication task. Each error path waits for the queued packets,
+    //       because a failed wait returns only when the communication task doesn´t use the buffers anymore.
+    // NOTE: A reader fills the two chunk buffers alternately. A chunk buffer is refilled after the module has acknowledged
+    //       the packet with this buffer. So the number of queued packets and the memory usage don´t depend on the payload length.
     isFirstPacket = true;
+    Packets = 0;
     do
     {
         uint32_t BytesToTransmit;
         bool isAdditionalPackets;
 
-        if(Length_Temp > (SIM7020_CMD_BUFFER / 4))
+        if(Length_Temp > SIM7020_HTTP_CHUNK_SIZE)
         {
-            BytesToTransmit = (SIM7020_CMD_BUFFER / 4);
+            BytesToTransmit = SIM7020_HTTP_CHUNK_SIZE;
             isAdditionalPackets = true;
         }
         else
@@ -205,84 +248,136 @@ SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_
             isAdditionalPackets = false;
         }
 
-        SIM70XX_Tools_ASCII2Hex(Buffer_Temp, BytesToTransmit, &Buffer_Hex);
+        if(Reader != NULL)
+        {
+            Buffer_Temp = &p_Chunks[(Packets % 2) * SIM7020_HTTP_CHUNK_SIZE];
+            if(Reader(p_Arg, (uint8_t*)Buffer_Temp, BytesToTransmit) != BytesToTransmit)
+            {
+                ESP_LOGE(TAG, "Payload reader has failed!");
 
-        if(isFirstPacket == true)
+                SIM70XX_Queue_WaitAll(&Previous, 1, &p_Device.Internal.isActive);
+
+                return SIM70XX_ERR_FAIL;
+            }
+        }
+
+        Command = SIM70XX_Queue_Acquire();
+        if(Command == NULL)
         {
-            // Prepare the payload packet
-            //  <Length>,<Payload>
-            Packet = std::to_string(Length_Temp * 2) + "," + Buffer_Hex;
+            SIM70XX_Queue_WaitAll(&Previous, 1, &p_Device.Internal.isActive);
 
+            return SIM70XX_ERR_NO_MEM;
+        }
+
+        if(isFirstPacket == true)
+        {
             // NOTE: The first data packet must contain the length of the payload.
-            //  <1/0>, <TotalLength>,<Payload Length + Number of Chars for the Payload length + 1>,<Payload Length>
-            CommandStr = "AT+CHTTPSENDEXT=" + std::to_string(isAdditionalPackets) + "," +
-                                              std::to_string(TotalLength) + "," +
-                                              std::to_string(Buffer_Hex.size() + PayloadLength_Length) + "," +
-                                              Packet;
+            //  <1/0>, <TotalLength>,<Payload Length + Number of Chars for the Payload length + 1>,<Payload Length>,<Payload>
+            *Command = SIM7020_AT_CHTTPSENDEXT_FIRST(isAdditionalPackets, TotalLength, (BytesToTransmit * 2) + PayloadLength_Length, Length_Temp * 2);
 
             isFirstPacket = false;
         }
         else
         {
-            CommandStr = "AT+CHTTPSENDEXT=" + std::to_string(isAdditionalPackets) + "," +
-                                              std::to_string(TotalLength) + "," +
-                                              std::to_string(Buffer_Hex.size()) + "," + Buffer_Hex;
+            *Command = SIM7020_AT_CHTTPSENDEXT(isAdditionalPackets, TotalLength, BytesToTransmit * 2, "");
         }
+        SIM70XX_Queue_SetPayload(Command, Buffer_Temp, BytesToTransmit, SIM70XX_ENC_HEX);
 
-        SIM70XX_CREATE_CMD(Command);
-        *Command = SIM7020_AT_CHTTPSENDEXT(CommandStr);
-        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+        Error = SIM70XX_Queue_Push(p_Device.Internal.TxQueue, Command);
+        if(Error != SIM70XX_ERR_OK)
+        {
+            SIM70XX_Queue_WaitAll(&Previous, 1, &p_Device.Internal.isActive);
+
+            return Error;
+        }
+
+        // Get the result of the previous packet.
+        Error = SIM70XX_Queue_WaitAll(&Previous, 1, &p_Device.Internal.isActive);
+        if(Error != SIM70XX_ERR_OK)
+        {
+            SIM70XX_Queue_WaitAll(&Command, 1, &p_Device.Internal.isActive);
 
+            return Error;
+        }
+
+        Previous = Command;
         Length_Temp -= BytesToTransmit;
         Buffer_Temp += BytesToTransmit;
-
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+        Packets++;
     } while(Length_Temp != 0);
 
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_WaitAll(&Previous, 1, &p_Device.Internal.isActive));
+
     // Get the response from the server.
-    Now = SIM70XX_Tools_GetmsTimer();
-    while(SIM70XX_Queue_isEvent(p_Device.Internal.EventQueue, "+CHTTPNMIH" + std::to_string(p_Socket->ID), &Packet) == false)
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Wait("+CHTTPNMIH", p_Socket->ID, &Packet, (p_Socket->Timeout * 1000UL) / portTICK_PERIOD_MS));
+
+    // Get the response code. The message has the layout
+    //  +CHTTPNMIH: <ID>,<Response code>,<Header length>,<Header>
+    SIM70XX_Parser_Init(&Parser, Packet);
+    SIM70XX_Parser_SkipPrefix(&Parser, "+CHTTPNMIH: ");
+    SIM70XX_Parser_Next(&Parser);
+    if(SIM70XX_Parser_GetUInt(&Parser, &Value) == false)
     {
-        if((SIM70XX_Tools_GetmsTimer() - Now) > (p_Socket->Timeout * 1000UL))
-        {
-            return SIM70XX_ERR_TIMEOUT;
-        }
-
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        return SIM70XX_ERR_FAIL;
     }
-
-    // Remove the command from the response.
-    Packet.replace(Packet.find("+CHTTPNMIH: " + std::to_string(p_Socket->ID) + ","), std::string("+CHTTPNMIH: " + std::to_string(p_Socket->ID) + ",").size(), "");
-
-    // Get the response code.
-    ResponseCode = std::stoi(Packet.substr(0, Packet.find(",")));
+    ResponseCode = Value;
 
     if(p_ResponseCode != NULL)
     {
         *p_ResponseCode = ResponseCode;
     }
 
-    // TODO: Items in Queue müssen korrekt ausgewertet werden
-    SIM70XX_Queue_Reset(p_Device.Internal.RxQueue);
-    ESP_LOGI(TAG, "Items: %u", SIM70XX_Queue_GetItems(p_Device.Internal.RxQueue));
-
     ESP_LOGI(TAG, "Response from server: %s", Packet.c_str());
     ESP_LOGI(TAG, "     Code: %u", ResponseCode);
 
+    // Pass the response body to the writer.
+    if(Writer != NULL)
+    {
+        return SIM7020_HTTP_ReadResponse(p_Device, p_Socket, Writer, p_WriterArg, p_ResponseLength);
+    }
+
     return SIM70XX_ERR_OK;
 }
 
-SIM70XX_Error_t SIM7020_HTTP_GET(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, uint8_t** p_Buffer, uint32_t* p_Length, uint16_t* p_ResponseCode)
+/** @brief                  Transmit a HTTP(S) post request with a payload reader.
+ *                          NOTE: The two chunk buffers for the reader are allocated during the request.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param ContentType      Content type
+ *  @param Header           Request header
+ *  @param Reader           Payload reader
+ *  @param p_ReaderArg      User argument for the reader
+ *  @param Length           Payload length
+ *  @param p_ResponseCode   Pointer to response code
+ *  @param Writer           Content writer for the response body or #NULL
+ *  @param p_WriterArg      User argument for the writer
+ *  @param p_ResponseLength Pointer to content length of the response body
+ *  @return                 SIM70XX_ERR_OK when successful
+ */
+static SIM70XX_Error_t SIM7020_HTTP_TransmitChunks(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string& Path, std::string& ContentType, std::string& Header,
+                                                   SIM7020_HTTP_Reader_t Reader, void* p_ReaderArg, uint32_t Length, uint16_t* p_ResponseCode,
+                                                   SIM7020_HTTP_Writer_t Writer, void* p_WriterArg, uint32_t* p_ResponseLength)
 {
-    size_t Index;
-    uint32_t Now;
-    uint16_t ResponseCode;
-    std::string Response;
-    std::string CommandStr;
-    SIM70XX_TxCmd_t* Command;
-    bool isAdditionalData;
+    uint8_t* Chunks;
+    SIM70XX_Error_t Error;
 
-    if((p_Socket == NULL) || (p_Buffer == NULL) || (p_Length == NULL))
+    Chunks = (uint8_t*)malloc(2 * SIM7020_HTTP_CHUNK_SIZE);
+    if(Chunks == NULL)
+    {
+        return SIM70XX_ERR_NO_MEM;
+    }
+
+    Error = SIM7020_HTTP_Transmit(p_Device, p_Socket, Path, ContentType, Header, NULL, Reader, p_ReaderArg, Chunks, Length, p_ResponseCode, Writer, p_WriterArg, p_ResponseLength);
+
+    free(Chunks);
+
+    return Error;
+}
+
+SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, const void* p_Buffer, uint32_t Length, uint16_t* p_ResponseCode)
+{
+    if((p_Socket == NULL) || ((p_Buffer == NULL) && (Length > 0)))
     {
         return SIM70XX_ERR_INVALID_ARG;
     }
@@ -292,68 +387,348 @@ SIM70XX_Error_t SIM7020_HTTP_GET(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_S
     }
     else if(p_Socket->isConnected == false)
     {
-        return SIM70XX_ERR_OK;
+        return SIM70XX_ERR_NOT_CONNECTED;
+    }
+
+    return SIM7020_HTTP_Transmit(p_Device, p_Socket, Path, ContentType, Header, p_Buffer, NULL, NULL, NULL, Length, p_ResponseCode, NULL, NULL, NULL);
+}
+
+SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, const void* p_Buffer, uint32_t Length,
+                                  SIM7020_HTTP_Writer_t Writer, void* p_WriterArg, uint32_t* p_ResponseLength, uint16_t* p_ResponseCode)
+{
+    if((p_Socket == NULL) || (Writer == NULL) || ((p_Buffer == NULL) && (Length > 0)))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+    else if(p_Socket->isConnected == false)
+    {
+        return SIM70XX_ERR_NOT_CONNECTED;
+    }
+
+    return SIM7020_HTTP_Transmit(p_Device, p_Socket, Path, ContentType, Header, p_Buffer, NULL, NULL, NULL, Length, p_ResponseCode, Writer, p_WriterArg, p_ResponseLength);
+}
+
+SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, SIM7020_HTTP_Reader_t Reader, void* p_Arg, uint32_t Length, uint16_t* p_ResponseCode)
+{
+    if((p_Socket == NULL) || (Reader == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+    else if(p_Socket->isConnected == false)
+    {
+        return SIM70XX_ERR_NOT_CONNECTED;
+    }
+
+    return SIM7020_HTTP_TransmitChunks(p_Device, p_Socket, Path, ContentType, Header, Reader, p_Arg, Length, p_ResponseCode, NULL, NULL, NULL);
+}
+
+SIM70XX_Error_t SIM7020_HTTP_POST(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, std::string ContentType, std::string Header, SIM7020_HTTP_Reader_t Reader, void* p_ReaderArg, uint32_t Length,
+                                  SIM7020_HTTP_Writer_t Writer, void* p_WriterArg, uint32_t* p_ResponseLength, uint16_t* p_ResponseCode)
+{
+    if((p_Socket == NULL) || (Reader == NULL) || (Writer == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+    else if(p_Socket->isConnected == false)
+    {
+        return SIM70XX_ERR_NOT_CONNECTED;
+    }
+
+    return SIM7020_HTTP_TransmitChunks(p_Device, p_Socket, Path, ContentType, Header, Reader, p_ReaderArg, Length, p_ResponseCode, Writer, p_WriterArg, p_ResponseLength);
+}
+
+/** @brief Receive buffer object for GET requests with a buffer.
+ */
+typedef struct
+{
+    uint8_t* p_Data;                                /**< Pointer to buffer. */
+    uint32_t Size;                                  /**< Size of the buffer. */
+    uint32_t Length;                                /**< Number of stored bytes. */
+    bool isDynamic;                                 /**< #true when the buffer is increased when it is full. */
+} SIM7020_HTTP_Buffer_t;
+
+/** @brief          Store the content of a HTTP response in a receive buffer.
+ *  @param p_Arg    Pointer to receive buffer object
+ *  @param p_Data   Pointer to content
+ *  @param Length   Content length
+ *  @return         #false when the content doesn´t fit into the buffer
+ */
+static bool SIM7020_HTTP_BufferWriter(void* p_Arg, const uint8_t* p_Data, size_t Length)
+{
+    SIM7020_HTTP_Buffer_t* Buffer = (SIM7020_HTTP_Buffer_t*)p_Arg;
+
+    if((Buffer->Length + Length) > Buffer->Size)
+    {
+        uint32_t Size;
+        uint8_t* p_New;
+
+        if(Buffer->isDynamic == false)
+        {
+            ESP_LOGE(TAG, "Receive buffer too small!");
+
+            return false;
+        }
+
+        // NOTE: The buffer size is doubled to reduce the number of allocations.
+        Size = std::max(2 * Buffer->Size, Buffer->Length + (uint32_t)Length);
+        p_New = (uint8_t*)realloc(Buffer->p_Data, Size);
+        if(p_New == NULL)
+        {
+            ESP_LOGE(TAG, "Can not allocate memory!");
+
+            return false;
+        }
+
+        Buffer->p_Data = p_New;
+        Buffer->Size = Size;
     }
 
-    CommandStr = "AT+CHTTPSEND=" + std::to_string(p_Socket->ID) + "," +
-                                   std::to_string(SIM7020_HTTP_REQ_GET) + "," +
-                                   "\"" + Path + "\"";
+    memcpy(&Buffer->p_Data[Buffer->Length], p_Data, Length);
+    Buffer->Length += Length;
+
+    return true;
+}
+
+/** @brief                  Transmit a HTTP(S) GET request and get the response code.
+ *  @param p_Device         SIM7020 device object
+ *  @param p_Socket         Pointer to HTTP(S) socket object
+ *  @param Path             Request path
+ *  @param p_ResponseCode   (Optional) Pointer to response code
+ *  @return                 SIM70XX_ERR_OK when successful
+ */
+static SIM70XX_Error_t SIM7020_HTTP_Request(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string& Path, uint16_t* p_ResponseCode)
+{
+    uint32_t Value;
+    std::string Response;
+    SIM70XX_TxCmd_t* Command;
+    SIM70XX_Parser_t Parser;
+
+    // Remove the responses of previous requests. The content of the response is read by the caller.
+    SIM70XX_Mailbox_Flush("+CHTTPNMIH", p_Socket->ID);
+    SIM70XX_Mailbox_Flush("+CHTTPNMIC", p_Socket->ID, true);
+
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CHTTPSEND(CommandStr);
+    *Command = SIM7020_AT_CHTTPSEND(p_Socket->ID, SIM7020_HTTP_REQ_GET, Path);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    SIM70XX_Queue_PopItem(Command);
 
     // Get the response from the server.
-    Now = SIM70XX_Tools_GetmsTimer();
-    while(SIM70XX_Queue_isEvent(p_Device.Internal.EventQueue, "+CHTTPNMIH" + std::to_string(p_Socket->ID), &Response) == false)
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Wait("+CHTTPNMIH", p_Socket->ID, &Response, (p_Socket->Timeout * 1000UL) / portTICK_PERIOD_MS));
+
+    // Get the response code. The message has the layout
+    //  +CHTTPNMIH: <ID>,<Response code>,<Header length>,<Header>
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_SkipPrefix(&Parser, "+CHTTPNMIH: ");
+    SIM70XX_Parser_Next(&Parser);
+    SIM70XX_Parser_GetUInt(&Parser, &Value);
+
+    if(Parser.isError)
     {
-        if((SIM70XX_Tools_GetmsTimer() - Now) > (p_Socket->Timeout * 1000UL))
+        return SIM70XX_ERR_FAIL;
+    }
+
+    ESP_LOGI(TAG, "Response code: %u", Value);
+
+    if(p_ResponseCode != NULL)
+    {
+        *p_ResponseCode = Value;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM7020_HTTP_ReadResponse(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, SIM7020_HTTP_Writer_t Writer, void* p_Arg, uint32_t* p_Length)
+{
+    uint32_t Value;
+    uint32_t Received;
+    uint32_t ContentLength;
+    uint32_t PackageLength;
+    bool isAdditionalData;
+    std::string Response;
+    SIM70XX_Parser_t Parser;
+    SIM70XX_Field_t Payload;
+
+    if((p_Socket == NULL) || (Writer == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    Received = 0;
+    ContentLength = 0;
+    do
+    {
+        // Get the next part of the content. The content has the layout
+        //  +CHTTPNMIC: <ID>,<Flag>,<Content length>,<Package length>,<Data>
+        // NOTE: The flag is set when more parts are following.
+        SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Wait("+CHTTPNMIC", p_Socket->ID, &Response, (p_Socket->Timeout * 1000UL) / portTICK_PERIOD_MS));
+
+        SIM70XX_Parser_Init(&Parser, Response);
+        SIM70XX_Parser_SkipPrefix(&Parser, "+CHTTPNMIC: ");
+        SIM70XX_Parser_Next(&Parser);
+        SIM70XX_Parser_GetUInt(&Parser, &Value);
+        isAdditionalData = (bool)Value;
+
+        SIM70XX_Parser_GetUInt(&Parser, &ContentLength);
+        SIM70XX_Parser_GetUInt(&Parser, &PackageLength);
+
+        if(Parser.isError)
+        {
+            return SIM70XX_ERR_FAIL;
+        }
+
+        // Each part must contain the announced number of bytes and all parts together must match the content length.
+        // NOTE: A part is lost when the mailbox was full for too long.
+        SIM70XX_Parser_GetRemaining(&Parser, &Payload);
+        if(Payload.Length != (2 * PackageLength))
+        {
+            ESP_LOGE(TAG, "Invalid package length. Expected: %u / Received: %u", PackageLength, (unsigned int)(Payload.Length / 2));
+
+            return SIM70XX_ERR_FAIL;
+        }
+        else if((Received + PackageLength) > ContentLength)
+        {
+            ESP_LOGE(TAG, "Content exceeds the content length of %u bytes!", ContentLength);
+
+            return SIM70XX_ERR_FAIL;
+        }
+        else if(SIM70XX_Mailbox_GetDropped("+CHTTPNMIC", p_Socket->ID) > 0)
         {
-            return SIM70XX_ERR_TIMEOUT;
+            ESP_LOGE(TAG, "Content parts were dropped!");
+
+            return SIM70XX_ERR_FAIL;
         }
 
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        // Decode the hexadecimal payload string in small blocks and pass the data to the writer.
+        for(size_t Offset = 0; Offset < Payload.Length; )
+        {
+            size_t Length;
+            size_t Position;
+            uint8_t Buffer[64];
+
+            Length = std::min(2 * sizeof(Buffer), Payload.Length - Offset);
+            if(SIM70XX_Tools_HexDecode(&Payload.p_Data[Offset], Length, Buffer, &Position) != SIM70XX_ERR_OK)
+            {
+                ESP_LOGE(TAG, "Invalid payload at position %u!", (unsigned int)(Offset + Position));
+
+                return SIM70XX_ERR_FAIL;
+            }
+
+            if(Writer(p_Arg, Buffer, Length / 2) == false)
+            {
+                return SIM70XX_ERR_FAIL;
+            }
+
+            Offset += Length;
+        }
+
+        Received += Payload.Length / 2;
+
+        ESP_LOGD(TAG, "Received %u bytes. Additional data: %u", Received, (unsigned int)isAdditionalData);
+    } while(isAdditionalData);
+
+    if(Received != ContentLength)
+    {
+        ESP_LOGE(TAG, "Incomplete content. Expected: %u / Received: %u", ContentLength, Received);
+
+        return SIM70XX_ERR_FAIL;
+    }
+
+    if(p_Length != NULL)
+    {
+        *p_Length = Received;
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM7020_HTTP_GET(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, SIM7020_HTTP_Writer_t Writer, void* p_Arg, uint32_t* p_Length, uint16_t* p_ResponseCode)
+{
+    if((p_Socket == NULL) || (Writer == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
     }
+    else if(p_Socket->isConnected == false)
+    {
+        return SIM70XX_ERR_NOT_CONNECTED;
+    }
+
+    SIM70XX_ERROR_CHECK(SIM7020_HTTP_Request(p_Device, p_Socket, Path, p_ResponseCode));
 
-    // Remove the command from the response.
-    Index = Response.find("+CHTTPNMIH: " + std::to_string(p_Socket->ID) + ",");
-    Response.replace(Index, std::string("+CHTTPNMIH: " + std::to_string(p_Socket->ID) + ",").size(), "");
+    return SIM7020_HTTP_ReadResponse(p_Device, p_Socket, Writer, p_Arg, p_Length);
+}
 
-    // Get the response code.
-    ResponseCode = std::stoi(Response.substr(0, Response.find(",")));
+SIM70XX_Error_t SIM7020_HTTP_GET(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, uint8_t* p_Buffer, uint32_t Size, uint32_t* p_Length, uint16_t* p_ResponseCode)
+{
+    SIM70XX_Error_t Error;
+    SIM7020_HTTP_Buffer_t Buffer;
+
+    if((p_Buffer == NULL) || (p_Length == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
 
-    // Remove the header and the command from the response.
-    Index = Response.find("+CHTTPNMIC: " + std::to_string(p_Socket->ID) + ",");
-    Response = Response.substr(Index + std::string("+CHTTPNMIC: " + std::to_string(p_Socket->ID) + ",").size());
+    Buffer.p_Data = p_Buffer;
+    Buffer.Size = Size;
+    Buffer.Length = 0;
+    Buffer.isDynamic = false;
 
-    // Get the additional data flag.
-    // TODO: Must be implemented
-    isAdditionalData = (bool)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
+    Error = SIM7020_HTTP_GET(p_Device, p_Socket, Path, SIM7020_HTTP_BufferWriter, &Buffer, NULL, p_ResponseCode);
+    *p_Length = Buffer.Length;
 
-    // Remove the total length.
-    SIM70XX_Tools_SubstringSplitErase(&Response);
+    return Error;
+}
 
-    // Get the payload length.
-    *p_Length = (uint32_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
+SIM70XX_Error_t SIM7020_HTTP_GET(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket, std::string Path, uint8_t** p_Buffer, uint32_t* p_Length, uint16_t* p_ResponseCode)
+{
+    SIM70XX_Error_t Error;
+    SIM7020_HTTP_Buffer_t Buffer;
 
-    *p_Buffer = (uint8_t*)malloc(*p_Length);
+    if((p_Buffer == NULL) || (p_Length == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
 
-    // Get the hexadecimal payload string.
-    SIM70XX_Tools_Hex2ASCII(Response, *p_Buffer);
+    Buffer.p_Data = NULL;
+    Buffer.Size = 0;
+    Buffer.Length = 0;
+    Buffer.isDynamic = true;
 
-    if(p_ResponseCode != NULL)
+    Error = SIM7020_HTTP_GET(p_Device, p_Socket, Path, SIM7020_HTTP_BufferWriter, &Buffer, NULL, p_ResponseCode);
+    if(Error != SIM70XX_ERR_OK)
     {
-        *p_ResponseCode = ResponseCode;
+        free(Buffer.p_Data);
+
+        return Error;
     }
 
-    ESP_LOGI(TAG, "Response code: %u", ResponseCode);
-    ESP_LOGI(TAG, "Additional data: %u", isAdditionalData);
+    *p_Buffer = Buffer.p_Data;
+    *p_Length = Buffer.Length;
+
     ESP_LOGI(TAG, "Length: %u", *p_Length);
-    ESP_LOGI(TAG, "Response: %s", (char*)p_Buffer);
 
     return SIM70XX_ERR_OK;
 }
@@ -378,11 +753,11 @@ SIM70XX_Error_t SIM7020_HTTP_Disconnect(SIM7020_t& p_Device, SIM7020_HTTP_Socket
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CHTTPDISCON(p_Socket->ID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     // Remove the socket from the list with active sockets.
     for(std::vector<SIM7020_HTTP_Socket_t*>::iterator it = p_Device.HTTP.Sockets.begin(); it != p_Device.HTTP.Sockets.end(); ++it)
@@ -416,11 +791,11 @@ SIM70XX_Error_t SIM7020_HTTP_DestroyAllSockets(SIM7020_t& p_Device )
         SIM70XX_CREATE_CMD(Command);
         *Command = SIM7020_AT_CHTTPDISCON(i);
         SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-        if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+        if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
         {
             return SIM70XX_ERR_FAIL;
         }
-        SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+        SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
     }
 
     return SIM70XX_ERR_OK;
@@ -443,11 +818,16 @@ SIM70XX_Error_t SIM7020_HTTP_Destroy(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t*
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CHTTPDESTROY(p_Socket->ID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response, NULL));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response, NULL));
+
+    // Remove the socket from the list with active sockets. The socket is still in the list when the connection was closed by the remote host.
+    p_Device.HTTP.Sockets.erase(std::remove(p_Device.HTTP.Sockets.begin(), p_Device.HTTP.Sockets.end(), p_Socket), p_Device.HTTP.Sockets.end());
+    p_Socket->isConnected = false;
+    p_Socket->isCreated = false;
 
     ESP_LOGI(TAG, "Socket %u destroyed...", p_Socket->ID);
 
@@ -467,4 +847,214 @@ void SIM7020_HTTP_AddToHeader(std::string Key, std::string Value, std::string* p
     p_Header->append("\n");
 }
 
+/** @brief          Close the connection of a pool entry and release the memory of the entry.
+ *  @param p_Device SIM7020 device object
+ *  @param p_Entry  Pointer to pool entry
+ */
+static void SIM7020_HTTP_PoolClose(SIM7020_t& p_Device, SIM7020_HTTP_Pool_Entry_t* p_Entry)
+{
+    // NOTE: The entry is released even when the module doesn´t respond. Otherwise the pool gets blocked by a broken connection.
+    SIM7020_HTTP_Disconnect(p_Device, &p_Entry->Socket);
+    SIM7020_HTTP_Destroy(p_Device, &p_Entry->Socket);
+
+    // Destroy keeps the socket in the list when the module doesn´t respond. Remove it anyway, because the communication task
+    // must not access the socket after the entry is released.
+    p_Device.HTTP.Sockets.erase(std::remove(p_Device.HTTP.Sockets.begin(), p_Device.HTTP.Sockets.end(), &p_Entry->Socket), p_Device.HTTP.Sockets.end());
+    SIM70XX_Mailbox_Release("+CHTTPNMIH", p_Entry->Socket.ID);
+    SIM70XX_Mailbox_Release("+CHTTPNMIC", p_Entry->Socket.ID);
+
+    delete p_Entry;
+}
+
+SIM70XX_Error_t SIM7020_HTTP_Acquire(SIM7020_t& p_Device, std::string Host, SIM7020_HTTP_Socket_t** p_Socket, uint16_t Timeout)
+{
+    SIM70XX_Error_t Error;
+    SIM7020_HTTP_Pool_Entry_t* Entry;
+
+    if(p_Socket == NULL)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+    else if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    SIM7020_HTTP_Evict(p_Device);
+
+    // The host is stored in lower case letters by the socket.
+    std::for_each(Host.begin(), Host.end(), [](char& c)
+    {
+        c = ::tolower(c);
+    });
+
+    // Search for an unused connection to the same host.
+    Entry = NULL;
+    for(std::vector<SIM7020_HTTP_Pool_Entry_t*>::iterator it = p_Device.HTTP.Pool.begin(); it != p_Device.HTTP.Pool.end(); ++it)
+    {
+        if(((*it)->isUsed == false) && ((*it)->Socket.Host == Host))
+        {
+            Entry = *it;
+
+            // Reconnect the socket when the connection was closed by the remote host.
+            if(Entry->Socket.isConnected == false)
+            {
+                ESP_LOGI(TAG, "Reconnect socket %u...", Entry->Socket.ID);
+
+                if(SIM7020_HTTP_Connect(p_Device, &Entry->Socket, Timeout) != SIM70XX_ERR_OK)
+                {
+                    p_Device.HTTP.Pool.erase(it);
+                    SIM7020_HTTP_PoolClose(p_Device, Entry);
+                    Entry = NULL;
+                }
+            }
+            else
+            {
+                Entry->Socket.Timeout = Timeout;
+            }
+
+            break;
+        }
+    }
+
+    // Open a new connection. The least recently used connection is closed when the pool is full.
+    if(Entry == NULL)
+    {
+        if(p_Device.HTTP.Pool.size() >= CONFIG_SIM70XX_HTTP_POOL_SIZE)
+        {
+            std::vector<SIM7020_HTTP_Pool_Entry_t*>::iterator Oldest = p_Device.HTTP.Pool.end();
+
+            for(std::vector<SIM7020_HTTP_Pool_Entry_t*>::iterator it = p_Device.HTTP.Pool.begin(); it != p_Device.HTTP.Pool.end(); ++it)
+            {
+                if(((*it)->isUsed == false) && ((Oldest == p_Device.HTTP.Pool.end()) || ((long)((*it)->LastUsed - (*Oldest)->LastUsed) < 0)))
+                {
+                    Oldest = it;
+                }
+            }
+
+            if(Oldest == p_Device.HTTP.Pool.end())
+            {
+                ESP_LOGE(TAG, "All pooled sockets are in use!");
+
+                return SIM70XX_ERR_NO_MEM;
+            }
+
+            Entry = *Oldest;
+            p_Device.HTTP.Pool.erase(Oldest);
+            SIM7020_HTTP_PoolClose(p_Device, Entry);
+        }
+
+        Entry = new(std::nothrow) SIM7020_HTTP_Pool_Entry_t();
+        if(Entry == NULL)
+        {
+            return SIM70XX_ERR_NO_MEM;
+        }
+
+        Entry->Socket.Host = Host;
+        Entry->Socket.Timeout = Timeout;
+        Error = SIM7020_HTTP_Create(p_Device, &Entry->Socket);
+        if(Error != SIM70XX_ERR_OK)
+        {
+            delete Entry;
+
+            return Error;
+        }
+
+        Error = SIM7020_HTTP_Connect(p_Device, &Entry->Socket, Timeout);
+        if(Error != SIM70XX_ERR_OK)
+        {
+            SIM7020_HTTP_PoolClose(p_Device, Entry);
+
+            return Error;
+        }
+
+        p_Device.HTTP.Pool.push_back(Entry);
+    }
+
+    Entry->isUsed = true;
+    *p_Socket = &Entry->Socket;
+
+    ESP_LOGD(TAG, "Socket %u acquired...", Entry->Socket.ID);
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM7020_HTTP_Release(SIM7020_t& p_Device, SIM7020_HTTP_Socket_t* p_Socket)
+{
+    if(p_Socket == NULL)
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    for(std::vector<SIM7020_HTTP_Pool_Entry_t*>::iterator it = p_Device.HTTP.Pool.begin(); it != p_Device.HTTP.Pool.end(); ++it)
+    {
+        if(&(*it)->Socket == p_Socket)
+        {
+            (*it)->isUsed = false;
+            (*it)->LastUsed = SIM70XX_Tools_GetmsTimer();
+
+            ESP_LOGD(TAG, "Socket %u released...", p_Socket->ID);
+
+            return SIM70XX_ERR_OK;
+        }
+    }
+
+    return SIM70XX_ERR_INVALID_ARG;
+}
+
+SIM70XX_Error_t SIM7020_HTTP_Evict(SIM7020_t& p_Device)
+{
+    unsigned long Now;
+
+    if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    Now = SIM70XX_Tools_GetmsTimer();
+    for(std::vector<SIM7020_HTTP_Pool_Entry_t*>::iterator it = p_Device.HTTP.Pool.begin(); it != p_Device.HTTP.Pool.end(); )
+    {
+        if(((*it)->isUsed == false) && ((Now - (*it)->LastUsed) >= (CONFIG_SIM70XX_HTTP_POOL_IDLE_TIMEOUT * 1000UL)))
+        {
+            SIM7020_HTTP_Pool_Entry_t* Entry = *it;
+
+            ESP_LOGI(TAG, "Close idle socket %u...", Entry->Socket.ID);
+
+            it = p_Device.HTTP.Pool.erase(it);
+            SIM7020_HTTP_PoolClose(p_Device, Entry);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+SIM70XX_Error_t SIM7020_HTTP_ClosePool(SIM7020_t& p_Device)
+{
+    if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    for(std::vector<SIM7020_HTTP_Pool_Entry_t*>::iterator it = p_Device.HTTP.Pool.begin(); it != p_Device.HTTP.Pool.end(); )
+    {
+        if((*it)->isUsed == false)
+        {
+            SIM7020_HTTP_Pool_Entry_t* Entry = *it;
+
+            it = p_Device.HTTP.Pool.erase(it);
+            SIM7020_HTTP_PoolClose(p_Device, Entry);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
 #endif
\ No newline at end of file
@@ -25,7 +25,9 @@
 
 #include "sim7020.h"
 #include "sim7020_mqtt.h"
+#include "../Events/sim7020_evt.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Events/sim70xx_urc.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7020_MQTT";
@@ -49,7 +51,6 @@ SIM70XX_Error_t SIM7020_MQTT_Create(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t*
 SIM70XX_Error_t SIM7020_MQTT_Create(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t* p_Socket)
 {
     std::string Response;
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if((p_Socket == NULL) || (p_Socket->Timeout > 60000) || (p_Socket->BufferSize < 20) || (p_Socket->BufferSize > 1132) || (p_Socket->Broker.size() > 50) || (p_Socket->CID > 10))
@@ -61,15 +62,18 @@ SIM70XX_Error_t SIM7020_MQTT_Create(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t*
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    CommandStr = "AT+CMQNEW=\"" + p_Socket->Broker + "\"," + "\"" + std::to_string(p_Socket->Port) + "\"," + std::to_string(p_Socket->Timeout) + "," + std::to_string(p_Socket->BufferSize) + "," + std::to_string(p_Socket->CID);
+    // Register the URC handlers of the module.
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("+CMQPUB", SIM7020_Evt_on_MQTT_Pub));
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("+CMQDISCON", SIM7020_Evt_on_MQTT_Disconnect));
+
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CMQNEW(CommandStr);
+    *Command = SIM7020_AT_CMQNEW(p_Socket->Broker, p_Socket->Port, p_Socket->Timeout, p_Socket->BufferSize, p_Socket->CID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Socket->ID = (uint8_t)std::stoi(Response);
 
@@ -102,11 +106,10 @@ SIM70XX_Error_t SIM7020_MQTT_Connect(SIM7020_t& p_Device, std::string Client, SI
 SIM70XX_Error_t SIM7020_MQTT_Connect(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t* p_Socket)
 {
     std::string Response;
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if((p_Socket == NULL) || (p_Socket->Version < SIM7020_MQTT_31) || (p_Socket->Version > SIM7020_MQTT_311) || (p_Socket->ClientID.size() == 0) || (p_Socket->ClientID.size() > 120) || (p_Socket->KeepAlive > 64800) || 
-        (p_Socket->WillFlag && ((p_Socket->LastWill.Topic.size() == 0) || (p_Socket->LastWill.Message.size() == 0))) || ((p_Socket->Username.size() > 100) && (p_Socket->Passwort.size() > 100)))
+        (p_Socket->WillFlag && ((p_Socket->p_LastWill == NULL) || (p_Socket->p_LastWill->Topic.size() == 0) || (p_Socket->p_LastWill->Message.size() == 0))) || ((p_Socket->Username.size() > 100) && (p_Socket->Password.size() > 100)))
     {
         return SIM70XX_ERR_INVALID_ARG;
     }
@@ -123,27 +126,23 @@ SIM70XX_Error_t SIM7020_MQTT_Connect(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t*
         return SIM70XX_ERR_OK;
     }
 
-    CommandStr = "AT+CMQCON=" + std::to_string(p_Socket->ID) + "," + std::to_string(p_Socket->Version) + ",\"" + p_Socket->ClientID + "\"," + std::to_string(p_Socket->KeepAlive) + "," + std::to_string(p_Socket->CleanSession) + ","  + std::to_string(p_Socket->WillFlag);
+    // TODO: Add the will options when the will flag is set.
 
-    if(p_Socket->WillFlag)
+    SIM70XX_CREATE_CMD(Command);
+    if((p_Socket->Username.size() > 0) && (p_Socket->Password.size() > 0))
     {
-        // TODO
-        CommandStr += "";
+        *Command = SIM7020_AT_CMQCON_AUTH(p_Socket->ID, p_Socket->Version, p_Socket->ClientID, p_Socket->KeepAlive, p_Socket->CleanSession, p_Socket->WillFlag, p_Socket->Username, p_Socket->Password);
     }
-
-    if((p_Socket->Username.size() > 0) && (p_Socket->Passwort.size() > 0))
+    else
     {
-        CommandStr += ",\"" + p_Socket->Username + "\",\"" + p_Socket->Passwort + "\"";
+        *Command = SIM7020_AT_CMQCON(p_Socket->ID, p_Socket->Version, p_Socket->ClientID, p_Socket->KeepAlive, p_Socket->CleanSession, p_Socket->WillFlag);
     }
-
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CMQCON(CommandStr);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     p_Socket->isConnected = true;
     p_Device.MQTT.Sockets.push_back(p_Socket);
@@ -158,9 +157,6 @@ SIM70XX_Error_t SIM7020_MQTT_Publish(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t*
 
 SIM70XX_Error_t SIM7020_MQTT_Publish(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t* p_Socket, std::string Topic, SIM7020_MQTT_QoS_t QoS, const void* p_Buffer, uint32_t Length, bool Retained, bool Dup)
 {
-    std::string Buffer_Hex;
-    std::string Response;
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if((p_Socket == NULL) || (p_Buffer == NULL) || (Topic.size() > 128) || (QoS < SIM7020_MQTT_QOS_0) || (QoS > SIM7020_MQTT_QOS_2) || (Length < 2) || (Length > 1000))
@@ -176,17 +172,17 @@ SIM70XX_Error_t SIM7020_MQTT_Publish(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t*
         return SIM70XX_ERR_NOT_CONNECTED;
     }
 
-    SIM70XX_Tools_ASCII2Hex(p_Buffer, Length, &Buffer_Hex);
-    CommandStr = "AT+CMQPUB=" + std::to_string(p_Socket->ID) + ",\"" + Topic + "\"," + std::to_string(1) + "," + std::to_string(Retained) + "," + std::to_string(Dup) + "," + std::to_string(Length * 2) + ",\"" + Buffer_Hex + "\"";
+    // NOTE: The data are converted into a hex string during the transmission.
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CMQCON(CommandStr);
+    *Command = SIM7020_AT_CMQPUB(p_Socket->ID, Topic, 1, Retained, Dup, Length * 2);
+    SIM70XX_Queue_SetPayload(Command, p_Buffer, Length, SIM70XX_ENC_HEX, "\"");
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7020_MQTT_Subscribe(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t* p_Socket, std::string Topic, SIM7020_MQTT_QoS_t QoS)
@@ -210,11 +206,11 @@ SIM70XX_Error_t SIM7020_MQTT_Subscribe(SIM7020_t& p_Device, SIM7020_MQTT_Socket_
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CMQSUB(p_Socket->ID, Topic, QoS);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     if(p_Device.MQTT.SubQueue == NULL)
     {
@@ -275,11 +271,11 @@ SIM70XX_Error_t SIM7020_MQTT_Unsubscribe(SIM7020_t& p_Device, SIM7020_MQTT_Socke
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CMQUNSUB(p_Socket->ID, Topic);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     if(p_Device.MQTT.SubTopics > 0)
     {
@@ -320,11 +316,11 @@ SIM70XX_Error_t SIM7020_MQTT_Destroy(SIM7020_t& p_Device, SIM7020_MQTT_Socket_t*
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CMQDISCON(p_Socket->ID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     p_Device.MQTT.SubTopics = 0;
     p_Socket->isConnected = false;
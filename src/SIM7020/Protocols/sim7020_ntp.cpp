@@ -53,18 +53,18 @@ SIM70XX_Error_t SIM7020_NTP_GetNetworkTime(SIM7020_t& p_Device, std::string Serv
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CSNTPSTOP;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout);
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout);
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     // Start a new request.
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CSNTPSTART(Server, Zone);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     // TODO: Wait for the time response
 
@@ -72,9 +72,9 @@ SIM70XX_Error_t SIM7020_NTP_GetNetworkTime(SIM7020_t& p_Device, std::string Serv
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CSNTPSTOP;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout);
+    SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout);
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 #endif
\ No newline at end of file
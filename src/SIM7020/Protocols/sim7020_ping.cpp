@@ -28,6 +28,8 @@
 #include "sim7020.h"
 #include "sim7020_tcpip.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Events/sim70xx_mailbox.h"
+#include "../../Private/Parser/sim70xx_parser.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7020_TCPIP";
@@ -37,7 +39,6 @@ SIM70XX_Error_t SIM7020_TCP_Ping(SIM7020_t& p_Device, SIM7020_Ping_t& p_Config,
     uint8_t Pings;
     std::string Status;
     std::string Response;
-    std::string CommandStr;
     SIM70XX_Error_t Error = SIM70XX_ERR_OK;
     SIM70XX_TxCmd_t* Command;
 
@@ -79,55 +80,62 @@ SIM70XX_Error_t SIM7020_TCP_Ping(SIM7020_t& p_Device, SIM7020_Ping_t& p_Config,
 
     // TODO: Copy implementation from SIM7080?
 
-    CommandStr = "AT+CIPPING=\"" + p_Config.Host + "\"," + std::to_string(p_Config.Retries) + "," + std::to_string(p_Config.DataLength) + "," + std::to_string(p_Config.Timeout);
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Register("+CIPPING", false));
+    SIM70XX_Mailbox_Flush("+CIPPING", SIM70XX_MAILBOX_NO_ID);
+
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CIPPING(CommandStr);
+    *Command = SIM7020_AT_CIPPING(p_Config.Host, p_Config.Retries, p_Config.DataLength, p_Config.Timeout);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     Pings = 0;
     do
     {
-        // Wait for a ping response.
-        if(SIM70XX_Queue_isEvent(p_Device.Internal.EventQueue, "+CIPPING", &Response))
-        {
-            do
-            {
-                std::string Temp;
-                SIM7020_PingRes_t Result;
+        uint32_t Value;
+        SIM7020_PingRes_t Result;
+        SIM70XX_Parser_t Parser;
 
-                Temp = SIM70XX_Tools_SubstringSplitErase(&Response);
-                SIMXX_TOOLS_REMOVE_LINEEND(Temp);
+        // Wait for a ping response. The response has the layout
+        //  +CIPPING: <Reply ID>,<IP address>,<Reply time>,<TTL>
+        SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Wait("+CIPPING", SIM70XX_MAILBOX_NO_ID, &Response, portMAX_DELAY));
 
-                Temp.replace(Temp.find("+CIPPING: "), std::string("+CIPPING: ").size(), "");
+        SIM70XX_Parser_Init(&Parser, Response);
+        SIM70XX_Parser_SkipPrefix(&Parser, "+CIPPING: ");
 
-                // Filter out the reply ID.
-                SIM70XX_Tools_SubstringSplitErase(&Temp);
+        // Filter out the reply ID.
+        SIM70XX_Parser_Next(&Parser);
 
-                // Filter out the IP address.
-                Result.IP =  SIM70XX_Tools_SubstringSplitErase(&Temp);
+        // Filter out the IP address.
+        SIM70XX_Parser_GetString(&Parser, &Result.IP);
 
-                // Filter out the reply time.
-                Result.ReplyTime = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Temp));
+        // Filter out the reply time.
+        SIM70XX_Parser_GetUInt(&Parser, &Value);
+        Result.ReplyTime = Value;
 
-                // Filter out the time to live.
-                Result.TTL = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Temp));
+        // Filter out the time to live.
+        SIM70XX_Parser_GetUInt(&Parser, &Value);
+        Result.TTL = Value;
 
-                p_Result->push_back(Result);
-
-                Pings++;
+        if(Parser.isError)
+        {
+            ESP_LOGE(TAG, "Invalid ping response: %s", Response.c_str());
 
-                ESP_LOGD(TAG, "Ping %u / %u", Pings, p_Config.Retries);
-                ESP_LOGD(TAG, "     Response: %s", Response.c_str());
-            } while(Response.find("+CIPPING") != std::string::npos);
+            Error = SIM70XX_ERR_FAIL;
         }
+        else
+        {
+            p_Result->push_back(Result);
+        }
+
+        Pings++;
 
-        vTaskDelay(100 / portTICK_PERIOD_MS);
-    } while(Pings != p_Config.Retries);
+        ESP_LOGD(TAG, "Ping %u / %u", Pings, p_Config.Retries);
+        ESP_LOGD(TAG, "     Response: %s", Response.c_str());
+    } while(Pings < p_Config.Retries);
 
     return Error;
 }
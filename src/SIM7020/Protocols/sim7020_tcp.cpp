@@ -25,7 +25,9 @@
 
 #include "sim7020.h"
 #include "sim7020_tcpip.h"
+#include "../Events/sim7020_evt.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Events/sim70xx_urc.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7020_TCPIP";
@@ -33,7 +35,6 @@ static const char* TAG = "SIM7020_TCPIP";
 SIM70XX_Error_t SIM7020_TCP_Create(SIM7020_t& p_Device, std::string IP, uint16_t Port, SIM7020_TCP_Socket_t* p_Socket, uint16_t Timeout, uint8_t CID, SIM7020_TCP_Domain_t Domain, SIM7020_TCP_Protocol_t Protocol)
 {
     std::string Response;
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Socket == NULL)
@@ -45,6 +46,9 @@ SIM70XX_Error_t SIM7020_TCP_Create(SIM7020_t& p_Device, std::string IP, uint16_t
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
+    // Register the URC handlers of the module.
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("+CSOERR", SIM7020_Evt_on_TCP_Disconnect));
+
     p_Socket->IP = IP;
     p_Socket->Port = Port;
     p_Socket->Timeout = Timeout;
@@ -53,15 +57,14 @@ SIM70XX_Error_t SIM7020_TCP_Create(SIM7020_t& p_Device, std::string IP, uint16_t
     p_Socket->Type = SIM7020_TCP_TYPE_TCP;
     p_Socket->Protocol = Protocol;
 
-    CommandStr = "AT+CSOC=" + std::to_string(p_Socket->Domain) + "," + std::to_string(p_Socket->Type) + "," + std::to_string(p_Socket->CID);
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CSOC(CommandStr);
+    *Command = SIM7020_AT_CSOC(p_Socket->Domain, p_Socket->Type, p_Socket->CID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Socket->ID = (uint8_t)std::stoi(Response);
 
@@ -100,11 +103,11 @@ SIM70XX_Error_t SIM7020_TCP_Connect(SIM7020_t& p_Device, SIM7020_TCP_Socket_t* p
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CSOCON(p_Socket->ID, p_Socket->Port, p_Socket->IP);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, p_Socket->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Socket->isConnected = true;
 
@@ -113,10 +116,9 @@ SIM70XX_Error_t SIM7020_TCP_Connect(SIM7020_t& p_Device, SIM7020_TCP_Socket_t* p
 
 SIM70XX_Error_t SIM7020_TCP_TransmitBytes(SIM7020_t& p_Device, SIM7020_TCP_Socket_t* p_Socket, const void* p_Buffer, uint16_t Length)
 {
-    std::string Buffer_Hex;
     SIM70XX_TxCmd_t* Command;
 
-    if((p_Socket == NULL) || (Length > 512) || (p_Socket->Type != SIM7020_TCP_TYPE_TCP))
+    if((p_Socket == NULL) || ((p_Buffer == NULL) && (Length > 0)) || (Length > 512) || (p_Socket->Type != SIM7020_TCP_TYPE_TCP))
     {
         return SIM70XX_ERR_INVALID_ARG;
     }
@@ -133,17 +135,17 @@ SIM70XX_Error_t SIM7020_TCP_TransmitBytes(SIM7020_t& p_Device, SIM7020_TCP_Socke
         return SIM70XX_ERR_NOT_CONNECTED;
     }
 
-    SIM70XX_Tools_ASCII2Hex(p_Buffer, Length, &Buffer_Hex);
-
+    // NOTE: The data are converted into a hex string during the transmission.
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CCSOSEND_BYTES(p_Socket->ID, Length, Buffer_Hex);
+    *Command = SIM7020_AT_CCSOSEND_BYTES(p_Socket->ID, Length);
+    SIM70XX_Queue_SetPayload(Command, p_Buffer, Length, SIM70XX_ENC_HEX);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7020_TCP_TransmitString(SIM7020_t& p_Device, SIM7020_TCP_Socket_t* p_Socket, std::string Data)
@@ -168,14 +170,15 @@ SIM70XX_Error_t SIM7020_TCP_TransmitString(SIM7020_t& p_Device, SIM7020_TCP_Sock
     }
 
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_CCSOSEND_STRING(p_Socket->ID, Data);
+    *Command = SIM7020_AT_CCSOSEND_STRING(p_Socket->ID);
+    SIM70XX_Queue_SetPayload(Command, Data.c_str(), Data.size(), SIM70XX_ENC_RAW, "\"");
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);   
+    return SIM70XX_Queue_PopItem(Command);   
 }
 
 SIM70XX_Error_t SIM7020_TCP_Destroy(SIM7020_t& p_Device, SIM7020_TCP_Socket_t* p_Socket)
@@ -202,11 +205,11 @@ SIM70XX_Error_t SIM7020_TCP_Destroy(SIM7020_t& p_Device, SIM7020_TCP_Socket_t* p
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CSOCL(p_Socket->ID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     // TODO: Remove socket from list
 
@@ -25,7 +25,12 @@
 
 #include "sim7020.h"
 #include "../Private/UART/sim70xx_uart.h"
+#include "../Private/UART/sim70xx_baud.h"
+#include "../Private/Port/sim70xx_port.h"
+#include "Events/sim7020_evt.h"
 #include "../Private/Events/sim70xx_evt.h"
+#include "../Private/Events/sim70xx_urc.h"
+#include "../Private/Events/sim70xx_mailbox.h"
 #include "../Private/Queue/sim70xx_queue.h"
 #include "../Private/Commands/sim70xx_commands.h"
 
@@ -58,29 +63,38 @@ SIM70XX_Error_t SIM7020_Init(SIM7020_t& p_Device, SIM7020_Config_t& p_Config, SI
 SIM70XX_Error_t SIM7020_Init(SIM7020_t& p_Device, SIM7020_Config_t& p_Config, uint32_t Timeout, SIM70XX_Baud_t Old)
 {
     std::string Response;
+    SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized)
     {
         SIM7020_Deinit(p_Device);
     }
 
-    p_Device.Internal.RxQueue = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(SIM70XX_CmdResp_t*));
-    p_Device.Internal.TxQueue = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(SIM70XX_TxCmd_t*));
-    p_Device.Internal.EventQueue = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(std::string*));
-    if((p_Device.Internal.RxQueue == NULL) || (p_Device.Internal.TxQueue == NULL) || (p_Device.Internal.EventQueue == NULL))
-    {
-        return SIM70XX_ERR_NO_MEM;
-    }
+    SIM70XX_Queue_Init();
+    SIM70XX_Mailbox_Init();
+
+    // Register the URC handlers of the device. The protocol modules register their handlers when a socket is created.
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("NORMAL POWER DOWN", SIM7020_Evt_on_PowerDown));
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("ENTER PSM", SIM7020_Evt_on_PSM_Enter));
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("EXIT PSM", SIM7020_Evt_on_PSM_Exit));
+
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_Create(&p_Device.Internal.TxQueue));
 
     p_Device.UART.Interface = p_Config.UART.Interface;
     p_Device.UART.Rx = p_Config.UART.Rx;
     p_Device.UART.Tx = p_Config.UART.Tx;
+    p_Device.UART.Rts = p_Config.UART.Rts;
+    p_Device.UART.Cts = p_Config.UART.Cts;
+    p_Device.UART.isFlowControl = p_Config.UART.isFlowControl;
     p_Device.UART.Baudrate = p_Config.UART.Baudrate;
 
-    SIM70XX_ERROR_CHECK(SIM70XX_UART_Init(p_Device.UART));
+    // Start with the default baudrate of the module when the baudrate should be selected automatically.
+    if(p_Device.UART.Baudrate == SIM_BAUD_AUTO)
+    {
+        p_Device.UART.Baudrate = SIM_BAUD_115200;
+    }
 
-    // Get all remaining available data to clear the Rx buffer.
-    SIM70XX_UART_Flush(p_Device.UART);
+    SIM70XX_ERROR_CHECK(SIM70XX_UART_Init(p_Device.UART));
 
     // No receive task started yet. Start the receive task.
     SIM70XX_ERROR_CHECK(SIM70XX_Evt_StartTask(&p_Device.Internal.TaskHandle, &p_Device));
@@ -93,30 +107,74 @@ SIM70XX_Error_t SIM7020_Init(SIM7020_t& p_Device, SIM7020_Config_t& p_Config, ui
         SIM70XX_Error_t Error;
         ESP_LOGI(TAG, "Changing baudrate...");
 
-        p_Device.Internal.isInitialized = true;
         Error = SIM7020_SetBaudrate(p_Device, Old, p_Config.UART.Baudrate);
-        p_Device.Internal.isInitialized = false;
         if(Error != SIM70XX_ERR_OK)
         {
             return Error;
         }
     }
+    else if(p_Config.UART.Baudrate == SIM_BAUD_AUTO)
+    {
+        ESP_LOGI(TAG, "Select baudrate...");
+
+        SIM70XX_ERROR_CHECK(SIM70XX_Baud_Auto(&p_Device));
+    }
 
 	#ifdef CONFIG_SIM70XX_RESET_USE_HW
         p_Device.Interface.Reset_Conf.Inverted = p_Config.Interface.Reset_Conf.Inverted;
         p_Device.Interface.Reset_Conf.Pin = p_Config.Interface.Reset_Conf.Pin;
 		if(p_Device.Interface.Reset_Conf.Pin != GPIO_NUM_NC)
 		{
-		    gpio_set_direction(p_Device.Interface.Reset_Conf.Pin, GPIO_MODE_OUTPUT);
+		    SIM70XX_Port_GPIO_Config(p_Device.Interface.Reset_Conf.Pin, true, false, false);
 		    SIM7020_HardReset(p_Device);
 		}
     #else
         SIM70XX_ERROR_CHECK(SIM7020_SoftReset(p_Device, Timeout));
 	#endif
 
-    vTaskSuspend(p_Device.Internal.TaskHandle);
-    SIM70XX_Tools_DisableEcho(p_Device.UART);
-    vTaskResume(p_Device.Internal.TaskHandle);
+    // Disable the command echo.
+    SIM70XX_CREATE_CMD(Command);
+    *Command = SIM70XX_AT_ATE0;
+    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
+
+    // Enable the RTS/CTS flow control of the module first and then the flow control of the ESP32.
+    // NOTE: The setting of the module is not stored and must be set again after each reset.
+    if(p_Device.UART.isFlowControl)
+    {
+        SIM70XX_Error_t Error;
+
+        SIM70XX_CREATE_CMD(Command);
+        *Command = SIM70XX_AT_IFC(2, 2);
+        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+        if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
+        {
+            return SIM70XX_ERR_FAIL;
+        }
+        SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
+
+        // Disable the flow control of the module again when the flow control of the ESP32 can not be enabled. Otherwise the module
+        // stops the transmission, because the RTS signal is never set by the ESP32.
+        Error = SIM70XX_UART_SetFlowControl(p_Device.UART, true);
+        if(Error != SIM70XX_ERR_OK)
+        {
+            ESP_LOGE(TAG, "Can not enable the flow control! Disable the flow control of the module...");
+
+            SIM70XX_CREATE_CMD(Command);
+            *Command = SIM70XX_AT_IFC(0, 0);
+            SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+            if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
+            {
+                SIM70XX_Queue_PopItem(Command);
+            }
+
+            return Error;
+        }
+    }
 
     SIM70XX_ERROR_CHECK(SIM7020_Ping(p_Device));
     SIM70XX_ERROR_CHECK(SIM7020_GetFunctionality(p_Device))
@@ -152,11 +210,11 @@ void SIM7020_Deinit(SIM7020_t& p_Device)
     vTaskSuspend(p_Device.Internal.TaskHandle);
     vTaskDelete(p_Device.Internal.TaskHandle);
     p_Device.Internal.TaskHandle = NULL;
+    p_Device.UART.Consumer = NULL;
 
     // Delete the queues.
-    vQueueDelete(p_Device.Internal.RxQueue);
-    vQueueDelete(p_Device.Internal.TxQueue);
-    vQueueDelete(p_Device.Internal.EventQueue);
+    SIM70XX_Queue_Delete(&p_Device.Internal.TxQueue);
+    vQueueDelete(p_Device.Internal.QueueSet);
 
     // TODO: Shutdown modem
 
@@ -171,9 +229,9 @@ void SIM7020_Deinit(SIM7020_t& p_Device)
 		{
 			if(p_Device.Interface.Reset_Conf.Inverted)
 			{
-				gpio_set_level(p_Device.Interface.Reset_Conf.Pin, true);
+				SIM70XX_Port_GPIO_SetLevel(p_Device.Interface.Reset_Conf.Pin, true);
 				vTaskDelay(1000 / portTICK_PERIOD_MS);
-				gpio_set_level(p_Device.Interface.Reset_Conf.Pin, false);
+				SIM70XX_Port_GPIO_SetLevel(p_Device.Interface.Reset_Conf.Pin, false);
 			}
 		}
 	}
@@ -182,39 +240,29 @@ void SIM7020_Deinit(SIM7020_t& p_Device)
 SIM70XX_Error_t SIM7020_SoftReset(SIM7020_t& p_Device, uint32_t Timeout)
 {
     uint32_t Now;
-    std::string Response;
 
     if(p_Device.Internal.isInitialized == false)
     {
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    if(p_Device.Internal.TaskHandle != NULL)
-    {
-        vTaskSuspend(p_Device.Internal.TaskHandle);
-    }
-
     ESP_LOGI(TAG, "Performing soft reset...");
     Now = SIM70XX_Tools_GetmsTimer();
     do
     {
+        SIM70XX_TxCmd_t* Command;
+
         // Reset the module.
         // NOTE: Echo mode is enabled after a reset!
-        SIM70XX_UART_SendCommand(p_Device.UART, "ATZ");
-        Response = SIM70XX_UART_ReadStringUntil(p_Device.UART);
-        Response = SIM70XX_UART_ReadStringUntil(p_Device.UART);
-        ESP_LOGI(TAG, "Response: %s", Response.c_str());
+        SIM70XX_CREATE_CMD(Command);
+        *Command = SIM70XX_AT_ATZ;
+        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
 
         // Check if the reset was successful.
-        if(Response.find("OK") != std::string::npos)
+        if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) && (SIM70XX_Queue_PopItem(Command) == SIM70XX_ERR_OK))
         {
             ESP_LOGI(TAG, "     Software reset successful!");
 
-            if(p_Device.Internal.TaskHandle != NULL)
-            {
-                vTaskResume(p_Device.Internal.TaskHandle);
-            }
-
             return SIM70XX_ERR_OK;
         }
 
@@ -223,11 +271,6 @@ SIM70XX_Error_t SIM7020_SoftReset(SIM7020_t& p_Device, uint32_t Timeout)
 
     ESP_LOGE(TAG, "     Software reset timeout!");
 
-    if(p_Device.Internal.TaskHandle != NULL)
-    {
-        vTaskResume(p_Device.Internal.TaskHandle);
-    }
-
     return SIM70XX_ERR_FAIL;
 }
 
@@ -245,7 +288,8 @@ SIM70XX_Error_t SIM7080_IP_ManualAPN(SIM7020_t& p_Device, SIM70XX_APN_t APN, uin
 
 SIM70XX_Error_t SIM7020_SetPSD(SIM7020_t& p_Device, SIM7020_PDP_Type_t PDP, SIM70XX_APN_t APN)
 {
-    std::string CommandStr;
+    const char* TypeStr;
+    std::string Status;
     SIM70XX_TxCmd_t* Command;
     SIM70XX_Error_t Error;
 
@@ -254,41 +298,47 @@ SIM70XX_Error_t SIM7020_SetPSD(SIM7020_t& p_Device, SIM7020_PDP_Type_t PDP, SIM7
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    SIM70XX_ERROR_CHECK(SIM7020_SetFunctionality(p_Device, SIM7020_FUNC_MIN));
-
     if(PDP == SIM7020_PDP_IP)
     {
-        CommandStr = "AT*MCGDEFCONT=\"IP\",\"" + APN.Name + "\"";
+        TypeStr = "IP";
     }
     else if(PDP == SIM7020_PDP_IPV6)
     {
-        CommandStr = "AT*MCGDEFCONT=\"IPV6\",\"" + APN.Name + "\"";
+        TypeStr = "IPV6";
     }
     else if(PDP == SIM7020_PDP_IPV4V6)
     {
-        CommandStr = "AT*MCGDEFCONT=\"IPV4V6\",\"" + APN.Name + "\"";
+        TypeStr = "IPV4V6";
     }
     else if(PDP == SIM7020_PDP_NO_IP)
     {
-        CommandStr = "AT*MCGDEFCONT=\"Non-IP\",\"" + APN.Name + "\"";
+        TypeStr = "Non-IP";
     }
-
-    if((APN.Username.size() > 0) && (APN.Password.size() > 0))
+    else
     {
-        CommandStr += ",\"" + APN.Username + "\",\"" + APN.Password + "\"";
+        return SIM70XX_ERR_INVALID_ARG;
     }
 
+    SIM70XX_ERROR_CHECK(SIM7020_SetFunctionality(p_Device, SIM7020_FUNC_MIN));
+
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_MCGDEFCONT(CommandStr);
+    if((APN.Username.size() > 0) && (APN.Password.size() > 0))
+    {
+        *Command = SIM7020_AT_MCGDEFCONT_AUTH(TypeStr, APN.Name, APN.Username, APN.Password);
+    }
+    else
+    {
+        *Command = SIM7020_AT_MCGDEFCONT(TypeStr, APN.Name);
+    }
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
     // NOTE: We can not use the error macro here because Response and Status are swapped.
-    Error = SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, NULL, &CommandStr);
-    if(CommandStr.find("OK") == std::string::npos)
+    Error = SIM70XX_Queue_PopItem(Command, NULL, &Status);
+    if(Status.find("OK") == std::string::npos)
     {
         return Error;
     }
@@ -300,7 +350,6 @@ SIM70XX_Error_t SIM7020_SetPSD(SIM7020_t& p_Device, SIM7020_PDP_Type_t PDP, SIM7
 
 SIM70XX_Error_t SIM7020_SetOperator(SIM7020_t& p_Device, SIM70XX_OpMode_t Mode, SIM70XX_OpForm_t Format, std::string Operator)
 {
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -308,22 +357,22 @@ SIM70XX_Error_t SIM7020_SetOperator(SIM7020_t& p_Device, SIM70XX_OpMode_t Mode,
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    CommandStr = "AT+COPS=" + std::to_string(Mode);
-
+    SIM70XX_CREATE_CMD(Command);
     if((Mode == SIM_MODE_MANUAL) || (Mode == SIM_MODE_BOTH))
     {
-        CommandStr += "," + std::to_string(Format) + ",\"" + Operator + "\"" + "," + std::to_string(SIM7020_ACT_NB_IOT);
+        *Command = SIM7020_AT_COPS_W_OPERATOR(Mode, Format, Operator, SIM7020_ACT_NB_IOT);
+    }
+    else
+    {
+        *Command = SIM7020_AT_COPS_W(Mode);
     }
-
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_COPS_W(CommandStr);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7020_GetOperator(SIM7020_t& p_Device, std::vector<SIM70XX_Operator_t>* p_Operator, std::string* p_Modes, std::string* p_Formats)
@@ -442,11 +491,11 @@ SIM70XX_Error_t SIM7020_SetBand(SIM7020_t& p_Device, SIM7020_Band_t Band)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CBAND_W(Band);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     return SIM70XX_ERR_OK;
 }
@@ -472,11 +521,11 @@ SIM70XX_Error_t SIM7020_GetBand(SIM7020_t& p_Device, SIM7020_Band_t* p_Band)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CBAND_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     *p_Band = (SIM7020_Band_t)std::stoi(Response);
 
@@ -504,13 +553,13 @@ SIM70XX_Error_t SIM7020_SetFunctionality(SIM7020_t& p_Device, SIM7020_Func_t Fun
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CFUN_W(Func, Reset);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
     // NOTE: Do not use the error macro, because the response and status depends on the current state of the device.
-    Error = SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response, &Status);
+    Error = SIM70XX_Queue_PopItem(Command, &Response, &Status);
 
     // Device is in minimum functionality -> Transition into another functionality
     //  Response = OK
@@ -559,11 +608,11 @@ SIM70XX_Error_t SIM7020_GetFunctionality(SIM7020_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CFUN_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Device.Connection.Functionality = (SIM7020_Func_t)std::stoi(Response);
 
@@ -589,11 +638,11 @@ SIM70XX_Error_t SIM7020_GetSIMStatus(SIM7020_t& p_Device, SIM7020_SIM_t* const p
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CPIN_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return false;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     if(Response.find("READY") != std::string::npos)
     {
@@ -636,12 +685,12 @@ SIM70XX_Error_t SIM7020_Ping(SIM7020_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_NOT_READY;
     }
 
-    if(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue) != SIM70XX_ERR_OK)
+    if(SIM70XX_Queue_PopItem(Command) != SIM70XX_ERR_OK)
     {
         return SIM70XX_ERR_NOT_READY;
     }
@@ -663,47 +712,52 @@ SIM70XX_Error_t SIM7020_SetBaudrate(SIM7020_t& p_Device, SIM70XX_Baud_t Old, SIM
         return SIM70XX_ERR_OK;
     }
 
-    // Initialize the serial interface with the old baudrate.
-    vTaskSuspend(p_Device.Internal.TaskHandle);
-    p_Device.UART.Baudrate = Old;
-    SIM70XX_ERROR_CHECK(SIM70XX_UART_Deinit(p_Device.UART));
-    SIM70XX_ERROR_CHECK(SIM70XX_UART_Init(p_Device.UART));
-    vTaskResume(p_Device.Internal.TaskHandle);
+    // Switch the serial interface to the old baudrate.
+    // NOTE: The UART driver must not be reinstalled, because the event queue is used by the communication task.
+    SIM70XX_ERROR_CHECK(SIM70XX_UART_SetBaudrate(p_Device.UART, Old));
 
     // Set the new baudrate.
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_IPR_W(New);
+    *Command = SIM70XX_AT_IPR_W(New);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_NOT_READY;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Status));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Status));
 
     if(Status.find("OK") == std::string::npos)
     {
         ESP_LOGE(TAG, "Can not enable new baudrate!");
 
         // Switch back to the old baudrate.
-        vTaskSuspend(p_Device.Internal.TaskHandle);
-        p_Device.UART.Baudrate = Old;
-        SIM70XX_ERROR_CHECK(SIM70XX_UART_Deinit(p_Device.UART));
-        SIM70XX_ERROR_CHECK(SIM70XX_UART_Init(p_Device.UART));
-        vTaskResume(p_Device.Internal.TaskHandle);
+        SIM70XX_ERROR_CHECK(SIM70XX_UART_SetBaudrate(p_Device.UART, Old));
 
         return SIM70XX_ERR_FAIL;
     }
 
     ESP_LOGI(TAG, "New baudrate enabled. Reinitialize the interface!");
 
-    // Reinitialize the interface with the new baudrate.
-    vTaskSuspend(p_Device.Internal.TaskHandle);
-    p_Device.UART.Baudrate = New;
-    SIM70XX_ERROR_CHECK(SIM70XX_UART_Deinit(p_Device.UART));
-    SIM70XX_ERROR_CHECK(SIM70XX_UART_Init(p_Device.UART));
-    vTaskResume(p_Device.Internal.TaskHandle);
+    // Switch the interface to the new baudrate.
+    return SIM70XX_UART_SetBaudrate(p_Device.UART, New);
+}
 
-    return SIM70XX_ERR_OK;
+SIM70XX_Error_t SIM7020_AutoBaud(SIM7020_t& p_Device, SIM70XX_Baud_t* p_Baudrate)
+{
+    if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    return SIM70XX_Baud_Auto(&p_Device, p_Baudrate);
+}
+
+void SIM7020_GetStatistics(SIM7020_t& p_Device, SIM70XX_Statistics_t* p_Stats)
+{
+    SIM70XX_Queue_GetStatistics(p_Stats);
+    SIM70XX_Evt_GetStatistics(p_Stats);
+    SIM70XX_Mailbox_GetStatistics(p_Stats);
+    SIM70XX_UART_GetStatistics(p_Device.UART, p_Stats);
 }
 
 #endif
\ No newline at end of file
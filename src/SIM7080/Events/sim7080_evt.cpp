@@ -21,46 +21,35 @@
 
 #if(CONFIG_SIMXX_DEV == 7080)
 
+#include <esp_log.h>
+
 #include "sim7080.h"
 #include "sim7080_evt.h"
+#include "../../Private/Events/sim70xx_urc.h"
+#include "../../Private/Events/sim70xx_mailbox.h"
+#include "../../Private/Queue/sim70xx_queue.h"
 
-void SIM70XX_Evt_MessageFilter(void* p_Device, std::string* p_Message)
+static const char* TAG = "SIM7080_Evt";
+
+void SIM7080_Evt_on_PowerDown(void* p_Device, std::string* p_Message)
 {
-	bool Found;
 	SIM7080_t* Device = (SIM7080_t*)p_Device;
 
-	Found = false;
-
-	// Shutdown message was received.
-	if(p_Message->find("NORMAL POWER DOWN") != std::string::npos)
-	{
-	}
-
-	#ifdef CONFIG_SIM70XX_DRIVER_WITH_TCPIP
-		if(p_Message->find("+CASTATE") != std::string::npos)
-		{
-			SIM7080_Evt_on_TCP_Disconnect(Device, p_Message);
-			Found = true;
-		}
+	Device->Internal.isActive = false;
 
-		if(p_Message->find("+CADATAIND") != std::string::npos)
-		{
-			SIM7080_Evt_on_TCP_DataReady(Device, p_Message);
-			Found = true;
-		}
-	#endif
+	// Wake up all waiting tasks. The tasks are checking the active state of the device.
+	SIM70XX_Queue_WakeAll();
+	SIM70XX_Mailbox_WakeAll();
 
-	#ifdef CONFIG_SIM70XX_DRIVER_WITH_EMAIL
-	#endif
+	ESP_LOGI(TAG, "Power down event!");
+}
 
-	// Handle all other messages by putting them into the event queue.
-	if(Found == false)
-	{
-		xQueueSend(Device->Internal.EventQueue, &p_Message, 0);
-	}
-	else
+void SIM70XX_Evt_MessageFilter(void* p_Device, std::string* p_Message)
+{
+	// NOTE: Events which are waited for are registered as URC and moved into the event mailboxes by the dispatcher.
+	if(SIM70XX_URC_Dispatch(p_Device, p_Message) == false)
 	{
-		delete p_Message;
+		ESP_LOGD(TAG, "Unhandled event: %%s", p_Message->c_str());
 	}
 }
 
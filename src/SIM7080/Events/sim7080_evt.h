@@ -33,20 +33,26 @@
 
 #include <sdkconfig.h>
 
+/** @brief              Power down event handler.
+ *  @param p_Device     Pointer to device
+ *  @param p_Message    Pointer to message string
+ */
+void SIM7080_Evt_on_PowerDown(void* p_Device, std::string* p_Message);
+
 #ifdef CONFIG_SIM70XX_DRIVER_WITH_TCPIP
     /** @brief              TCP/IP disconnect event handler.
      *                      This function will filter out the disconnect message from the event message.
      *  @param p_Device     Pointer to device
      *  @param p_Message    Pointer to message string
      */
-    void SIM7080_Evt_on_TCP_Disconnect(SIM7080_t* const p_Device, std::string* p_Message);
+    void SIM7080_Evt_on_TCP_Disconnect(void* p_Device, std::string* p_Message);
 
     /** @brief              TCP/IP data ready event handler.
      *                      This function will filter out the receive message from the event message.
      *  @param p_Device     Pointer to device
      *  @param p_Message    Pointer to message string
      */
-    void SIM7080_Evt_on_TCP_DataReady(SIM7080_t* const p_Device, std::string* p_Message);
+    void SIM7080_Evt_on_TCP_DataReady(void* p_Device, std::string* p_Message);
 #endif
 
 #endif /* SIM7080_EVT_H_ */
\ No newline at end of file
@@ -31,12 +31,13 @@
 
 static const char* TAG = "SIM7080_Evt_TCP";
 
-void SIM7080_Evt_on_TCP_Disconnect(SIM7080_t* const p_Device, std::string* p_Message)
+void SIM7080_Evt_on_TCP_Disconnect(void* p_Device, std::string* p_Message)
 {
     uint8_t CID;
     size_t Index;
     std::string Message;
     SIM7080_TCP_Error_t Error;
+    SIM7080_t* Device = (SIM7080_t*)p_Device;
 
     ESP_LOGI(TAG, "TCP disconnect event!");
 
@@ -55,7 +56,7 @@ void SIM7080_Evt_on_TCP_Disconnect(SIM7080_t* const p_Device, std::string* p_Mes
     CID = std::stoi(Message.substr((Index - 1), Index));
     Error = (SIM7080_TCP_Error_t)std::stoi(Message.substr(Index + 1));
 
-    for(std::vector<SIM7080_TCP_Socket_t*>::iterator it = p_Device->TCP.Sockets.begin(); it != p_Device->TCP.Sockets.end(); ++it)
+    for(std::vector<SIM7080_TCP_Socket_t*>::iterator it = Device->TCP.Sockets.begin(); it != Device->TCP.Sockets.end(); ++it)
     {
         if((*it)->CID == CID)
         {
@@ -67,11 +68,12 @@ void SIM7080_Evt_on_TCP_Disconnect(SIM7080_t* const p_Device, std::string* p_Mes
     }
 }
 
-void SIM7080_Evt_on_TCP_DataReady(SIM7080_t* const p_Device, std::string* p_Message)
+void SIM7080_Evt_on_TCP_DataReady(void* p_Device, std::string* p_Message)
 {
     uint8_t CID;
     size_t Index;
     std::string Message;
+    SIM7080_t* Device = (SIM7080_t*)p_Device;
 
     ESP_LOGI(TAG, "TCP message data ready event!");
 
@@ -89,7 +91,7 @@ void SIM7080_Evt_on_TCP_DataReady(SIM7080_t* const p_Device, std::string* p_Mess
     Index = Message.find(":");
     CID = std::stoi(Message.substr(Index + 1, Message.find("\r\n", Index) - Index + 1));
 
-    for(std::vector<SIM7080_TCP_Socket_t*>::iterator it = p_Device->TCP.Sockets.begin(); it != p_Device->TCP.Sockets.end(); ++it)
+    for(std::vector<SIM7080_TCP_Socket_t*>::iterator it = Device->TCP.Sockets.begin(); it != Device->TCP.Sockets.end(); ++it)
     {
         if((*it)->CID == CID)
         {
@@ -46,12 +46,12 @@ static SIM70XX_Error_t SIM7080_FS_Init(SIM7080_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CFSINIT;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 /** @brief          Deinitialize the file system.
@@ -70,12 +70,12 @@ static SIM70XX_Error_t SIM7080_FS_Deinit(SIM7080_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CFSTERM;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7080_FS_GetFileSize(SIM7080_t& p_Device, SIM7080_FS_Path_t Path, std::string Name, size_t* p_Size)
@@ -97,11 +97,11 @@ SIM70XX_Error_t SIM7080_FS_GetFileSize(SIM7080_t& p_Device, SIM7080_FS_Path_t Pa
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CFSGFIS(Path, Name);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     *p_Size = (size_t)std::stoi(Response);
 
@@ -131,26 +131,19 @@ SIM70XX_Error_t SIM7080_FS_Write(SIM7080_t& p_Device, SIM7080_FS_Path_t Path, st
 
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CFSWFILE(Path, Name, Append, Length, Timeout);
+    SIM70XX_Queue_SetTxData(Command, "DOWNLOAD", p_Buffer, Length);
+
+    // The module waits up to the given timeout for the data. The response timeout must cover the transmission of the data too.
+    Command->Timeout += SIM70XX_Tools_GetTransferTime(p_Device.UART.Baudrate, Length) + ((Timeout + 999) / 1000);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
-    {
-        return SIM70XX_ERR_FAIL;
-    }
-    SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, NULL, &Response);
-    if(Response.find("DOWNLOAD") == std::string::npos)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         Error = SIM70XX_ERR_FAIL;
         goto SIM7080_FS_Write_Exit;
     }
-
-    vTaskSuspend(p_Device.Internal.TaskHandle);
-    SIM70XX_UART_Send(p_Device.UART, p_Buffer, Length);
-    SIM70XX_UART_ReadStringUntil(p_Device.UART);
-    Response = SIM70XX_UART_ReadStringUntil(p_Device.UART);
-    vTaskResume(p_Device.Internal.TaskHandle);
-    if(Response.find("OK") == std::string::npos)
+    Error = SIM70XX_Queue_PopItem(Command, NULL, &Response);
+    if(Error != SIM70XX_ERR_OK)
     {
-        Error = SIM70XX_ERR_FAIL;
         goto SIM7080_FS_Write_Exit;
     }
 
@@ -166,8 +159,6 @@ SIM7080_FS_Write_Exit:
 
 SIM70XX_Error_t SIM7080_FS_Read(SIM7080_t& p_Device, SIM7080_FS_Path_t Path, std::string Name, void* const p_Buffer, uint16_t Length, bool UsePosition, uint16_t Position)
 {
-    uint8_t* Buffer_Temp = (uint8_t*)p_Buffer;
-    uint16_t BytesRead;
     std::string Response;
     SIM70XX_TxCmd_t* Command;
 
@@ -192,53 +183,32 @@ SIM70XX_Error_t SIM7080_FS_Read(SIM7080_t& p_Device, SIM7080_FS_Path_t Path, std
         *Command = SIM7080_AT_CFSRFILE(Path, Name, UsePosition, Length, Position);
     }
 
+    // NOTE: The data are written directly into the buffer by the communication task.
+    SIM70XX_Queue_SetRxData(Command, "+CFSRFILE: ", p_Buffer, Length);
+    Command->Timeout += SIM70XX_Tools_GetTransferTime(p_Device.UART.Baudrate, Length);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
-    {
-        return SIM70XX_ERR_FAIL;
-    }
-    SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, NULL, &Response);
-    if(Response.find("+CFSRFILE:") == std::string::npos)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         SIM7080_FS_Deinit(p_Device);
 
         return SIM70XX_ERR_FAIL;
     }
 
-    vTaskSuspend(p_Device.Internal.TaskHandle);
-    BytesRead = 0;
-    do
+    if(SIM70XX_Queue_PopItem(Command, NULL, &Response) != SIM70XX_ERR_OK)
     {
-        int c;
-
-        c = SIM70XX_UART_Read(p_Device.UART);
-        if(c != -1)
-        {
-            *Buffer_Temp++ = c;
-            BytesRead++;
-        }
-    } while(BytesRead < Length);
-
-    // Read the trailing "OK".
-    SIM70XX_UART_ReadStringUntil(p_Device.UART);
-    SIM70XX_UART_ReadStringUntil(p_Device.UART);
-    Response = SIM70XX_UART_ReadStringUntil(p_Device.UART);
-
-    vTaskResume(p_Device.Internal.TaskHandle);
-
-    ESP_LOGI(TAG, "Response: %s", Response.c_str());
+        SIM7080_FS_Deinit(p_Device);
 
-    if(Response.find("OK") == std::string::npos)
-    {
         return SIM70XX_ERR_FAIL;
     }
 
+    ESP_LOGI(TAG, "Response: %s", Response.c_str());
+
     return SIM7080_FS_Deinit(p_Device);
 }
 
 SIM70XX_Error_t SIM7080_FS_Delete(SIM7080_t& p_Device, SIM7080_FS_Path_t Path, std::string Name)
 {
-    uint32_t Size;
+    size_t Size;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -253,11 +223,11 @@ SIM70XX_Error_t SIM7080_FS_Delete(SIM7080_t& p_Device, SIM7080_FS_Path_t Path, s
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CFSDFILE(Path, Name);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     p_Device.FS.Free += Size;
 
@@ -278,11 +248,11 @@ SIM70XX_Error_t SIM7080_FS_Rename(SIM7080_t& p_Device, SIM7080_FS_Path_t Path, s
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CFSREN(Path, Old, New);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     return SIM7080_FS_Deinit(p_Device);
 }
@@ -306,11 +276,11 @@ SIM70XX_Error_t SIM7080_FS_GetFree(SIM7080_t& p_Device, uint32_t* const p_Free)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CFSGFRS;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Device.FS.Free = std::stoi(Response);
     *p_Free = p_Device.FS.Free;
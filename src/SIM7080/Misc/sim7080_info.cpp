@@ -25,6 +25,7 @@
 
 #include "sim7080.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Parser/sim70xx_parser.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7080_Info";
@@ -76,9 +77,9 @@ SIM70XX_Error_t SIM7080_Info_GetManufacturer(SIM7080_t& p_Device, std::string* c
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CGMI;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_Manufacturer);
+        return SIM70XX_Queue_PopItem(Command, p_Manufacturer);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -100,9 +101,9 @@ SIM70XX_Error_t SIM7080_Info_GetModel(SIM7080_t& p_Device, std::string* const p_
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CGMM;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_Model);
+        return SIM70XX_Queue_PopItem(Command, p_Model);
     }
 
     return SIM70XX_ERR_FAIL;  
@@ -124,9 +125,9 @@ SIM70XX_Error_t SIM7080_Info_GetFW(SIM7080_t& p_Device, std::string* const p_Fir
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CGMR;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_Firmware);
+        return SIM70XX_Queue_PopItem(Command, p_Firmware);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -148,9 +149,9 @@ SIM70XX_Error_t SIM7080_Info_GetIMEI(SIM7080_t& p_Device, std::string* const p_I
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CGSN;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_IMEI);
+        return SIM70XX_Queue_PopItem(Command, p_IMEI);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -172,9 +173,9 @@ SIM70XX_Error_t SIM7080_Info_GetICCID(SIM7080_t& p_Device, std::string* const p_
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CCID;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout))
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
     {
-        return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, p_ICCID);
+        return SIM70XX_Queue_PopItem(Command, p_ICCID);
     }
 
     return SIM70XX_ERR_FAIL;
@@ -182,7 +183,9 @@ SIM70XX_Error_t SIM7080_Info_GetICCID(SIM7080_t& p_Device, std::string* const p_
 
 SIM70XX_Error_t SIM7080_Info_GetNetworkRegistrationStatus(SIM7080_t& p_Device)
 {
+    uint32_t Status;
     std::string Response;
+    SIM70XX_Parser_t Parser;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -193,21 +196,31 @@ SIM70XX_Error_t SIM7080_Info_GetNetworkRegistrationStatus(SIM7080_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CGREG;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
-    p_Device.Connection.Status = (SIM7080_NetRegistration_t)std::stoi(Response.substr(Response.find(",") + 1));
+    // Skip the URC configuration.
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_Next(&Parser);
+    if(SIM70XX_Parser_GetUInt(&Parser, &Status) == false)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+
+    p_Device.Connection.Status = (SIM7080_NetRegistration_t)Status;
 
     return SIM70XX_ERR_OK;
 }
 
 SIM70XX_Error_t SIM7080_Info_GetQuality(SIM7080_t& p_Device, SIM70XX_Qual_t* p_Report)
 {
-    size_t Index;
+    uint32_t RSSI;
+    uint32_t RXQual;
     std::string Response;
+    SIM70XX_Parser_t Parser;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -222,22 +235,24 @@ SIM70XX_Error_t SIM7080_Info_GetQuality(SIM7080_t& p_Device, SIM70XX_Qual_t* p_R
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CSQ;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     // TODO: Implement RSSI calculation
 
-    Index = Response.find(",");
-    if(Index == std::string::npos)
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_GetUInt(&Parser, &RSSI);
+    SIM70XX_Parser_GetUInt(&Parser, &RXQual);
+    if(Parser.isError)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    p_Report->RSSI = std::stoi(Response.substr(0, Index));
-    p_Report->RXQual = std::stoi(Response.substr(Response.find_last_of(",") + 1));
+    p_Report->RSSI = RSSI;
+    p_Report->RXQual = RXQual;
 
     ESP_LOGD(TAG, "RSSI: %u", p_Report->RSSI);
     ESP_LOGD(TAG, "RXQual: %u", p_Report->RXQual);
@@ -248,6 +263,7 @@ SIM70XX_Error_t SIM7080_Info_GetQuality(SIM7080_t& p_Device, SIM70XX_Qual_t* p_R
 SIM70XX_Error_t SIM7080_Info_GetEquipmentInfo(SIM7080_t& p_Device, SIM7080_UEInfo_t* p_Info)
 {
     std::string Response;
+    SIM70XX_Parser_t Parser;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Info == NULL)
@@ -262,11 +278,11 @@ SIM70XX_Error_t SIM7080_Info_GetEquipmentInfo(SIM7080_t& p_Device, SIM7080_UEInf
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CPSI;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     ESP_LOGI(TAG, "Response: %s", Response.c_str());
 
@@ -275,28 +291,47 @@ SIM70XX_Error_t SIM7080_Info_GetEquipmentInfo(SIM7080_t& p_Device, SIM7080_UEInf
         return SIM70XX_ERR_NOT_READY;
     }
 
-    p_Info->SystemMode = SIM70XX_Tools_SubstringSplitErase(&Response);
-    p_Info->OperationMode = SIM70XX_Tools_SubstringSplitErase(&Response);
-    p_Info->MCC = SIM70XX_Tools_SubstringSplitErase(&Response);
-    p_Info->MNC = SIM70XX_Tools_SubstringSplitErase(&Response);
+    SIM70XX_Parser_Init(&Parser, Response);
+    SIM70XX_Parser_GetString(&Parser, &p_Info->SystemMode);
+    SIM70XX_Parser_GetString(&Parser, &p_Info->OperationMode);
+
+    // The MCC and the MNC are reported as <MCC>-<MNC>.
+    SIM70XX_Parser_GetString(&Parser, &p_Info->MCC, '-');
+    SIM70XX_Parser_GetString(&Parser, &p_Info->MNC);
 
     if(p_Info->SystemMode == "GSM")
     {
-        p_Info->GSM.LAC = SIM70XX_Tools_SubstringSplitErase(&Response);
+        SIM70XX_Parser_GetString(&Parser, &p_Info->GSM.LAC);
         // TODO
     }
     else
     {
-        p_Info->CAT.TAC = SIM70XX_Tools_SubstringSplitErase(&Response);
-        p_Info->CAT.SCellID = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-        p_Info->CAT.Band = SIM70XX_Tools_SubstringSplitErase(&Response);
-        p_Info->CAT.earfcn = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-        p_Info->CAT.dlbw = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-        p_Info->CAT.ulbw = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-        p_Info->CAT.RSRQ = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-        p_Info->CAT.RSRP = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-        p_Info->CAT.RSSI = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
-        p_Info->CAT.RSSNR = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Response));
+        int32_t Value;
+
+        SIM70XX_Parser_GetString(&Parser, &p_Info->CAT.TAC);
+        SIM70XX_Parser_GetUInt(&Parser, &p_Info->CAT.SCellID);
+
+        // Skip the physical cell ID.
+        SIM70XX_Parser_Next(&Parser);
+        SIM70XX_Parser_GetString(&Parser, &p_Info->CAT.Band);
+        SIM70XX_Parser_GetUInt(&Parser, &p_Info->CAT.earfcn);
+        SIM70XX_Parser_GetUInt(&Parser, &p_Info->CAT.dlbw);
+        SIM70XX_Parser_GetUInt(&Parser, &p_Info->CAT.ulbw);
+        SIM70XX_Parser_GetInt(&Parser, &Value);
+        p_Info->CAT.RSRQ = Value;
+        SIM70XX_Parser_GetInt(&Parser, &Value);
+        p_Info->CAT.RSRP = Value;
+        SIM70XX_Parser_GetInt(&Parser, &Value);
+        p_Info->CAT.RSSI = Value;
+        SIM70XX_Parser_GetInt(&Parser, &Value);
+        p_Info->CAT.RSSNR = Value;
+    }
+
+    if(Parser.isError)
+    {
+        ESP_LOGE(TAG, "Invalid response!");
+
+        return SIM70XX_ERR_FAIL;
     }
 
     return SIM70XX_ERR_OK;
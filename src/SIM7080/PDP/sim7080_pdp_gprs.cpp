@@ -32,7 +32,8 @@ static const char* TAG = "SIM7080_PDP";
 
 SIM70XX_Error_t SIM7080_PDP_GPRS_Define(SIM7080_t& p_Device, SIM7080_PDP_GPRS_Type_t Type, SIM70XX_APN_t APN, uint8_t PDP)
 {
-    std::string CommandStr;
+    const char* TypeStr;
+    std::string Status;
     SIM70XX_TxCmd_t* Command;
     SIM70XX_Error_t Error;
 
@@ -47,37 +48,43 @@ SIM70XX_Error_t SIM7080_PDP_GPRS_Define(SIM7080_t& p_Device, SIM7080_PDP_GPRS_Ty
 
     if(Type == SIM7080_PDP_GPRS_IP)
     {
-        CommandStr = "AT+CGDCONT=" + std::to_string(PDP) + ",\"IP\",\"" + APN.Name + "\"";
+        TypeStr = "IP";
     }
     else if(Type == SIM7080_PDP_GPRS_IPV6)
     {
-        CommandStr = "AT+CGDCONT=" + std::to_string(PDP) + ",\"IPV6\",\"" + APN.Name + "\"";
+        TypeStr = "IPV6";
     }
     else if(Type == SIM7080_PDP_GPRS_IPV4V6)
     {
-        CommandStr = "AT+CGDCONT=" + std::to_string(PDP) + ",\"IPV4V6\",\"" + APN.Name + "\"";
+        TypeStr = "IPV4V6";
     }
     else if(Type == SIM7080_PDP_GPRS_NO_IP)
     {
-        CommandStr = "AT+CGDCONT=" + std::to_string(PDP) + ",\"Non-IP\",\"" + APN.Name + "\"";
+        TypeStr = "Non-IP";
     }
-
-    if((APN.Username.size() > 0) && (APN.Password.size() > 0))
+    else
     {
-        CommandStr += ",\"" + APN.Username + "\",\"" + APN.Password + "\"";
+        return SIM70XX_ERR_INVALID_ARG;
     }
 
     SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7080_AT_CGDCONT_W(CommandStr);
+    if((APN.Username.size() > 0) && (APN.Password.size() > 0))
+    {
+        *Command = SIM7080_AT_CGDCONT_W_AUTH(PDP, TypeStr, APN.Name, APN.Username, APN.Password);
+    }
+    else
+    {
+        *Command = SIM7080_AT_CGDCONT_W(PDP, TypeStr, APN.Name);
+    }
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
     // NOTE: We can not use the error macro here because Response and Status are swapped.
-    Error = SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, NULL, &CommandStr);
-    if(CommandStr.find("OK") == std::string::npos)
+    Error = SIM70XX_Queue_PopItem(Command, NULL, &Status);
+    if(Status.find("OK") == std::string::npos)
     {
         return Error;
     }
@@ -98,7 +105,7 @@ bool SIM7080_PGP_GRPS_isAttached(SIM7080_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CGATT_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return false;
     }
@@ -26,6 +26,7 @@
 #include "sim7080.h"
 #include "sim7080_pdp_defs.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Parser/sim70xx_parser.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7080_PDP";
@@ -54,12 +55,12 @@ SIM70XX_Error_t SIM7080_PDP_IP_Configure(SIM7080_t& p_Device, SIM7080_PDP_IP_Typ
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CNCFG_W(CommandStr);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);;
+    return SIM70XX_Queue_PopItem(Command);;
 }
 
 SIM70XX_Error_t SIM7080_PDP_IP_Action(SIM7080_t& p_Device, uint8_t PDP, SIM7080_PDP_Action_t Action)
@@ -78,18 +79,19 @@ SIM70XX_Error_t SIM7080_PDP_IP_Action(SIM7080_t& p_Device, uint8_t PDP, SIM7080_
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CNACT_W(PDP, Action);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7080_PDP_IP_CheckNetworks(SIM7080_t& p_Device, std::vector<SIM7080_PDP_Network_t>* p_Networks)
 {
-    size_t Index;
     std::string Response;
+    SIM70XX_Field_t Line;
+    SIM70XX_Parser_t Lines;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -104,11 +106,11 @@ SIM70XX_Error_t SIM7080_PDP_IP_CheckNetworks(SIM7080_t& p_Device, std::vector<SI
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CNACT_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     ESP_LOGI(TAG, "Response: %s", Response.c_str());
 
@@ -117,21 +119,29 @@ SIM70XX_Error_t SIM7080_PDP_IP_CheckNetworks(SIM7080_t& p_Device, std::vector<SI
         return SIM70XX_ERR_FAIL;
     }
 
-    do
+    // Each response line has the layout
+    //  <PDP>,<Status>,<IP address>
+    SIM70XX_Parser_Init(&Lines, Response);
+    while(SIM70XX_Parser_Next(&Lines, &Line, '\n'))
     {
-        std::string Dummy;
+        uint32_t Value;
+        SIM70XX_Parser_t Parser;
         SIM7080_PDP_Network_t Result;
 
-        Index = Response.find("\n");
-        Dummy = Response.substr(0, Index).c_str();
-        Response.erase(0, Index + 1);
+        SIM70XX_Parser_Init(&Parser, Line.p_Data, Line.Length);
+        SIM70XX_Parser_GetUInt(&Parser, &Value);
+        Result.ID = Value;
+        SIM70XX_Parser_GetUInt(&Parser, &Value);
+        Result.Status = (SIM7080_PDP_Status_t)Value;
+        SIM70XX_Parser_GetString(&Parser, &Result.IP);
 
-        Result.ID = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Dummy));
-        Result.Status = (SIM7080_PDP_Status_t)std::stoi(SIM70XX_Tools_SubstringSplitErase(&Dummy));
-        Result.IP = SIM70XX_Tools_SubstringSplitErase(&Dummy);
+        if(Parser.isError)
+        {
+            return SIM70XX_ERR_FAIL;
+        }
 
         p_Networks->push_back(Result);
-    } while(Index != std::string::npos);
+    }
 
     return SIM70XX_ERR_OK;
 }
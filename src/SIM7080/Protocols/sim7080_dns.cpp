@@ -26,6 +26,7 @@
 #include "sim7080.h"
 #include "sim7080_dns.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Events/sim70xx_mailbox.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7080_DNS";
@@ -36,7 +37,6 @@ static const char* TAG = "SIM7080_DNS";
 SIM70XX_Error_t SIM7080_DNS_FetchAddress(SIM7080_t& p_Device, std::string Host, std::string* p_IP, SIM7080_DNS_Error_t* p_Error, uint32_t Timeout)
 {
     size_t Index;
-    uint32_t Now;
     uint8_t DNS_Error;
     std::string Response;
     SIM70XX_TxCmd_t* Command;
@@ -50,25 +50,19 @@ SIM70XX_Error_t SIM7080_DNS_FetchAddress(SIM7080_t& p_Device, std::string Host,
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Register("+CDNSGIP", false));
+    SIM70XX_Mailbox_Flush("+CDNSGIP", SIM70XX_MAILBOX_NO_ID);
+
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CDNSGIP(Host);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
-
-    Now = SIM70XX_Tools_GetmsTimer();
-    while(SIM70XX_Queue_isEvent(p_Device.Internal.EventQueue, "+CDNSGIP", &Response) == false)
-    {
-        if((SIM70XX_Tools_GetmsTimer() - Now) > (Timeout * 1000UL))
-        {
-            return SIM70XX_ERR_TIMEOUT;
-        }
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
-        vTaskDelay(100 / portTICK_PERIOD_MS);
-    }
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Wait("+CDNSGIP", SIM70XX_MAILBOX_NO_ID, &Response, (Timeout * 1000UL) / portTICK_PERIOD_MS));
 
     SIMXX_TOOLS_REMOVE_LINEEND(Response);
 
@@ -27,6 +27,7 @@
 #include "sim7080_email.h"
 #include "../../Private/UART/sim70xx_uart.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Events/sim70xx_mailbox.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7080_EMail";
@@ -56,10 +57,13 @@ SIM70XX_Error_t SIM7080_EMail_SendText(SIM7080_t& p_Device, SIM7080_EMail_Config
 
     // TODO: Add support for SNTP servers without authentication
 
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Register("+SMTPSEND", false));
+    SIM70XX_Mailbox_Flush("+SMTPSEND", SIM70XX_MAILBOX_NO_ID);
+
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_EMAILCID(CID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
@@ -67,7 +71,7 @@ SIM70XX_Error_t SIM7080_EMail_SendText(SIM7080_t& p_Device, SIM7080_EMail_Config
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_EMAILTO(30);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
@@ -75,7 +79,7 @@ SIM70XX_Error_t SIM7080_EMail_SendText(SIM7080_t& p_Device, SIM7080_EMail_Config
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_SMTPSRV(p_Config->SMTP_Address, p_Config->SMTP_Port);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
@@ -83,7 +87,7 @@ SIM70XX_Error_t SIM7080_EMail_SendText(SIM7080_t& p_Device, SIM7080_EMail_Config
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_SMTPAUTH(p_Config->SMTP_Auth_User, p_Config->SMTP_Auth_Pass);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
@@ -91,7 +95,7 @@ SIM70XX_Error_t SIM7080_EMail_SendText(SIM7080_t& p_Device, SIM7080_EMail_Config
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_SMTPFROM(p_Sender->Address, p_Sender->Name);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
@@ -99,7 +103,7 @@ SIM70XX_Error_t SIM7080_EMail_SendText(SIM7080_t& p_Device, SIM7080_EMail_Config
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_SMTPRCPT(0, p_To->Address, p_To->Name);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
@@ -107,44 +111,31 @@ SIM70XX_Error_t SIM7080_EMail_SendText(SIM7080_t& p_Device, SIM7080_EMail_Config
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_SMTPSUB(Subject);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
 
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_SMTPBODY(Body.size());
+    SIM70XX_Queue_SetTxData(Command, "DOWNLOAD", Body.c_str(), Body.size());
+    Command->Timeout += SIM70XX_Tools_GetTransferTime(p_Device.UART.Baudrate, Body.size());
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
-    {
-        return SIM70XX_ERR_FAIL;
-    }
-
-    SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, NULL, &Response);
-    if(Response.find("DOWNLOAD") == std::string::npos)
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    vTaskSuspend(p_Device.Internal.TaskHandle);
-    SIM70XX_UART_Send(p_Device.UART, Body.c_str(), Body.size());
-    SIM70XX_UART_ReadStringUntil(p_Device.UART);
-    SIM70XX_UART_ReadStringUntil(p_Device.UART);
-    vTaskResume(p_Device.Internal.TaskHandle);
-
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_SMTPSEND;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if((SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response) != SIM70XX_ERR_OK))
+    if((SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false) || (SIM70XX_Queue_PopItem(Command, &Response) != SIM70XX_ERR_OK))
     {
         return SIM70XX_ERR_FAIL;
     }
 
     // Wait for the transmission status.
-    while(SIM70XX_Queue_isEvent(p_Device.Internal.EventQueue, "+SMTPSEND", &Response) == false)
-    {
-        vTaskDelay(100);
-    }
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Wait("+SMTPSEND", SIM70XX_MAILBOX_NO_ID, &Response, portMAX_DELAY));
 
     ESP_LOGI(TAG, "Response: %s", Response.c_str());
 
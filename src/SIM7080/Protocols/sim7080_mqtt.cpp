@@ -28,6 +28,10 @@
 #include "../../Private/Queue/sim70xx_queue.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
+/** @brief Maximum number of configuration commands for a MQTT socket.
+ */
+#define SIM7080_MQTT_CONFIG_COUNT                   8
+
 static const char* TAG = "SIM7080_MQTT";
 
 SIM70XX_Error_t SIM7080_MQTT_Create(SIM7080_t& p_Device, SIM7080_MQTT_Socket_t* p_Socket, std::string Broker, uint16_t Port)
@@ -47,8 +51,10 @@ SIM70XX_Error_t SIM7080_MQTT_Create(SIM7080_t& p_Device, SIM7080_MQTT_Socket_t*
 
 SIM70XX_Error_t SIM7080_MQTT_Create(SIM7080_t& p_Device, SIM7080_MQTT_Socket_t* p_Socket)
 {
-    std::string CommandStr;
-    SIM70XX_TxCmd_t* Command;
+    uint32_t Count;
+    SIM70XX_Error_t Error;
+    std::vector<std::string> Configuration;
+    SIM70XX_TxCmd_t* Commands[SIM7080_MQTT_CONFIG_COUNT];
 
     if((p_Socket == NULL) || (p_Socket->ClientID.size() == 0) || (p_Socket->Broker.size() == 0))
     {
@@ -59,99 +65,61 @@ SIM70XX_Error_t SIM7080_MQTT_Create(SIM7080_t& p_Device, SIM7080_MQTT_Socket_t*
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    CommandStr = "AT+SMCONF=\"CLIENTID\",\"" + p_Socket->ClientID + "\"";
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_SMCONF(CommandStr);
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
-    {
-        return SIM70XX_ERR_FAIL;
-    }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    Configuration.push_back("AT+SMCONF=\"CLIENTID\",\"" + p_Socket->ClientID + "\"");
+    Configuration.push_back("AT+SMCONF=\"KEEPTIME\"," + std::to_string(p_Socket->KeepAlive));
+    Configuration.push_back("AT+SMCONF=\"URL\",\"" + p_Socket->Broker + "\"," + std::to_string(p_Socket->Port));
+    Configuration.push_back("AT+SMCONF=\"CLEANSS\"," + std::to_string(p_Socket->CleanSession));
+    Configuration.push_back("AT+SMCONF=\"QOS\"," + std::to_string(p_Socket->QoS));
 
-    CommandStr = "AT+SMCONF=\"KEEPTIME\"," + std::to_string(p_Socket->KeepAlive);
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_SMCONF(CommandStr);
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(p_Socket->p_LastWill != NULL)
     {
-        return SIM70XX_ERR_FAIL;
+        // TODO:
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
 
-    CommandStr = "AT+SMCONF=\"URL\",\"" + p_Socket->Broker + "\"," + std::to_string(p_Socket->Port);
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_SMCONF(CommandStr);
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(p_Socket->Username.size() > 0)
     {
-        return SIM70XX_ERR_FAIL;
+        Configuration.push_back("AT+SMCONF=\"USERNAME\",\"" + p_Socket->Username + "\"");
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
 
-    CommandStr = "AT+SMCONF=\"CLEANSS\"," + std::to_string(p_Socket->CleanSession);
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_SMCONF(CommandStr);
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(p_Socket->Password.size() > 0)
     {
-        return SIM70XX_ERR_FAIL;
+        Configuration.push_back("AT+SMCONF=\"PASSWORD\",\"" + p_Socket->Password + "\"");
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
 
-    CommandStr = "AT+SMCONF=\"QOS\"," + std::to_string(p_Socket->QoS);
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_SMCONF(CommandStr);
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
-    {
-        return SIM70XX_ERR_FAIL;
-    }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    // TODO: Add RETAIN
+    // TODO: Add SUBHEX
 
-    if(p_Socket->p_LastWill != NULL)
-    {
-        // TODO:
-    }
+    Configuration.push_back("AT+SMCONF=\"ASYNCMODE\",0");
 
-    if(p_Socket->Username.size() > 0)
+    // The configuration commands are independent from each other. So we queue all commands at once and wait for the results afterwards.
+    // NOTE: The communication task still transmits the commands one after another. This only saves the wake up of this task between the commands.
+    Error = SIM70XX_ERR_OK;
+    for(Count = 0; Count < Configuration.size(); Count++)
     {
-        CommandStr = "AT+SMCONF=\"USERNAME\"," + p_Socket->Username + "\"";
-        SIM70XX_CREATE_CMD(Command);
-        *Command = SIM7020_AT_SMCONF(CommandStr);
-        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-        if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+        Commands[Count] = SIM70XX_Queue_Acquire();
+        if(Commands[Count] == NULL)
         {
-            return SIM70XX_ERR_FAIL;
+            Error = SIM70XX_ERR_NO_MEM;
+            break;
         }
-        SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
-    }
 
-    if(p_Socket->Password.size() > 0)
-    {
-        CommandStr = "AT+SMCONF=\"PASSWORD\"," + p_Socket->Password + "\"";
-        SIM70XX_CREATE_CMD(Command);
-        *Command = SIM7020_AT_SMCONF(CommandStr);
-        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-        if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+        *Commands[Count] = SIM7020_AT_SMCONF(Configuration.at(Count));
+        Error = SIM70XX_Queue_Push(p_Device.Internal.TxQueue, Commands[Count]);
+        if(Error != SIM70XX_ERR_OK)
         {
-            return SIM70XX_ERR_FAIL;
+            break;
         }
-        SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
     }
 
-    // TODO: Add RETAIN
-    // TODO: Add SUBHEX
-
-    CommandStr = "AT+SMCONF=\"ASYNCMODE\",0";
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7020_AT_SMCONF(CommandStr);
-    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    // NOTE: All queued commands must be processed to release the command objects.
+    if(Error != SIM70XX_ERR_OK)
     {
-        return SIM70XX_ERR_FAIL;
+        SIM70XX_Queue_WaitAll(Commands, Count, &p_Device.Internal.isActive);
+
+        return Error;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_WaitAll(Commands, Count, &p_Device.Internal.isActive));
 
     p_Socket->isCreated = true;
 
@@ -182,11 +150,11 @@ SIM70XX_Error_t SIM7080_MQTT_Connect(SIM7080_t& p_Device, SIM7080_MQTT_Socket_t*
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_SMCONN;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     p_Socket->isConnected = true;
     p_Device.MQTT.Sockets.push_back(p_Socket);
@@ -51,22 +51,22 @@ SIM70XX_Error_t SIM7080_NTP_Sync(SIM7080_t& p_Device, std::string Server, int8_t
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CNTP_W(Server, TimeZone, CID, SIM7080_NTP_MODE_BOTH);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CNTP;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
     // NOTE: Status and Response are swapped here!
-    SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Status, &Response);
+    SIM70XX_Queue_PopItem(Command, &Status, &Response);
     if(Status.find("OK") == std::string::npos)
     {
         return SIM70XX_ERR_FAIL;
@@ -128,11 +128,11 @@ SIM70XX_Error_t SIM7080_NTP_GetTime(SIM7080_t& p_Device, struct tm* p_Time, int8
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CCLK_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     Response.replace(Response.find("\""), std::string("\"").size(), "");
     Response.replace(Response.find("\""), std::string("\"").size(), "");
@@ -28,14 +28,16 @@
 #include "sim7080.h"
 #include "sim7080_tcpip.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Parser/sim70xx_parser.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7080_TCPIP";
 
 SIM70XX_Error_t SIM7080_TCP_Ping(SIM7080_t& p_Device, SIM7080_Ping_t* p_Config, std::vector<SIM7080_PingRes_t>* p_Result, bool IPv6)
 {
-    size_t Index;
     std::string Response;
+    SIM70XX_Field_t Line;
+    SIM70XX_Parser_t Lines;
     std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
@@ -81,35 +83,45 @@ SIM70XX_Error_t SIM7080_TCP_Ping(SIM7080_t& p_Device, SIM7080_Ping_t* p_Config,
 
     if(IPv6)
     {
-        *Command = SIM7080_AT_SNPING6(p_Config->Host, p_Config->Retries, p_Config->Size, p_Config->Timeout, (uint16_t)p_Config->Retries);
+        *Command = SIM7080_AT_SNPING6(p_Config->Host, p_Config->Retries, p_Config->Size, p_Config->Timeout);
     }
     else
     {
-        *Command = SIM7080_AT_SNPING4(p_Config->Host, p_Config->Retries, p_Config->Size, p_Config->Timeout, (uint16_t)p_Config->Retries);
+        *Command = SIM7080_AT_SNPING4(p_Config->Host, p_Config->Retries, p_Config->Size, p_Config->Timeout);
     }
 
+    // The module sends one response line for each retry.
+    Command->Lines = p_Config->Retries;
+
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
-    do
+    // Each response line has the layout
+    //  <Reply ID>,<IP address>,<Reply time>
+    SIM70XX_Parser_Init(&Lines, Response);
+    while(SIM70XX_Parser_Next(&Lines, &Line, '\n'))
     {
-        std::string Dummy;
+        uint32_t Value;
+        SIM70XX_Parser_t Parser;
         SIM7080_PingRes_t Result;
 
-        Index = Response.find("\n");
-        Dummy = Response.substr(0, Index).c_str();
-        Response.erase(0, Index + 1);
+        SIM70XX_Parser_Init(&Parser, Line.p_Data, Line.Length);
+        SIM70XX_Parser_Next(&Parser);
+        SIM70XX_Parser_GetString(&Parser, &Result.IP);
+        SIM70XX_Parser_GetUInt(&Parser, &Value);
+        Result.ReplyTime = Value;
 
-        SIM70XX_Tools_SubstringSplitErase(&Dummy);
-        Result.IP = SIM70XX_Tools_SubstringSplitErase(&Dummy);
-        Result.ReplyTime = std::stoi(SIM70XX_Tools_SubstringSplitErase(&Dummy));
+        if(Parser.isError)
+        {
+            return SIM70XX_ERR_FAIL;
+        }
 
         p_Result->push_back(Result);
-    } while(Index != std::string::npos);
+    }
 
     return SIM70XX_ERR_OK;
 }
@@ -22,12 +22,16 @@
 #if((CONFIG_SIMXX_DEV == 7080) && (defined CONFIG_SIM70XX_DRIVER_WITH_TCPIP))
 
 #include <esp_log.h>
-#include <esp_task_wdt.h>
+#ifndef CONFIG_IDF_TARGET_LINUX
+    #include <esp_task_wdt.h>
+#endif
 
 #include "sim7080.h"
 #include "sim7080_tcpip.h"
 #include "../../Private/UART/sim70xx_uart.h"
+#include "../Events/sim7080_evt.h"
 #include "../../Private/Queue/sim70xx_queue.h"
+#include "../../Private/Events/sim70xx_urc.h"
 #include "../../Private/Commands/sim70xx_commands.h"
 
 static const char* TAG = "SIM7080_TCPIP";
@@ -47,6 +51,10 @@ SIM70XX_Error_t SIM7080_TCP_Client_Create(SIM7080_t& p_Device, std::string IP, u
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
+    // Register the URC handlers of the module.
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("+CASTATE", SIM7080_Evt_on_TCP_Disconnect));
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("+CADATAIND", SIM7080_Evt_on_TCP_DataReady));
+
     p_Socket->IP = IP;
     p_Socket->Port = Port;
     p_Socket->CID = CID;
@@ -87,11 +95,11 @@ SIM70XX_Error_t SIM7080_TCP_Client_Connect(SIM7080_t& p_Device, SIM7080_TCP_Sock
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CAOPEN(p_Socket->CID, PDP, "TCP", p_Socket->IP, p_Socket->Port);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     SIM70XX_Tools_SubstringSplitErase(&Response);
     Result = (SIM7080_TCP_Error_t)std::stoi(Response);
@@ -116,10 +124,8 @@ SIM70XX_Error_t SIM7080_TCP_Client_Connect(SIM7080_t& p_Device, SIM7080_TCP_Sock
 
 SIM70XX_Error_t SIM7080_TCP_Client_Transmit(SIM7080_t& p_Device, SIM7080_TCP_Socket_t* p_Socket, const void* p_Buffer, uint32_t Length, uint16_t Timeout, uint16_t PacketSize)
 {
-    uint8_t* Buffer = (uint8_t*)p_Buffer;
+    const uint8_t* Buffer = (const uint8_t*)p_Buffer;
     uint32_t Remaining = Length;
-    SIM70XX_Error_t Error = SIM70XX_ERR_OK;
-    SIM70XX_TxCmd_t* Command;
 
     if((p_Socket == NULL) || (p_Socket->Type != SIM7080_TCP_TYPE_TCP) || ((p_Buffer == NULL) && (Length > 0)) || (PacketSize > SIM7080_TCP_MAX_PAYLOAD_SIZE))
     {
@@ -142,15 +148,16 @@ SIM70XX_Error_t SIM7080_TCP_Client_Transmit(SIM7080_t& p_Device, SIM7080_TCP_Soc
         return SIM70XX_ERR_OK;
     }
 
-    // NOTE: We can not use the standard process here, because the response (">") does not contain a new line. The command will end with an empty space (0x20).
-    vTaskSuspend(p_Device.Internal.TaskHandle);
     ESP_LOGI(TAG, "Total %u bytes to transmit...", Remaining);
     do
     {
         uint32_t BytesToSend;
-        std::string Response;
+        SIM70XX_Error_t Error;
+        SIM70XX_TxCmd_t* Command;
 
-        esp_task_wdt_reset();
+        #ifndef CONFIG_IDF_TARGET_LINUX
+            esp_task_wdt_reset();
+        #endif
 
         if(Remaining > PacketSize)
         {
@@ -163,51 +170,37 @@ SIM70XX_Error_t SIM7080_TCP_Client_Transmit(SIM7080_t& p_Device, SIM7080_TCP_Soc
 
         ESP_LOGI(TAG, "     Transmit %u bytes...", BytesToSend);
 
+        // NOTE: The data are transmitted directly from the buffer by the communication task after the module has sent the prompt.
         SIM70XX_CREATE_CMD(Command);
         *Command = SIM7080_AT_CASEND(p_Socket->CID, BytesToSend, Timeout);
-        SIM70XX_UART_SendLine(p_Device.UART, Command->Command);
+        SIM70XX_Queue_SetTxData(Command, "> ", Buffer, BytesToSend);
 
-        // Wait for the empty space after the ">".
-        Response = SIM70XX_UART_ReadStringUntil(p_Device.UART, ' ', Command->Timeout * 1000UL);
-        if(Response.find(">") == std::string::npos)
+        // The module waits up to the given timeout for the data. The response timeout must cover the transmission of the data too.
+        Command->Timeout += SIM70XX_Tools_GetTransferTime(p_Device.UART.Baudrate, BytesToSend) + ((Timeout + 999) / 1000);
+        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+        if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
         {
-            ESP_LOGE(TAG, "Invalid response. Expect '>', got: %s", Response.c_str());
-
-            Error = SIM70XX_ERR_FAIL;
-            goto SIM7080_TCP_Client_Transmit_Exit;
+            return SIM70XX_ERR_FAIL;
         }
 
-        // Send the data.
-        SIM70XX_UART_Send(p_Device.UART, Buffer, BytesToSend);
+        Error = SIM70XX_Queue_PopItem(Command);
 
-        // Read and parse the result.
-        SIM70XX_UART_ReadStringUntil(p_Device.UART);
-        Response = SIM70XX_UART_ReadStringUntil(p_Device.UART, '\n', Command->Timeout * 1000UL);
-        ESP_LOGE(TAG, "Response: %s", Response.c_str());
-    
         // Transmission error. Repeat the last packet.
-        if(Response.find("ERROR") != std::string::npos)
+        if(Error == SIM70XX_ERR_FAIL)
         {
             continue;
         }
-        // Packet transmission successful.
-        else
+        else if(Error != SIM70XX_ERR_OK)
         {
-            // Response "OK" - transmit the next packet.
-            if(Response.find("OK") != std::string::npos)
-            {
-                Buffer += BytesToSend;
-                Remaining -= BytesToSend;
-            }
+            return Error;
         }
-    } while((Remaining > 0) && (p_Socket->isConnected));
-
-SIM7080_TCP_Client_Transmit_Exit:
-    delete Command;
 
-    vTaskResume(p_Device.Internal.TaskHandle);
+        // Response "OK" - transmit the next packet.
+        Buffer += BytesToSend;
+        Remaining -= BytesToSend;
+    } while((Remaining > 0) && (p_Socket->isConnected));
 
-    return Error;
+    return SIM70XX_ERR_OK;
 }
 
 SIM70XX_Error_t SIM7080_TCP_Client_Receive(SIM7080_t& p_Device, SIM7080_TCP_Socket_t* p_Socket, uint32_t Length, std::string* p_Buffer)
@@ -228,25 +221,29 @@ SIM70XX_Error_t SIM7080_TCP_Client_Receive(SIM7080_t& p_Device, SIM7080_TCP_Sock
     }
     else if((p_Socket->isDataReceived == false) || (Length == 0))
     {
+        p_Buffer->clear();
+
         return SIM70XX_ERR_OK;
     }
 
-    // We have to use the event queue here, because payload can contain CR and LF which will lead to wrong results when we use the normal way here.
-    vTaskSuspend(p_Device.Internal.TaskHandle);
+    // The payload can contain CR and LF. So the payload is received as raw data and written directly into the buffer.
+    p_Buffer->resize(Length);
+
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CARECV(p_Socket->CID, Length);
-    SIM70XX_UART_SendLine(p_Device.UART, Command->Command);
-    delete Command;
-    vTaskResume(p_Device.Internal.TaskHandle);
-
-    while(SIM70XX_Queue_isEvent(p_Device.Internal.EventQueue, "+CARECV" , p_Buffer) == false)
+    SIM70XX_Queue_SetRxData(Command, "+CARECV: ", &(*p_Buffer)[0], Length);
+    Command->Timeout += SIM70XX_Tools_GetTransferTime(p_Device.UART.Baudrate, Length);
+    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
-        vTaskDelay(100 / portTICK_PERIOD_MS);
+        p_Buffer->clear();
+
+        return SIM70XX_ERR_FAIL;
     }
 
-    SIM70XX_Tools_SubstringSplitErase(p_Buffer);
+    p_Buffer->resize(Command->RawLength);
 
-    return SIM70XX_ERR_OK;
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7080_TCP_Client_Destroy(SIM7080_t& p_Device, SIM7080_TCP_Socket_t* p_Socket)
@@ -273,11 +270,11 @@ SIM70XX_Error_t SIM7080_TCP_Client_Destroy(SIM7080_t& p_Device, SIM7080_TCP_Sock
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7020_AT_CACLOSE(p_Socket->CID);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     p_Socket->isConnected = false;
     p_Socket->isCreated = false;
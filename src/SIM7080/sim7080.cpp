@@ -24,8 +24,12 @@
 #include <esp_log.h>
 
 #include "sim7080.h"
+#include "Events/sim7080_evt.h"
 #include "../Private/UART/sim70xx_uart.h"
+#include "../Private/UART/sim70xx_baud.h"
 #include "../Private/Events/sim70xx_evt.h"
+#include "../Private/Events/sim70xx_urc.h"
+#include "../Private/Events/sim70xx_mailbox.h"
 #include "../Private/Queue/sim70xx_queue.h"
 #include "../Private/Commands/sim7080_commands.h"
 
@@ -44,29 +48,37 @@ SIM70XX_Error_t SIM7080_Init(SIM7080_t& p_Device, const SIM7080_Config_t& p_Conf
 SIM70XX_Error_t SIM7080_Init(SIM7080_t& p_Device, const SIM7080_Config_t& p_Config, uint32_t Timeout, SIM70XX_Baud_t Old)
 {
     std::string Response;
+    SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized)
     {
         SIM7080_Deinit(p_Device);
     }
 
-    p_Device.Internal.RxQueue = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(SIM70XX_CmdResp_t*));
-    p_Device.Internal.TxQueue = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(SIM70XX_TxCmd_t*));
-    p_Device.Internal.EventQueue = xQueueCreate(CONFIG_SIM70XX_QUEUE_LENGTH, sizeof(std::string*));
-    if((p_Device.Internal.RxQueue == NULL) || (p_Device.Internal.TxQueue == NULL) || (p_Device.Internal.EventQueue == NULL))
-    {
-        return SIM70XX_ERR_NO_MEM;
-    }
+    SIM70XX_Queue_Init();
+    SIM70XX_Mailbox_Init();
+
+    // Register the URC handlers of the device. The protocol modules register their handlers when a socket is created.
+    SIM70XX_ERROR_CHECK(SIM70XX_URC_Register("NORMAL POWER DOWN", SIM7080_Evt_on_PowerDown));
+    SIM70XX_ERROR_CHECK(SIM70XX_Mailbox_Register("SMS Ready", false));
+
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_Create(&p_Device.Internal.TxQueue));
 
     p_Device.UART.Interface = p_Config.UART.Interface;
     p_Device.UART.Rx = p_Config.UART.Rx;
     p_Device.UART.Tx = p_Config.UART.Tx;
+    p_Device.UART.Rts = p_Config.UART.Rts;
+    p_Device.UART.Cts = p_Config.UART.Cts;
+    p_Device.UART.isFlowControl = p_Config.UART.isFlowControl;
     p_Device.UART.Baudrate = p_Config.UART.Baudrate;
 
-    SIM70XX_ERROR_CHECK(SIM70XX_UART_Init(p_Device.UART));
+    // Start with the default baudrate of the module when the baudrate should be selected automatically.
+    if(p_Device.UART.Baudrate == SIM_BAUD_AUTO)
+    {
+        p_Device.UART.Baudrate = SIM_BAUD_115200;
+    }
 
-    // Get all remaining available data to clear the Rx buffer.
-    SIM70XX_UART_Flush(p_Device.UART);
+    SIM70XX_ERROR_CHECK(SIM70XX_UART_Init(p_Device.UART));
 
     // No receive task started yet. Start the receive task.
     SIM70XX_ERROR_CHECK(SIM70XX_Evt_StartTask(&p_Device.Internal.TaskHandle, std::addressof(p_Device)));
@@ -88,12 +100,58 @@ SIM70XX_Error_t SIM7080_Init(SIM7080_t& p_Device, const SIM7080_Config_t& p_Conf
             return Error;
         }*/
     }
+    else if(p_Config.UART.Baudrate == SIM_BAUD_AUTO)
+    {
+        ESP_LOGI(TAG, "Select baudrate...");
+
+        SIM70XX_ERROR_CHECK(SIM70XX_Baud_Auto(&p_Device));
+    }
 
 	SIM70XX_ERROR_CHECK(SIM7080_SoftReset(p_Device, Timeout));
 
-    vTaskSuspend(p_Device.Internal.TaskHandle);
-    SIM70XX_Tools_DisableEcho(p_Device.UART);
-    vTaskResume(p_Device.Internal.TaskHandle);
+    // Disable the command echo.
+    SIM70XX_CREATE_CMD(Command);
+    *Command = SIM70XX_AT_ATE0;
+    SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
+    {
+        return SIM70XX_ERR_FAIL;
+    }
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
+
+    // Enable the RTS/CTS flow control of the module first and then the flow control of the ESP32.
+    // NOTE: The setting of the module is not stored and must be set again after each reset.
+    if(p_Device.UART.isFlowControl)
+    {
+        SIM70XX_Error_t Error;
+
+        SIM70XX_CREATE_CMD(Command);
+        *Command = SIM70XX_AT_IFC(2, 2);
+        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+        if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
+        {
+            return SIM70XX_ERR_FAIL;
+        }
+        SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
+
+        // Disable the flow control of the module again when the flow control of the ESP32 can not be enabled. Otherwise the module
+        // stops the transmission, because the RTS signal is never set by the ESP32.
+        Error = SIM70XX_UART_SetFlowControl(p_Device.UART, true);
+        if(Error != SIM70XX_ERR_OK)
+        {
+            ESP_LOGE(TAG, "Can not enable the flow control! Disable the flow control of the module...");
+
+            SIM70XX_CREATE_CMD(Command);
+            *Command = SIM70XX_AT_IFC(0, 0);
+            SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
+            if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout))
+            {
+                SIM70XX_Queue_PopItem(Command);
+            }
+
+            return Error;
+        }
+    }
 
     SIM70XX_ERROR_CHECK(SIM7080_Ping(p_Device));
     SIM70XX_ERROR_CHECK(SIM7080_GetFunctionality(p_Device));
@@ -132,11 +190,11 @@ void SIM7080_Deinit(SIM7080_t& p_Device)
     vTaskSuspend(p_Device.Internal.TaskHandle);
     vTaskDelete(p_Device.Internal.TaskHandle);
     p_Device.Internal.TaskHandle = NULL;
+    p_Device.UART.Consumer = NULL;
 
     // Delete the message queues.
-    vQueueDelete(p_Device.Internal.RxQueue);
-    vQueueDelete(p_Device.Internal.TxQueue);
-    vQueueDelete(p_Device.Internal.EventQueue);
+    SIM70XX_Queue_Delete(&p_Device.Internal.TxQueue);
+    vQueueDelete(p_Device.Internal.QueueSet);
 
     // TODO: Shutdown modem
 
@@ -147,38 +205,29 @@ void SIM7080_Deinit(SIM7080_t& p_Device)
 SIM70XX_Error_t SIM7080_SoftReset(SIM7080_t& p_Device, uint32_t Timeout)
 {
     uint32_t Now;
-    std::string Response;
 
     if(p_Device.Internal.isInitialized == false)
     {
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
-    else if(p_Device.Internal.TaskHandle != NULL)
-    {
-        vTaskSuspend(p_Device.Internal.TaskHandle);
-    }
 
     ESP_LOGI(TAG, "Performing soft reset...");
     Now = SIM70XX_Tools_GetmsTimer();
     do
     {
+        SIM70XX_TxCmd_t* Command;
+
         // Reset the module.
         // NOTE: Echo mode is enabled after a reset!
-        SIM70XX_UART_SendLine(p_Device.UART, "ATZ");
-        Response = SIM70XX_UART_ReadStringUntil(p_Device.UART);
-        Response = SIM70XX_UART_ReadStringUntil(p_Device.UART);
-        ESP_LOGI(TAG, "Response: %s", Response.c_str());
+        SIM70XX_CREATE_CMD(Command);
+        *Command = SIM70XX_AT_ATZ;
+        SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
 
         // Check if the reset was successful.
-        if(Response.find("OK") != std::string::npos)
+        if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) && (SIM70XX_Queue_PopItem(Command) == SIM70XX_ERR_OK))
         {
             ESP_LOGI(TAG, "     Software reset successful!");
 
-            if(p_Device.Internal.TaskHandle != NULL)
-            {
-                vTaskResume(p_Device.Internal.TaskHandle);
-            }
-
             return SIM70XX_ERR_OK;
         }
 
@@ -187,11 +236,6 @@ SIM70XX_Error_t SIM7080_SoftReset(SIM7080_t& p_Device, uint32_t Timeout)
 
     ESP_LOGE(TAG, "     Software reset timeout!");
 
-    if(p_Device.Internal.TaskHandle != NULL)
-    {
-        vTaskResume(p_Device.Internal.TaskHandle);
-    }
-
     return SIM70XX_ERR_FAIL;
 }
 
@@ -259,7 +303,6 @@ SIM70XX_Error_t SIM7080_IP_ManualAPN(SIM7080_t& p_Device, SIM70XX_APN_t APN, uin
 
 SIM70XX_Error_t SIM7080_SetOperator(SIM7080_t& p_Device, SIM70XX_OpMode_t Mode, SIM70XX_OpForm_t Format, std::string Operator, SIM7080_AcT_t AcT)
 {
-    std::string CommandStr;
     SIM70XX_TxCmd_t* Command;
 
     if(p_Device.Internal.isInitialized == false)
@@ -267,22 +310,22 @@ SIM70XX_Error_t SIM7080_SetOperator(SIM7080_t& p_Device, SIM70XX_OpMode_t Mode,
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
 
-    CommandStr = "AT+COPS=" + std::to_string(Mode);
-
+    SIM70XX_CREATE_CMD(Command);
     if((Mode == SIM_MODE_MANUAL) || (Mode == SIM_MODE_BOTH))
     {
-        CommandStr += "," + std::to_string(Format) + ",\"" + Operator + "\"" + "," + std::to_string(AcT);
+        *Command = SIM7080_AT_COPS_W_OPERATOR(Mode, Format, Operator, AcT);
+    }
+    else
+    {
+        *Command = SIM7080_AT_COPS_W(Mode);
     }
-
-    SIM70XX_CREATE_CMD(Command);
-    *Command = SIM7080_AT_COPS_W(CommandStr);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7080_GetCurrentOperator(SIM7080_t& p_Device)
@@ -297,12 +340,12 @@ SIM70XX_Error_t SIM7080_GetCurrentOperator(SIM7080_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_COPS_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
-    return SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue);
+    return SIM70XX_Queue_PopItem(Command);
 }
 
 SIM70XX_Error_t SIM7080_SetBandConfig(SIM7080_t& p_Device, SIM7080_Mode_t Mode, std::vector<uint8_t> Bands)
@@ -334,11 +377,11 @@ SIM70XX_Error_t SIM7080_SetBandConfig(SIM7080_t& p_Device, SIM7080_Mode_t Mode,
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CBANDCFG_W(ModeStr, Bandlist);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     return SIM70XX_ERR_OK;
 }
@@ -361,11 +404,11 @@ SIM70XX_Error_t SIM7080_GetBandConfig(SIM7080_t& p_Device, SIM7080_Mode_t Mode,
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CBANDCFG_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     return SIM70XX_ERR_OK;
 }
@@ -382,11 +425,11 @@ SIM70XX_Error_t SIM7080_SetBand(SIM7080_t& p_Device, SIM7080_Band_t Band)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CBAND_W(Band);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     return SIM70XX_ERR_OK;
 }
@@ -412,11 +455,11 @@ SIM70XX_Error_t SIM7080_GetBand(SIM7080_t& p_Device, SIM7080_Band_t* p_Band)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CBAND_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     if(Response.find("EGSM_MODE") != std::string::npos)
     {
@@ -452,11 +495,11 @@ SIM70XX_Error_t SIM7080_SetNetMode(SIM7080_t& p_Device, SIM7080_NetMode_t Mode)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CNMP_W(Mode);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     return SIM70XX_ERR_OK;
 }
@@ -482,11 +525,11 @@ SIM70XX_Error_t SIM7080_GetNetMode(SIM7080_t& p_Device, SIM7080_NetMode_t* p_Mod
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CNMP_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     *p_Mode = (SIM7080_NetMode_t)std::stoi(Response);
 
@@ -507,11 +550,11 @@ SIM70XX_Error_t SIM7080_SetSelectedMode(SIM7080_t& p_Device, SIM7080_Mode_t Mode
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CMNB_W(Mode);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command));
 
     return SIM70XX_ERR_OK;
 }
@@ -537,11 +580,11 @@ SIM70XX_Error_t SIM7080_GetSelectedMode(SIM7080_t& p_Device, SIM7080_Mode_t* p_M
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM7080_AT_CMNB_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     *p_Mode = (SIM7080_Mode_t)std::stoi(Response);
 
@@ -566,16 +609,18 @@ SIM70XX_Error_t SIM7080_SetFunctionality(SIM7080_t& p_Device, SIM7080_Func_t Fun
         return SIM70XX_ERR_OK;
     }
 
+    SIM70XX_Mailbox_Flush("SMS Ready", SIM70XX_MAILBOX_NO_ID);
+
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CFUN_W(Func, Reset);
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
 
     // NOTE: Do not use the error macro, because the response and status depends on the current state of the device.
-    Error = SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response, &Status);
+    Error = SIM70XX_Queue_PopItem(Command, &Response, &Status);
 
     ESP_LOGI(TAG, "Response: %s", Response.c_str());
 
@@ -594,10 +639,7 @@ SIM70XX_Error_t SIM7080_SetFunctionality(SIM7080_t& p_Device, SIM7080_Func_t Fun
             Error = SIM70XX_ERR_OK;
         }
 
-        while(SIM70XX_Queue_isEvent(p_Device.Internal.EventQueue, "SMS Ready", &Response) == false)
-        {
-            vTaskDelay(100 / portTICK_PERIOD_MS);
-        }
+        SIM70XX_Mailbox_Wait("SMS Ready", SIM70XX_MAILBOX_NO_ID, &Response, portMAX_DELAY);
     }
     // Device is in full functionality -> Transition into another functionality
     //  Response = +APP PDP: 0,DEACTIVE
@@ -632,11 +674,11 @@ SIM70XX_Error_t SIM7080_GetFunctionality(SIM7080_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CFUN_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     p_Device.Connection.Functionality = (SIM7080_Func_t)std::stoi(Response);
 
@@ -662,11 +704,11 @@ SIM70XX_Error_t SIM7080_GetSIMStatus(SIM7080_t& p_Device, SIM7080_SIM_t* const p
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT_CPIN_R;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_FAIL;
     }
-    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue, &Response));
+    SIM70XX_ERROR_CHECK(SIM70XX_Queue_PopItem(Command, &Response));
 
     if(Response.find("READY") != std::string::npos)
     {
@@ -737,12 +779,12 @@ SIM70XX_Error_t SIM7080_Ping(SIM7080_t& p_Device)
     SIM70XX_CREATE_CMD(Command);
     *Command = SIM70XX_AT;
     SIM70XX_PUSH_QUEUE(p_Device.Internal.TxQueue, Command);
-    if(SIM70XX_Queue_Wait(p_Device.Internal.RxQueue, &p_Device.Internal.isActive, Command->Timeout) == false)
+    if(SIM70XX_Queue_Wait(Command, &p_Device.Internal.isActive, Command->Timeout) == false)
     {
         return SIM70XX_ERR_NOT_READY;
     }
 
-    if(SIM70XX_Queue_PopItem(p_Device.Internal.RxQueue) != SIM70XX_ERR_OK)
+    if(SIM70XX_Queue_PopItem(Command) != SIM70XX_ERR_OK)
     {
         return SIM70XX_ERR_NOT_READY;
     }
@@ -750,4 +792,22 @@ SIM70XX_Error_t SIM7080_Ping(SIM7080_t& p_Device)
     return SIM70XX_ERR_OK;
 }
 
+SIM70XX_Error_t SIM7080_AutoBaud(SIM7080_t& p_Device, SIM70XX_Baud_t* p_Baudrate)
+{
+    if(p_Device.Internal.isInitialized == false)
+    {
+        return SIM70XX_ERR_NOT_INITIALIZED;
+    }
+
+    return SIM70XX_Baud_Auto(&p_Device, p_Baudrate);
+}
+
+void SIM7080_GetStatistics(SIM7080_t& p_Device, SIM70XX_Statistics_t* p_Stats)
+{
+    SIM70XX_Queue_GetStatistics(p_Stats);
+    SIM70XX_Evt_GetStatistics(p_Stats);
+    SIM70XX_Mailbox_GetStatistics(p_Stats);
+    SIM70XX_UART_GetStatistics(p_Device.UART, p_Stats);
+}
+
 #endif
\ No newline at end of file
@@ -18,117 +18,306 @@
  */
 
 #include <esp_log.h>
-#include <esp_timer.h>
-
-#include <mbedtls/base64.h>
 
 #include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include <algorithm>
 
 #include "sim70xx_tools.h"
 #include "Private/UART/sim70xx_uart.h"
 #include "Private/GPIO/sim70xx_gpio.h"
+#include "Private/Port/sim70xx_port.h"
+#include "Private/Trace/sim70xx_trace.h"
 
 static const char* TAG = "SIM70XX_Tools";
 
-void SIM70XX_Tools_ASCII2Hex(const void* const p_Buffer, uint32_t Length, std::string* const p_Hex)
+/** @brief  Hex digits for the encoder.
+ */
+static const char _SIM70XX_Tools_HexDigits[] = "0123456789abcdef";
+
+/** @brief      Get the value of a hex digit.
+ *  @param c    Hex digit
+ *  @return     Value of the digit or -1 when the character isn´t a hex digit
+ */
+static inline int SIM70XX_Tools_HexValue(char c)
 {
-    char Buffer[3];
+    if((c >= '0') && (c <= '9'))
+    {
+        return c - '0';
+    }
+
+    // NOTE: Setting bit 5 converts upper case letters into lower case letters.
+    c |= 0x20;
+    if((c >= 'a') && (c <= 'f'))
+    {
+        return c - 'a' + 10;
+    }
+
+    return -1;
+}
+
+void SIM70XX_Tools_HexEncode(const void* const p_Buffer, size_t Length, char* const p_Hex)
+{
+    size_t i;
+    char* p_Out = p_Hex;
+    const uint8_t* p_Data = (const uint8_t*)p_Buffer;
 
     if((p_Buffer == NULL) || (p_Hex == NULL))
     {
         return;
     }
 
-    p_Hex->clear();
+    // Convert four bytes into eight characters with one 64 bit word. Each character uses one byte lane of the word and the lanes are
+    // stored in memory order. So lane 2 * n holds the high nibble and lane 2 * n + 1 holds the low nibble of input byte n.
+    for(i = 0; (i + 4) <= Length; i += 4)
+    {
+        uint64_t Word;
+        uint64_t Nibbles;
+        uint64_t Letters;
+
+        // Move each input byte into the low byte of a 16 bit lane.
+        Word = (uint64_t)p_Data[i] | ((uint64_t)p_Data[i + 1] << 16) | ((uint64_t)p_Data[i + 2] << 32) | ((uint64_t)p_Data[i + 3] << 48);
+
+        // Split each 16 bit lane into the high nibble (low byte) and the low nibble (high byte).
+        Nibbles = ((Word >> 4) & 0x000F000F000F000FULL) | ((Word & 0x000F000F000F000FULL) << 8);
+
+        // Lanes with a value above 9 get bit 4 set by adding 6. These lanes are moved from '0' + n to 'a' + n - 10 by adding 39.
+        // NOTE: No lane can overflow, because the largest value is 15 + 6 or 15 + '0' + 39.
+        Letters = ((Nibbles + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL;
+        Word = Nibbles + 0x3030303030303030ULL + (Letters * 39);
 
-    for(uint32_t i = 0; i < Length; i++)
+        for(uint32_t j = 0; j < 8; j++)
+        {
+            *p_Out++ = (char)(Word >> (8 * j));
+        }
+    }
+
+    for(; i < Length; i++)
     {
-        sprintf(Buffer, "%02x", ((uint8_t*)p_Buffer)[i]);
-        p_Hex->append(std::string(Buffer));
+        *p_Out++ = _SIM70XX_Tools_HexDigits[p_Data[i] >> 4];
+        *p_Out++ = _SIM70XX_Tools_HexDigits[p_Data[i] & 0x0F];
     }
 }
 
+SIM70XX_Error_t SIM70XX_Tools_HexDecode(const char* const p_Hex, size_t Length, uint8_t* const p_Buffer, size_t* p_Position)
+{
+    if((p_Hex == NULL) || (p_Buffer == NULL))
+    {
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    // An odd number of characters is rejected before the buffer is changed. The missing low digit is reported at the position after the last character.
+    if((Length % 2) != 0)
+    {
+        if(p_Position != NULL)
+        {
+            *p_Position = Length;
+        }
+
+        return SIM70XX_ERR_INVALID_ARG;
+    }
+
+    for(size_t i = 0; i < Length; i += 2)
+    {
+        int High;
+        int Low;
+
+        High = SIM70XX_Tools_HexValue(p_Hex[i]);
+        Low = SIM70XX_Tools_HexValue(p_Hex[i + 1]);
+        if((High < 0) || (Low < 0))
+        {
+            if(p_Position != NULL)
+            {
+                *p_Position = (High < 0) ? i : (i + 1);
+            }
+
+            return SIM70XX_ERR_INVALID_ARG;
+        }
+
+        p_Buffer[i / 2] = (uint8_t)((High << 4) | Low);
+    }
+
+    return SIM70XX_ERR_OK;
+}
+
+void SIM70XX_Tools_ASCII2Hex(const void* const p_Buffer, uint32_t Length, std::string* const p_Hex)
+{
+    if((p_Buffer == NULL) || (p_Hex == NULL))
+    {
+        return;
+    }
+
+    // NOTE: The string keeps its capacity. So no memory is allocated when the string is reused.
+    p_Hex->resize(2 * Length);
+    SIM70XX_Tools_HexEncode(p_Buffer, Length, &(*p_Hex)[0]);
+}
+
 void SIM70XX_Tools_Hex2ASCII(std::string Hex, uint8_t* const p_Buffer)
 {
-    uint8_t Offset;
-    uint8_t Low = 0;
-    uint8_t High = 0;
+    size_t Position;
 
-    if((p_Buffer == NULL) || ((Hex.size() % 2) != 0))
+    if(p_Buffer == NULL)
     {
         return;
     }
 
-    Offset = 0;
-    for(uint32_t i = 0; i < Hex.size(); i++)
+    if(SIM70XX_Tools_HexDecode(Hex.c_str(), Hex.size(), p_Buffer, &Position) != SIM70XX_ERR_OK)
+    {
+        ESP_LOGW(TAG, "Invalid hex character at position %u!", Position);
+    }
+}
+
+/** @brief  Alphabet for the Base64 encoder.
+ */
+static const char _SIM70XX_Tools_Base64Digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/** @brief          Convert a group of three bytes into four Base64 characters.
+ *  @param p_Data   Pointer to input bytes
+ *  @param p_Base64 Pointer to output characters
+ */
+static inline void SIM70XX_Tools_Base64Group(const uint8_t* p_Data, char* p_Base64)
+{
+    uint32_t Group;
+
+    Group = ((uint32_t)p_Data[0] << 16) | ((uint32_t)p_Data[1] << 8) | p_Data[2];
+    p_Base64[0] = _SIM70XX_Tools_Base64Digits[(Group >> 18) & 0x3F];
+    p_Base64[1] = _SIM70XX_Tools_Base64Digits[(Group >> 12) & 0x3F];
+    p_Base64[2] = _SIM70XX_Tools_Base64Digits[(Group >> 6) & 0x3F];
+    p_Base64[3] = _SIM70XX_Tools_Base64Digits[Group & 0x3F];
+}
+
+void SIM70XX_Tools_Base64Init(SIM70XX_Base64_t* p_Context)
+{
+    if(p_Context == NULL)
+    {
+        return;
+    }
+
+    p_Context->PendingLength = 0;
+}
+
+size_t SIM70XX_Tools_Base64Update(SIM70XX_Base64_t* p_Context, const void* const p_Buffer, size_t Length, char* const p_Base64)
+{
+    size_t i;
+    char* p_Out = p_Base64;
+    const uint8_t* p_Data = (const uint8_t*)p_Buffer;
+
+    if((p_Context == NULL) || (p_Buffer == NULL) || (p_Base64 == NULL))
     {
-        uint8_t Temp = 0;
+        return 0;
+    }
 
-        if((Hex.at(i) >= '0') && (Hex.at(i) <= '9'))
+    // Complete the pending group from the last call first.
+    i = 0;
+    if(p_Context->PendingLength > 0)
+    {
+        while((p_Context->PendingLength < 3) && (i < Length))
         {
-            Temp = (uint8_t)Hex.at(i) - 0x30;
+            p_Context->Pending[p_Context->PendingLength++] = p_Data[i++];
         }
-        else if((Hex.at(i) >= 'a') && (Hex.at(i) <= 'f'))
+
+        if(p_Context->PendingLength < 3)
         {
-            Temp = (uint8_t)Hex.at(i) - 'a' + 10;
+            return 0;
         }
-        else if((Hex.at(i) >= 'A') && (Hex.at(i) <= 'F'))
+
+        SIM70XX_Tools_Base64Group(p_Context->Pending, p_Out);
+        p_Out += 4;
+        p_Context->PendingLength = 0;
+    }
+
+    for(; (i + 3) <= Length; i += 3)
+    {
+        SIM70XX_Tools_Base64Group(&p_Data[i], p_Out);
+        p_Out += 4;
+    }
+
+    // Store the remaining bytes for the next call.
+    while(i < Length)
+    {
+        p_Context->Pending[p_Context->PendingLength++] = p_Data[i++];
+    }
+
+    return p_Out - p_Base64;
+}
+
+size_t SIM70XX_Tools_Base64Final(SIM70XX_Base64_t* p_Context, char* const p_Base64)
+{
+    if((p_Context == NULL) || (p_Base64 == NULL) || (p_Context->PendingLength == 0))
+    {
+        return 0;
+    }
+
+    // Fill the missing bytes with zeros and replace the characters, which are only containing padding bits.
+    memset(&p_Context->Pending[p_Context->PendingLength], 0, 3 - p_Context->PendingLength);
+    SIM70XX_Tools_Base64Group(p_Context->Pending, p_Base64);
+    p_Base64[3] = '=';
+    if(p_Context->PendingLength == 1)
+    {
+        p_Base64[2] = '=';
+    }
+
+    p_Context->PendingLength = 0;
+
+    return 4;
+}
+
+size_t SIM70XX_Tools_GetEncodedLength(SIM70XX_Encoding_t Encoding, size_t Length)
+{
+    switch(Encoding)
+    {
+        case SIM70XX_ENC_HEX:
         {
-            Temp = (uint8_t)Hex.at(i) - 'A' + 10;
+            return 2 * Length;
         }
-
-        // Save the high byte.
-        if((i % 2) == 0)
+        case SIM70XX_ENC_BASE64:
         {
-            High = Temp;
+            return SIM70XX_TOOLS_BASE64_LENGTH(Length);
         }
-        // Save the low byte and push the result to the string.
-        else
+        default:
         {
-            Low = Temp;
-
-            *(p_Buffer + (Offset++)) = (High << 0x04) + Low;
+            return Length;
         }
     }
 }
 
 bool SIM70XX_Tools_ToBase64(const void* const p_Buffer, uint32_t Length, std::string* const p_Base64)
 {
-    size_t EncodeLength;
-    unsigned char* OutputBuffer = NULL;
+    size_t Written;
+    SIM70XX_Base64_t Context;
 
     if((p_Buffer == NULL) || (p_Base64 == NULL))
     {
         return false;
     }
 
-    p_Base64->clear();
+    // NOTE: The string is used as output buffer. So no temporary buffer is needed.
+    p_Base64->resize(SIM70XX_TOOLS_BASE64_LENGTH(Length));
 
-    // Get the size for memory allocation first.
-    mbedtls_base64_encode(OutputBuffer, 0, &EncodeLength, (const unsigned char*)p_Buffer, Length);
+    SIM70XX_Tools_Base64Init(&Context);
+    Written = SIM70XX_Tools_Base64Update(&Context, p_Buffer, Length, &(*p_Base64)[0]);
+    Written += SIM70XX_Tools_Base64Final(&Context, &(*p_Base64)[Written]);
+    p_Base64->resize(Written);
 
-    ESP_LOGI(TAG, "Payload length: %u", Length);
-    ESP_LOGI(TAG, "Allocate %u bytes...", EncodeLength);
-    OutputBuffer = (unsigned char*)malloc(sizeof(unsigned char) * EncodeLength);
-    if(OutputBuffer == NULL)
-    {
-        ESP_LOGE(TAG, "Can not allocate memory!");
+    return true;
+}
 
-        return false;
+uint32_t SIM70XX_Tools_GetTransferTime(SIM70XX_Baud_t Baudrate, size_t Length)
+{
+    // The module starts with the default baud rate when the baud rate is selected automatically.
+    if(Baudrate == SIM_BAUD_AUTO)
+    {
+        Baudrate = SIM_BAUD_115200;
     }
 
-    // Encode the data.
-    mbedtls_base64_encode(OutputBuffer, EncodeLength, &EncodeLength, (const unsigned char*)p_Buffer, Length);
-    p_Base64->append(std::string((char*)OutputBuffer));
-
-    free(OutputBuffer);
-
-    return true;
+    return ((uint64_t)Length * 10 + Baudrate - 1) / Baudrate;
 }
 
-unsigned long IRAM_ATTR SIM70XX_Tools_GetmsTimer(void)
+unsigned long SIM70XX_Tools_GetmsTimer(void)
 {
-    return (unsigned long)(esp_timer_get_time() / 1000ULL);
+    return SIM70XX_Port_GetmsTimer();
 }
 
 bool SIM70XX_Tools_EnableModule(SIM70XX_UART_Conf_t& p_Config, uint8_t Cycles)
@@ -177,6 +366,7 @@ bool SIM70XX_Tools_isActive(SIM70XX_UART_Conf_t& p_Config)
     bool Result;
     std::string Response;
 
+    // NOTE: The interface is used directly. This fails when the communication task of a driver is using the interface.
     if((SIM70XX_UART_Init(p_Config) != SIM70XX_ERR_OK) || (SIM70XX_UART_SendLine(p_Config, "AT") != SIM70XX_ERR_OK))
     {
         return false;
@@ -213,6 +403,11 @@ SIM70XX_Error_t SIM70XX_Tools_DisableEcho(SIM70XX_UART_Conf_t& p_Config)
     {
         return SIM70XX_ERR_NOT_INITIALIZED;
     }
+    // The communication task is the only consumer of the receive buffer. Use the command queue instead.
+    else if(SIM70XX_UART_isConsumer(p_Config) == false)
+    {
+        return SIM70XX_ERR_INVALID_STATE;
+    }
 
     // Check if echo mode is enabled. With echo mode enable the answer will have the following format:
     //  AT<CR><LF>
@@ -240,17 +435,87 @@ SIM70XX_Error_t SIM70XX_Tools_DisableEcho(SIM70XX_UART_Conf_t& p_Config)
 std::string SIM70XX_Tools_SubstringSplitErase(std::string* p_Input, std::string Delimiter)
 {
     size_t Index;
-    std::string Result = *p_Input;
+    std::string Result;
 
     assert(p_Input);
 
-    Index = p_Input->find(",");
-    if(Index != std::string::npos)
+    Index = p_Input->find(Delimiter);
+    if(Index == std::string::npos)
     {
-        Result = p_Input->substr(0, Index);
+        Result.swap(*p_Input);
+
+        return Result;
     }
 
-    p_Input->erase(0, Index + 1);
+    Result = p_Input->substr(0, Index);
+    p_Input->erase(0, Index + Delimiter.size());
 
     return Result;
-}
\ No newline at end of file
+}
+
+uint32_t SIM70XX_Tools_GetLatencyPercentile(const SIM70XX_Statistics_t& p_Stats, uint8_t Percent)
+{
+    uint64_t Target;
+    uint64_t Count;
+
+    if((p_Stats.Commands == 0) || (Percent > 100))
+    {
+        return 0;
+    }
+
+    Target = ((uint64_t)p_Stats.Commands * Percent + 99) / 100;
+    Count = 0;
+    for(uint32_t i = 0; i < (SIM70XX_STATS_LATENCY_BUCKETS - 1); i++)
+    {
+        Count += p_Stats.Latency[i];
+        if(Count >= Target)
+        {
+            return std::min((uint32_t)((1UL << i) - 1), p_Stats.LatencyMax);
+        }
+    }
+
+    return p_Stats.LatencyMax;
+}
+
+size_t SIM70XX_Tools_GetTrace(SIM70XX_Trace_Entry_t* p_Entries, size_t Count, size_t Offset)
+{
+    return SIM70XX_Trace_Read(Offset, p_Entries, Count);
+}
+
+void SIM70XX_Tools_PrintTrace(void)
+{
+    size_t Offset;
+    size_t Count;
+    SIM70XX_Trace_Entry_t Entries[16];
+
+    // NOTE: The dump uses a fixed line prefix, so the decoder can find the lines in a console log with other messages.
+    printf("SIM70XX-TRACE BEGIN %u\n", (unsigned int)sizeof(SIM70XX_Trace_Entry_t));
+
+    Offset = 0;
+    do
+    {
+        Count = SIM70XX_Trace_Read(Offset, Entries, sizeof(Entries) / sizeof(Entries[0]));
+        for(size_t i = 0; i < Count; i++)
+        {
+            const uint8_t* p_Data = (const uint8_t*)&Entries[i];
+
+            printf("SIM70XX-TRACE ");
+            for(size_t j = 0; j < sizeof(SIM70XX_Trace_Entry_t); j++)
+            {
+                printf("%02x", p_Data[j]);
+            }
+            printf("\n");
+        }
+
+        Offset += Count;
+    } while(Count > 0);
+
+    printf("SIM70XX-TRACE END\n");
+}
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+    SIM70XX_Error_t SIM70XX_Tools_SetHostDevice(uart_port_t Interface, int FD)
+    {
+        return SIM70XX_Port_POSIX_SetDevice(Interface, FD);
+    }
+#endif
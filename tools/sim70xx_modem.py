@@ -0,0 +1,536 @@
+#!/usr/bin/env python3
+#
+# sim70xx_modem.py
+#
+#  Copyright (C) Daniel Kampert, 2022
+#  Website: www.kampis-elektroecke.de
+#  File info: Scriptable SIM7020 / SIM7080 modem simulator for host tests and benchmarks of the SIM70XX driver.
+#
+# Usage:
+#   sim70xx_modem.py --pty                                  Create a pseudo terminal and print the path (use it with CONFIG_SIM70XX_PORT_POSIX_DEVICE)
+#   sim70xx_modem.py --fd 3                                 Serve an inherited file descriptor (i.e. one end of a socket pair)
+#   sim70xx_modem.py --pty --device SIM7080 --script s.json Load additional rules from a script
+#   sim70xx_modem.py --pty --latency 20 --baudrate 115200   Answer each command after 20 ms and limit the output to 11520 bytes/s
+#   sim70xx_modem.py --pty --drop 0.01 --seed 1             Drop 1 % of the response lines
+#
+# Script layout (all keys are optional, command line options override the script):
+#   {
+#       "device": "SIM7020",
+#       "latency": 5, "jitter": 1, "baudrate": 115200,
+#       "faults": {"drop": 0.0, "corrupt": 0.0, "error": 0.0, "noise": 0.0, "seed": 1},
+#       "http": {"code": 200, "body": "Hello", "frame": 512},
+#       "rules": [
+#           {"match": "AT\\+CSOSEND=(\\d+),.*", "reply": [], "status": "OK", "urc": [{"delay": 10, "line": "+CSOERR: {1},4"}]},
+#           {"match": "AT\\+CASEND=(\\d+),(\\d+),.*", "prompt": "> ", "length": 2, "urc": [{"delay": 5, "line": "+CADATAIND: {1}"}]},
+#           {"match": "AT\\+CGMR", "reply": ["+CGMR: 1351B01SIM7080"], "count": 1, "delay": 100},
+#           {"match": "AT\\+CSQ", "fault": "drop"}
+#       ],
+#       "urc": [{"at": 1000, "line": "+CSOERR: 0,1"}, {"every": 5000, "line": "+CEREG: 1"}]
+#   }
+#
+#   A rule matches the complete command line. The lines can use the groups of the match with {1}, {2}, ...
+#   Rules of the script are checked before the built-in device model. "count" limits the number of matches of a rule.
+#   "prompt" starts a raw data transfer with the number of bytes given by the group "length" or by "bytes". The lines of "after"
+#   and the status are sent after the raw data.
+#   "fault" is one of "drop" (no response), "error" (ERROR as status) or "noise" (garbage before the response).
+#
+
+import argparse
+import heapq
+import json
+import os
+import random
+import re
+import select
+import sys
+import time
+
+class Rule:
+    def __init__(self, Config):
+        self.Pattern = re.compile(Config["match"])
+        self.Reply = Config.get("reply", [])
+        self.Status = Config.get("status", "OK")
+        self.Prompt = Config.get("prompt")
+        self.Length = Config.get("length")
+        self.Bytes = Config.get("bytes", 0)
+        self.After = Config.get("after", [])
+        self.Urc = Config.get("urc", [])
+        self.Delay = Config.get("delay")
+        self.Fault = Config.get("fault")
+        self.Count = Config.get("count")
+
+class Modem:
+    def __init__(self, FD, Options, Script):
+        self.FD = FD
+        self.Device = Options.device or Script.get("device", "SIM7020")
+        self.Latency = Options.latency if Options.latency is not None else Script.get("latency", 0)
+        self.Jitter = Options.jitter if Options.jitter is not None else Script.get("jitter", 0)
+        self.Baudrate = Options.baudrate if Options.baudrate is not None else Script.get("baudrate", 0)
+        self.Verbose = Options.verbose
+
+        Faults = Script.get("faults", {})
+        self.Faults = {}
+        for Name in ["drop", "corrupt", "error", "noise"]:
+            Value = getattr(Options, Name)
+            self.Faults[Name] = Value if Value is not None else Faults.get(Name, 0.0)
+        self.Random = random.Random(Options.seed if Options.seed is not None else Faults.get("seed"))
+
+        self.Http = {"code": 200, "body": "", "frame": 512}
+        self.Http.update(Script.get("http", {}))
+
+        self.Rules = [Rule(Config) for Config in Script.get("rules", [])]
+        self.Model = self.SIM7080_Model() if self.Device == "SIM7080" else self.SIM7020_Model()
+
+        self.Echo = True
+        self.Functionality = 1
+        self.Input = bytearray()
+        self.Output = bytearray()
+        self.Raw = None
+        self.isRawPending = False
+        self.Events = []
+        self.Sequence = 0
+        self.Credit = 0.0
+        self.LastTime = time.monotonic()
+        self.Start = self.LastTime
+
+        # Socket state of the protocol models.
+        self.Sockets = {}
+        self.Subscriptions = {}
+        self.Files = {}
+        self.HttpNext = 0
+        self.HttpSocket = None
+        self.MqttNext = 0
+
+        for Config in Script.get("urc", []):
+            if "every" in Config:
+                self.Schedule(Config.get("at", Config["every"]) / 1000.0, self.Periodic, Config)
+            else:
+                self.Schedule(Config.get("at", 0) / 1000.0, self.Send, [Config["line"]], None)
+
+    def Log(self, Direction, Data):
+        if self.Verbose:
+            sys.stderr.write("{:10.3f} {} {!r}\n".format(time.monotonic() - self.Start, Direction, bytes(Data)))
+
+    def Schedule(self, Delay, Function, *Args):
+        self.Sequence += 1
+        heapq.heappush(self.Events, (time.monotonic() + Delay, self.Sequence, Function, Args))
+
+    def Periodic(self, Config):
+        self.Send([Config["line"]], None)
+        self.Schedule(Config["every"] / 1000.0, self.Periodic, Config)
+
+    def GetLatency(self):
+        return max(0.0, self.Latency + self.Random.uniform(-self.Jitter, self.Jitter)) / 1000.0
+
+    def Write(self, Data):
+        self.Output += Data
+
+    def Send(self, Lines, Status, Fault = None):
+        """ Write the response lines and the status of a command with the response format <CR><LF>Line<CR><LF>. """
+        if (Fault == "noise") or (self.Random.random() < self.Faults["noise"]):
+            self.Write(b"\r\n\x07#%&NOISE\r\n")
+
+        if (Status == "OK") and ((Fault == "error") or (self.Random.random() < self.Faults["error"])):
+            Status = "ERROR"
+
+        for Line in Lines + ([Status] if Status is not None else []):
+            if (Fault == "drop") or (self.Random.random() < self.Faults["drop"]):
+                self.Log("DROP", Line.encode())
+                continue
+
+            Data = bytearray(b"\r\n" + Line.encode() + b"\r\n")
+            if self.Random.random() < self.Faults["corrupt"]:
+                Data[self.Random.randrange(2, len(Data) - 2)] ^= 0x20
+
+            self.Write(Data)
+
+    def Respond(self, Lines, Status = "OK", Delay = None, Fault = None):
+        self.Schedule(self.GetLatency() if Delay is None else Delay / 1000.0, self.Send, Lines, Status, Fault)
+
+    def Urc(self, Line, Delay = 0):
+        self.Schedule((Delay / 1000.0) + self.GetLatency(), self.Send, [Line], None)
+
+    def StartRaw(self, Prompt, Length, Done):
+        """ Send the prompt of a raw data transfer and receive the given number of bytes. """
+        def Begin():
+            # NOTE: The "> " prompt isn´t terminated with a line end.
+            self.Write(b"\r\n" + Prompt.encode() + (b"" if Prompt.startswith(">") else b"\r\n"))
+            self.Raw = [Length, bytearray(), Done]
+            self.isRawPending = False
+            if Length == 0:
+                self.Raw = None
+                Done(bytearray())
+
+            self.Process()
+
+        # Commands which are received before the prompt are processed after the raw data transfer.
+        self.isRawPending = True
+        self.Schedule(self.GetLatency(), Begin)
+
+    # Built-in device models. Each entry is a pattern and a handler for the match.
+    def Common_Model(self):
+        return [
+            (r"AT", lambda m: self.Respond([])),
+            (r"ATZ", self.on_Reset),
+            (r"ATE([01])", self.on_Echo),
+            (r"AT&W", lambda m: self.Respond([])),
+            (r"AT\+IFC=.*", lambda m: self.Respond([])),
+            (r"AT\+IPR=.*", lambda m: self.Respond([])),
+            (r"AT\+CFUN\?", lambda m: self.Respond(["+CFUN: {}".format(self.Functionality)])),
+            (r"AT\+CFUN=(\d+)(,\d+)?", self.on_Functionality),
+            (r"AT\+CBAND=.*", lambda m: self.Respond([])),
+            (r"AT\+CBAND\?", lambda m: self.Respond(["+CBAND: 8"])),
+            (r"AT\+CPIN\?", lambda m: self.Respond(["+CPIN: READY"])),
+            (r"AT\+CGATT\?", lambda m: self.Respond(["+CGATT: 1"])),
+            (r"AT\+CSQ", lambda m: self.Respond(["+CSQ: 20,0"])),
+            (r"AT\+CGREG\?", lambda m: self.Respond(["+CGREG: 0,1"])),
+            (r"AT\+CEREG\?", lambda m: self.Respond(["+CEREG: 0,1"])),
+            (r"AT\+COPS=.*", lambda m: self.Respond([])),
+            (r"AT\+CGMI", lambda m: self.Respond(["SIMCOM_Ltd"])),
+            (r"AT\+CGMM", lambda m: self.Respond([self.Device])),
+            (r"AT\+CGMR", lambda m: self.Respond(["Revision:1752B10SIM" + self.Device[3:]])),
+            (r"AT\+CGSN", lambda m: self.Respond(["866000000000000"])),
+            (r"AT\+CIMI", lambda m: self.Respond(["262000000000000"])),
+            (r"AT\+CCID", lambda m: self.Respond(["89490000000000000000"])),
+        ]
+
+    def SIM7020_Model(self):
+        return self.Common_Model() + [
+            (r"AT\+CPSMS=.*", lambda m: self.Respond([])),
+            (r"AT\+CSOC=.*", self.on_SIM7020_Socket),
+            (r"AT\+CSOCON=(\d+),.*", lambda m: self.Respond([])),
+            (r"AT\+CSOSEND=(\d+),.*", lambda m: self.Respond([])),
+            (r"AT\+CSOCL=(\d+)", lambda m: self.Respond([])),
+            (r"AT\+CHTTPCREATE=.*", self.on_HTTP_Create),
+            (r"AT\+CHTTPCON=(\d+)", lambda m: self.Respond([])),
+            (r"AT\+CHTTPSEND=(\d+),.*", lambda m: self.on_HTTP_Request(int(m.group(1)))),
+            (r"AT\+CHTTPSENDEXT=(\d+),(\d+),(\d+),(.*)", self.on_HTTP_SendExt),
+            (r"AT\+CHTTPDISCON=(\d+)", lambda m: self.Respond([])),
+            (r"AT\+CHTTPDESTROY=(\d+)", lambda m: self.Respond([])),
+            (r"AT\+CMQNEW=.*", self.on_MQTT_New),
+            (r"AT\+CMQCON=.*", lambda m: self.Respond([])),
+            (r"AT\+CMQSUB=(\d+),\"([^\"]*)\",(\d+)", self.on_MQTT_Subscribe),
+            (r"AT\+CMQUNSUB=(\d+),\"([^\"]*)\"", self.on_MQTT_Unsubscribe),
+            (r"AT\+CMQPUB=(\d+),\"([^\"]*)\",(\d+),(\d+),(\d+),(\d+),\"([0-9A-Fa-f]*)\"", self.on_MQTT_Publish),
+            (r"AT\+CMQDISCON=(\d+)", lambda m: self.Respond([])),
+        ]
+
+    def SIM7080_Model(self):
+        return self.Common_Model() + [
+            (r"AT\+CNMP=.*", lambda m: self.Respond([])),
+            (r"AT\+CMNB=.*", lambda m: self.Respond([])),
+            (r"AT\+CBANDCFG=.*", lambda m: self.Respond([])),
+            (r"AT\+CNACT=(\d+),(\d+)", self.on_PDP_Action),
+            (r"AT\+CFSINIT", lambda m: self.Respond([])),
+            (r"AT\+CFSTERM", lambda m: self.Respond([])),
+            (r"AT\+CFSGFRS\?", lambda m: self.Respond(["+CFSGFRS: 241664"])),
+            (r"AT\+CFSWFILE=(\d+),\"([^\"]*)\",(\d+),(\d+),(\d+)", self.on_FS_Write),
+            (r"AT\+CFSRFILE=(\d+),\"([^\"]*)\",(\d+),(\d+),(\d+)", self.on_FS_Read),
+            (r"AT\+CFSGFIS=(\d+),\"([^\"]*)\"", lambda m: self.Respond(["+CFSGFIS: {}".format(len(self.Files.get(m.group(2), b"")))])),
+            (r"AT\+CFSDFILE=(\d+),\"([^\"]*)\"", self.on_FS_Delete),
+            (r"AT\+CAOPEN=(\d+),(\d+),.*", self.on_TCP_Open),
+            (r"AT\+CASEND=(\d+),(\d+)(,\d+)?", self.on_TCP_Send),
+            (r"AT\+CARECV=(\d+),(\d+)", self.on_TCP_Receive),
+            (r"AT\+CACLOSE=(\d+)", self.on_TCP_Close),
+        ]
+
+    def on_Reset(self, Match):
+        self.Echo = True
+        self.Respond([])
+
+    def on_Echo(self, Match):
+        self.Echo = (Match.group(1) == "1")
+        self.Respond([])
+
+    def on_Functionality(self, Match):
+        Func = int(Match.group(1))
+        Last = self.Functionality
+        self.Functionality = Func
+
+        if Last == Func:
+            self.Respond([])
+        elif Last == 0:
+            self.Respond(["OK"], "+CPIN: READY")
+            if self.Device == "SIM7080":
+                self.Urc("SMS Ready", 10)
+        else:
+            self.Respond(["+CPIN: NOT READY"])
+
+    def on_PDP_Action(self, Match):
+        self.Respond(["OK"], "+APP PDP: {},{}".format(Match.group(1), "ACTIVE" if Match.group(2) == "1" else "DEACTIVE"))
+
+    def on_SIM7020_Socket(self, Match):
+        ID = len(self.Sockets)
+        self.Sockets[ID] = bytearray()
+        self.Respond(["+CSOC: {}".format(ID)])
+
+    def on_HTTP_Create(self, Match):
+        self.Respond(["+CHTTPCREATE: {}".format(self.HttpNext)])
+        self.HttpNext += 1
+
+    def on_HTTP_Request(self, ID):
+        """ Answer a HTTP request with the response header and the content in frames of the configured size. """
+        Body = self.Http["body"].encode()
+        Header = b"Content-Length: " + str(len(Body)).encode()
+        Frame = max(1, int(self.Http["frame"]))
+
+        self.Respond([])
+        self.Urc("+CHTTPNMIH: {},{},{},{}".format(ID, self.Http["code"], len(Header), Header.decode()), 1)
+        for Offset in range(0, max(1, len(Body)), Frame):
+            Part = Body[Offset:Offset + Frame]
+            More = 1 if (Offset + Frame) < len(Body) else 0
+            self.Urc("+CHTTPNMIC: {},{},{},{},{}".format(ID, More, len(Body), len(Part), Part.hex().upper()), 2)
+
+    def on_HTTP_SendExt(self, Match):
+        # The first packet of a request begins with the socket ID. The last packet of a request has the flag 0.
+        if self.HttpSocket is None:
+            self.HttpSocket = int(Match.group(4).split(",")[0])
+
+        if Match.group(1) == "0":
+            self.on_HTTP_Request(self.HttpSocket)
+            self.HttpSocket = None
+        else:
+            self.Respond([])
+
+    def on_MQTT_New(self, Match):
+        self.Respond(["+CMQNEW: {}".format(self.MqttNext)])
+        self.MqttNext += 1
+
+    def on_MQTT_Subscribe(self, Match):
+        self.Subscriptions[Match.group(2)] = int(Match.group(1))
+        self.Respond([])
+
+    def on_MQTT_Unsubscribe(self, Match):
+        self.Subscriptions.pop(Match.group(2), None)
+        self.Respond([])
+
+    def on_MQTT_Publish(self, Match):
+        ID, Topic, QoS, Retained, Dup, Length, Payload = Match.groups()
+        self.Respond([])
+
+        # The broker sends the message back when the topic is subscribed.
+        if Topic in self.Subscriptions:
+            self.Urc("+CMQPUB: {},\"{}\",{},{},{},{},\"{}\"".format(ID, Topic, QoS, Retained, Dup, Length, Payload), 5)
+
+    def on_FS_Write(self, Match):
+        Name = Match.group(2)
+        Append = Match.group(3) == "1"
+
+        def Done(Data):
+            self.Files[Name] = (self.Files.get(Name, b"") if Append else b"") + bytes(Data)
+            self.Respond([])
+
+        self.StartRaw("DOWNLOAD", int(Match.group(4)), Done)
+
+    def on_FS_Read(self, Match):
+        Data = self.Files.get(Match.group(2))
+        if Data is None:
+            self.Respond([], "ERROR")
+            return
+
+        Data = Data[int(Match.group(5)):][:int(Match.group(4))]
+        self.Schedule(self.GetLatency(), lambda: self.Write(b"\r\n+CFSRFILE: " + str(len(Data)).encode() + b"\r\n" + Data + b"\r\n\r\nOK\r\n"))
+
+    def on_FS_Delete(self, Match):
+        self.Files.pop(Match.group(2), None)
+        self.Respond([])
+
+    def on_TCP_Open(self, Match):
+        self.Sockets[int(Match.group(1))] = bytearray()
+        self.Respond(["+CAOPEN: {},0".format(Match.group(1))])
+
+    def on_TCP_Close(self, Match):
+        self.Sockets.pop(int(Match.group(1)), None)
+        self.Respond([])
+
+    def on_TCP_Send(self, Match):
+        ID = int(Match.group(1))
+
+        if ID not in self.Sockets:
+            self.Respond([], "ERROR")
+            return
+
+        # The simulated server echoes the data.
+        def Done(Data):
+            self.Sockets[ID] += Data
+            self.Respond([])
+            self.Urc("+CADATAIND: {}".format(ID), 5)
+
+        self.StartRaw("> ", int(Match.group(2)), Done)
+
+    def on_TCP_Receive(self, Match):
+        ID = int(Match.group(1))
+        Buffer = self.Sockets.get(ID, bytearray())
+        Data = bytes(Buffer[:int(Match.group(2))])
+        del Buffer[:len(Data)]
+
+        self.Schedule(self.GetLatency(), lambda: self.Write(b"\r\n+CARECV: " + str(len(Data)).encode() + b"," + Data + b"\r\n\r\nOK\r\n"))
+
+    def on_Rule(self, Rule, Match):
+        Groups = [Match.group(0)] + list(Match.groups())
+        Format = lambda Line: Line.format(*Groups)
+
+        if Rule.Count is not None:
+            Rule.Count -= 1
+
+        for Urc in Rule.Urc:
+            self.Urc(Format(Urc["line"]), Urc.get("delay", 0))
+
+        if Rule.Prompt is not None:
+            Length = int(Groups[Rule.Length]) if Rule.Length is not None else Rule.Bytes
+            self.StartRaw(Rule.Prompt, Length, lambda Data: self.Respond([Format(Line) for Line in Rule.After], Rule.Status, Rule.Delay, Rule.Fault))
+        else:
+            self.Respond([Format(Line) for Line in Rule.Reply], Rule.Status, Rule.Delay, Rule.Fault)
+
+    def Command(self, Line):
+        for Rule in self.Rules:
+            Match = Rule.Pattern.fullmatch(Line)
+            if (Match is not None) and ((Rule.Count is None) or (Rule.Count > 0)):
+                self.on_Rule(Rule, Match)
+                return
+
+        for Pattern, Handler in self.Model:
+            Match = re.fullmatch(Pattern, Line)
+            if Match is not None:
+                Handler(Match)
+                return
+
+        self.Respond([], "ERROR")
+
+    def Process(self):
+        while len(self.Input) > 0:
+            # Raw data transfer. The data are not echoed.
+            if self.Raw is not None:
+                Count = min(self.Raw[0] - len(self.Raw[1]), len(self.Input))
+                self.Raw[1] += self.Input[:Count]
+                del self.Input[:Count]
+
+                if len(self.Raw[1]) == self.Raw[0]:
+                    Done, Data = self.Raw[2], self.Raw[1]
+                    self.Raw = None
+                    Done(Data)
+
+                continue
+
+            Index = self.Input.find(b"\r")
+            if Index < 0:
+                break
+
+            Line = self.Input[:Index].decode("ascii", "replace").strip()
+            del self.Input[:Index + 1]
+            if self.Input[:1] == b"\n":
+                del self.Input[:1]
+
+            if len(Line) == 0:
+                continue
+
+            if self.Echo:
+                self.Write(Line.encode() + b"\r\n")
+
+            self.Command(Line)
+
+            # The following data belong to the raw data transfer of the command.
+            if self.isRawPending:
+                break
+
+    def Flush(self):
+        """ Write the output with the configured byte rate (10 bits per byte). """
+        Now = time.monotonic()
+        if self.Baudrate > 0:
+            self.Credit = min(self.Credit + ((Now - self.LastTime) * self.Baudrate / 10.0), max(64.0, self.Baudrate / 1000.0))
+        self.LastTime = Now
+
+        if len(self.Output) == 0:
+            self.Credit = min(self.Credit, 1.0)
+            return
+
+        Count = len(self.Output) if self.Baudrate == 0 else int(self.Credit)
+        if Count == 0:
+            return
+
+        try:
+            Written = os.write(self.FD, self.Output[:Count])
+        except BlockingIOError:
+            return
+
+        self.Log("TX", self.Output[:Written])
+        del self.Output[:Written]
+        if self.Baudrate > 0:
+            self.Credit -= Written
+
+    def Run(self):
+        os.set_blocking(self.FD, False)
+
+        while True:
+            Now = time.monotonic()
+            while (len(self.Events) > 0) and (self.Events[0][0] <= Now):
+                _, _, Function, Args = heapq.heappop(self.Events)
+                Function(*Args)
+
+            self.Flush()
+
+            Timeout = 0.05
+            if len(self.Events) > 0:
+                Timeout = min(Timeout, max(0.0, self.Events[0][0] - time.monotonic()))
+            if len(self.Output) > 0:
+                Timeout = min(Timeout, 0.001)
+
+            Readable, _, _ = select.select([self.FD], [], [], Timeout)
+            if len(Readable) > 0:
+                try:
+                    Data = os.read(self.FD, 4096)
+                except BlockingIOError:
+                    continue
+                except OSError:
+                    return
+
+                if len(Data) == 0:
+                    return
+
+                self.Log("RX", Data)
+                self.Input += Data
+
+                if not self.isRawPending:
+                    self.Process()
+
+def main():
+    Parser = argparse.ArgumentParser(description = "Scriptable SIM7020 / SIM7080 modem simulator")
+    Transport = Parser.add_mutually_exclusive_group(required = True)
+    Transport.add_argument("--pty", action = "store_true", help = "Create a pseudo terminal and print the path of the device")
+    Transport.add_argument("--fd", type = int, help = "Serve an inherited file descriptor")
+    Parser.add_argument("--device", choices = ["SIM7020", "SIM7080"], help = "Simulated module (default: SIM7020)")
+    Parser.add_argument("--script", help = "JSON script with rules, URCs and options")
+    Parser.add_argument("--latency", type = float, help = "Response latency in ms")
+    Parser.add_argument("--jitter", type = float, help = "Random latency jitter in ms")
+    Parser.add_argument("--baudrate", type = int, help = "Limit the output to baudrate / 10 bytes per second (0 = no limit)")
+    Parser.add_argument("--drop", type = float, help = "Probability to drop a response line")
+    Parser.add_argument("--corrupt", type = float, help = "Probability to corrupt a response line")
+    Parser.add_argument("--error", type = float, help = "Probability to answer a command with ERROR")
+    Parser.add_argument("--noise", type = float, help = "Probability to send garbage before a response")
+    Parser.add_argument("--seed", type = int, help = "Seed for the fault injection")
+    Parser.add_argument("-v", "--verbose", action = "store_true", help = "Print the traffic to stderr")
+    Args = Parser.parse_args()
+
+    Script = {}
+    if Args.script is not None:
+        with open(Args.script) as File:
+            Script = json.load(File)
+
+    if Args.pty:
+        import pty
+        import tty
+
+        Master, Slave = pty.openpty()
+        tty.setraw(Slave)
+        print(os.ttyname(Slave), flush = True)
+        FD = Master
+    else:
+        FD = Args.fd
+
+    try:
+        Modem(FD, Args, Script).Run()
+    except KeyboardInterrupt:
+        pass
+
+if __name__ == "__main__":
+    main()
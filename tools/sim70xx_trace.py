@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#
+# sim70xx_trace.py
+#
+#  Copyright (C) Daniel Kampert, 2022
+#  Website: www.kampis-elektroecke.de
+#  File info: Decoder for the transaction trace of the SIM70XX driver.
+#
+# Usage:
+#   sim70xx_trace.py console.log                    Print the timeline from a console log with the output of SIM70XX_Tools_PrintTrace
+#   sim70xx_trace.py --binary trace.bin             Print the timeline from a raw dump of SIM70XX_Tools_GetTrace
+#   sim70xx_trace.py console.log --chrome out.json  Write a Chrome / Perfetto trace (open with chrome://tracing or ui.perfetto.dev)
+#
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+ENTRY = struct.Struct("<IIHBB8s")
+
+TYPES = ["TX", "RX", "RAW_TX", "RAW_RX", "URC", "DISCARD"]
+STATUS = ["", "OK", "ERROR", "TIMEOUT", "EXPIRED"]
+
+def Name(Table, Index):
+    return Table[Index] if Index < len(Table) else str(Index)
+
+def ReadConsole(File):
+    Data = bytearray()
+    for Line in File:
+        Match = re.search(r"SIM70XX-TRACE ([0-9a-fA-F]+)\s*$", Line)
+        if Match is not None:
+            Data += bytes.fromhex(Match.group(1))
+
+    return bytes(Data)
+
+def Decode(Data):
+    Entries = []
+    Offset = 0
+    Last = None
+
+    # The timestamp is a 32 bit microsecond counter. Remove the overflows.
+    for Timestamp, Length, Sequence, Type, Status, Tag in ENTRY.iter_unpack(Data[:len(Data) - (len(Data) % ENTRY.size)]):
+        if (Last is not None) and (Timestamp < Last):
+            Offset += 1 << 32
+        Last = Timestamp
+
+        Entries.append({
+            "Time": Timestamp + Offset,
+            "Length": Length,
+            "Sequence": Sequence,
+            "Type": Name(TYPES, Type),
+            "Status": Name(STATUS, Status),
+            "Tag": Tag.split(b"\0")[0].decode("ascii", "replace"),
+        })
+
+    return Entries
+
+def PrintTimeline(Entries):
+    Start = {}
+    Base = Entries[0]["Time"] if len(Entries) > 0 else 0
+
+    for Entry in Entries:
+        Line = "{:>12.3f} ms  {:<8} {:<8} #{:<5} {:>6} B  {}".format((Entry["Time"] - Base) / 1000.0, Entry["Type"], Entry["Tag"],
+                                                                   Entry["Sequence"], Entry["Length"], Entry["Status"])
+        if Entry["Type"] == "TX":
+            Start[Entry["Sequence"]] = Entry["Time"]
+        elif (Entry["Type"] == "RX") and (Entry["Sequence"] in Start):
+            Line += "  ({:.3f} ms)".format((Entry["Time"] - Start.pop(Entry["Sequence"])) / 1000.0)
+
+        print(Line)
+
+def WriteChrome(Entries, Path):
+    Events = []
+    Start = {}
+
+    for Entry in Entries:
+        Args = {"Bytes": Entry["Length"], "Sequence": Entry["Sequence"], "Status": Entry["Status"]}
+
+        if Entry["Type"] == "TX":
+            Start[Entry["Sequence"]] = Entry
+        elif (Entry["Type"] == "RX") and (Entry["Sequence"] in Start):
+            Tx = Start.pop(Entry["Sequence"])
+            Events.append({"name": Entry["Tag"], "cat": "command", "ph": "X", "ts": Tx["Time"], "dur": Entry["Time"] - Tx["Time"],
+                           "pid": 1, "tid": 1, "args": dict(Args, TxBytes = Tx["Length"])})
+        else:
+            Events.append({"name": Entry["Tag"] or Entry["Type"], "cat": Entry["Type"].lower(), "ph": "i", "s": "t", "ts": Entry["Time"],
+                           "pid": 1, "tid": 2 if Entry["Type"] == "URC" else 1, "args": Args})
+
+    Events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": 1, "args": {"name": "Commands"}})
+    Events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": 2, "args": {"name": "URC"}})
+
+    with open(Path, "w") as File:
+        json.dump({"traceEvents": Events, "displayTimeUnit": "ms"}, File, indent = 1)
+
+if __name__ == "__main__":
+    Parser = argparse.ArgumentParser(description = "Decode the transaction trace of the SIM70XX driver.")
+    Parser.add_argument("input", help = "Console log or binary trace dump ('-' for stdin)")
+    Parser.add_argument("--binary", action = "store_true", help = "The input is a binary trace dump")
+    Parser.add_argument("--chrome", metavar = "FILE", help = "Write a Chrome / Perfetto trace JSON")
+    Args = Parser.parse_args()
+
+    if Args.binary:
+        with (sys.stdin.buffer if Args.input == "-" else open(Args.input, "rb")) as File:
+            Data = File.read()
+    else:
+        with (sys.stdin if Args.input == "-" else open(Args.input, "r", errors = "replace")) as File:
+            Data = ReadConsole(File)
+
+    Entries = Decode(Data)
+
+    PrintTimeline(Entries)
+
+    if Args.chrome is not None:
+        WriteChrome(Entries, Args.chrome)